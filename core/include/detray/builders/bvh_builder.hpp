@@ -0,0 +1,139 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/builders/volume_builder_interface.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/geometry/tracking_volume.hpp"
+#include "detray/navigation/accelerators/bounding_volume_hierarchy.hpp"
+
+// System include(s)
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace detray {
+
+/// @brief Build a bounding volume hierarchy over the surfaces of a volume.
+///
+/// Decorator class to a volume builder that adds a bounding volume hierarchy
+/// as the volumes geometry accelerator structure. Useful for volumes with
+/// irregularly placed surfaces that do not fit into a surface grid.
+///
+/// @tparam bvh_t the bounding volume hierarchy type (value type of the
+///               @c bvh_collection in the detector accelerator store)
+template <typename detector_t, typename bvh_t>
+class bvh_builder : public volume_decorator<detector_t> {
+
+    using link_id_t = typename detector_t::volume_type::object_id;
+
+    public:
+    using scalar_type = typename detector_t::scalar_type;
+    using detector_type = detector_t;
+    using value_type = typename detector_type::surface_type;
+
+    /// Decorate a volume with a bounding volume hierarchy
+    DETRAY_HOST
+    bvh_builder(
+        std::unique_ptr<volume_builder_interface<detector_t>> vol_builder)
+        : volume_decorator<detector_t>(std::move(vol_builder)) {
+        // The bvh builder provides an acceleration structure to the
+        // volume, so don't add sensitive surfaces to the brute force method
+        if (this->m_builder) {
+            this->m_builder->has_accel(true);
+        }
+    }
+
+    /// Should the passive surfaces be added to the hierarchy ?
+    void set_add_passives(bool is_add_passive = true) {
+        m_add_passives = is_add_passive;
+    }
+
+    /// Set the envelope that is added around the surface bounding boxes
+    void set_envelope(const scalar_type envelope) {
+        assert(envelope > 0.f);
+        m_envelope = envelope;
+    }
+
+    /// Set the maximal number of surfaces in a leaf node
+    void set_max_leaf_size(const dindex max_leaf_size) {
+        assert(max_leaf_size > 0u);
+        m_max_leaf_size = max_leaf_size;
+    }
+
+    /// Set the surface category this hierarchy should contain (type id in
+    /// the accelrator link in the volume)
+    void set_type(link_id_t sf_id) {
+        // Exclude zero, it is reserved for the brute force method
+        assert(static_cast<int>(sf_id) > 0);
+        // Make sure the id fits in the volume accelerator link
+        assert(sf_id < link_id_t::e_size);
+
+        m_id = sf_id;
+    }
+
+    /// Add the volume and the hierarchy to the detector @param det
+    DETRAY_HOST
+    auto build(detector_t &det, typename detector_t::geometry_context ctx = {})
+        -> typename detector_t::volume_type * override {
+
+        using box_t = typename bvh_node<scalar_type>::box_type;
+
+        // Add the surfaces (portals and/or passives) that are owned by the vol
+        typename detector_t::volume_type *vol_ptr =
+            volume_decorator<detector_t>::build(det, ctx);
+
+        // Find the surfaces that should be filled into the hierarchy
+        const auto vol = tracking_volume{det, vol_ptr->index()};
+
+        std::vector<value_type> surfaces{};
+        std::vector<box_t> boxes{};
+        for (auto &sf_desc : vol.surfaces()) {
+
+            if (sf_desc.is_sensitive() or
+                (m_add_passives and sf_desc.is_passive())) {
+
+                // Global bounding box of the surface
+                const auto sf = tracking_surface{det, sf_desc};
+                const auto bounds = sf.local_min_bounds(m_envelope);
+                const box_t loc_box{
+                    0u,
+                    bounds[cuboid3D::e_min_x],
+                    bounds[cuboid3D::e_min_y],
+                    bounds[cuboid3D::e_min_z],
+                    bounds[cuboid3D::e_max_x],
+                    bounds[cuboid3D::e_max_y],
+                    bounds[cuboid3D::e_max_z]};
+
+                boxes.push_back(loc_box.transform(sf.transform(ctx)));
+                surfaces.push_back(sf_desc);
+            }
+        }
+
+        // Add the hierarchy to the detector and link it to its volume
+        constexpr auto bid{detector_t::accel::template get_id<bvh_t>()};
+        det.accelerator_store().template get<bid>().push_back(
+            surfaces, boxes, m_max_leaf_size);
+        vol_ptr->set_link(m_id, bid,
+                          det.accelerator_store().template size<bid>() - 1);
+
+        return vol_ptr;
+    }
+
+    protected:
+    link_id_t m_id{link_id_t::e_sensitive};
+    scalar_type m_envelope{100.f * std::numeric_limits<scalar_type>::epsilon()};
+    dindex m_max_leaf_size{4u};
+    bool m_add_passives{false};
+};
+
+}  // namespace detray
@@ -11,9 +11,12 @@
 #include "detray/builders/grid_factory.hpp"
 #include "detray/builders/volume_builder.hpp"
 #include "detray/builders/volume_builder_interface.hpp"
+#include "detray/builders/volume_lut_builder.hpp"
+#include "detray/core/detail/soa_surface_store.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/definitions/geometry.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
@@ -102,6 +105,18 @@ class detector_builder {
             vol_builder->build(det);
         }
 
+        // Without a filled volume grid, use an r-z lookup table of the
+        // cylindrical volumes, so that tracks can find their start volume
+        using vol_finder_t = typename detector_type::volume_finder;
+        if constexpr (detail::is_grid_v<vol_finder_t>) {
+            if (!has_entries(m_vol_finder)) {
+                auto vol_lut = build_rz_volume_lut<vol_finder_t>(det);
+                if (vol_lut.bins().size() != 0u) {
+                    m_vol_finder = std::move(vol_lut);
+                }
+            }
+        }
+
         det.set_volume_finder(std::move(m_vol_finder));
 
         // TODO: Add sorting, data deduplication etc. here later...
@@ -109,6 +124,23 @@ class detector_builder {
         return det;
     }
 
+    /// Assembles the final detector from the volumes builders and fills the
+    /// SoA mirror @param soa_store of its surface placements and masks
+    /// (packed for the SIMD intersectors of @tparam simd_algebra_t)
+    template <typename simd_algebra_t>
+    DETRAY_HOST auto build(
+        vecmem::memory_resource& resource,
+        soa_surface_store<detector_type, simd_algebra_t>& soa_store)
+        -> detector_type {
+
+        detector_type det = build(resource);
+
+        soa_store =
+            soa_surface_store<detector_type, simd_algebra_t>{det, resource};
+
+        return det;
+    }
+
     /// Put the volumes into a search data structure
     template <typename... Args>
     DETRAY_HOST void set_volume_finder([[maybe_unused]] Args&&... args) {
@@ -131,12 +163,8 @@ class detector_builder {
                 std::vector<scalar>{-2000.f, 2000.f}};
 
             grid_factory_type<vol_finder_t> vgrid_factory{};
-            m_vol_finder = vgrid_factory.template new_grid<
-                axis::open<axis::label::e_r>,
-                axis::circular<axis::label::e_phi>,
-                axis::open<axis::label::e_z>, axis::irregular<>,
-                axis::regular<>, axis::irregular<>>(vgrid_dims, n_vgrid_bins,
-                                                    {}, bin_edges);
+            m_vol_finder = vgrid_factory.template new_grid<vol_finder_t>(
+                vgrid_dims, n_vgrid_bins, {}, bin_edges);
         } else {
             m_vol_finder = vol_finder_t{args...};
         }
@@ -148,6 +176,17 @@ class detector_builder {
     }
 
     protected:
+    /// @returns true if the volume grid @param vgrid contains any volumes
+    template <typename grid_t>
+    DETRAY_HOST static bool has_entries(const grid_t& vgrid) {
+        for (const auto& v : vgrid.all()) {
+            if (!detail::is_invalid_value(v)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     /// Data structure that holds a volume builder for every detector volume
     volume_data_t<std::unique_ptr<volume_builder_interface<detector_type>>>
         m_volumes{};
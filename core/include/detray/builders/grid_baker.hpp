@@ -0,0 +1,125 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+namespace detail {
+
+/// @returns a value on the axis @param ax that falls into the bin @param ibin
+template <typename axis_t>
+DETRAY_HOST auto bin_center(const axis_t &ax, const dindex ibin) {
+
+    using scalar_t = typename axis_t::scalar_type;
+
+    // Index of the bin in the binning (open axes have an underflow bin)
+    int b{static_cast<int>(ibin)};
+    if constexpr (axis_t::bounds_type::type == axis::bounds::e_open) {
+        --b;
+    }
+    const int n_bins{static_cast<int>(ax.nbins()) -
+                     (axis_t::bounds_type::type == axis::bounds::e_open ? 2
+                                                                        : 0)};
+
+    // Under- and overflow bins
+    if (b < 0) {
+        return ax.min() - scalar_t{1};
+    }
+    if (b >= n_bins) {
+        return ax.max() + scalar_t{1};
+    }
+
+    const auto edges = ax.bin_edges(static_cast<dindex>(b));
+
+    return scalar_t{0.5} * (edges[0] + edges[1]);
+}
+
+/// @returns a point in the local grid frame that falls into the bin @param mbin
+template <typename grid_t, std::size_t... I>
+DETRAY_HOST auto bin_center(const grid_t &gr,
+                            const typename grid_t::loc_bin_index &mbin,
+                            std::index_sequence<I...>) {
+    typename grid_t::point_type p{};
+    ((p[I] = bin_center(gr.template get_axis<I>(), mbin[I])), ...);
+
+    return p;
+}
+
+}  // namespace detail
+
+/// @brief Bake the neighborhood of every bin into the bin content.
+///
+/// Every bin of the resulting grid holds the deduplicated union of the bin
+/// contents in its search window @param win. A neighborhood lookup then
+/// reduces to reading a single, contiguous bin, which trades memory for
+/// latency. The resulting grid is marked as baked, so that the navigation
+/// searches it with a zero window.
+///
+/// @param gr the (populated) grid with dynamic bin capacities
+/// @param win the search window to be baked into the bins
+///
+/// @returns the data owning baked grid
+template <typename grid_t>
+DETRAY_HOST auto bake_neighborhood(const grid_t &gr,
+                                   const darray<dindex, 2> &win) ->
+    typename grid_t::template type<true> {
+
+    using baked_grid_t = typename grid_t::template type<true>;
+    using value_t = typename grid_t::value_type;
+    using axes_t = typename baked_grid_t::axes_type;
+
+    static_assert(
+        std::is_same_v<typename grid_t::bin_type, bins::dynamic_array<value_t>>,
+        "Baking the bin neighborhood requires dynamic bin capacities");
+
+    typename baked_grid_t::bin_container_type bin_data{};
+    bin_data.bins.reserve(gr.nbins());
+
+    // Gather the unique entries in the search window around every bin
+    for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+        const auto p = detail::bin_center(
+            gr, gr.deserialize(gbin), std::make_index_sequence<grid_t::dim>{});
+
+        const auto offset{static_cast<dindex>(bin_data.entries.size())};
+        for (const auto &entry : gr.search_unique(p, win)) {
+            bin_data.entries.push_back(entry);
+        }
+        const auto size{
+            static_cast<dindex>(bin_data.entries.size() - offset)};
+
+        bin_data.bins.push_back({offset, size, size});
+    }
+
+    // Copy the axes (for a non-owning grid, the edge offsets point into the
+    // global bin edges container)
+    const auto &edge_offsets = gr.axes().bin_edge_offsets();
+    const auto &bin_edges = gr.axes().bin_edges();
+
+    dvector<dindex_range> axes_data(edge_offsets.begin(), edge_offsets.end());
+    dvector<typename grid_t::scalar_type> edges(bin_edges.begin(),
+                                                bin_edges.end());
+
+    baked_grid_t baked_grid(std::move(bin_data),
+                            axes_t(std::move(axes_data), std::move(edges)));
+    baked_grid.set_baked_window(win);
+
+    return baked_grid;
+}
+
+}  // namespace detray
@@ -9,6 +9,8 @@
 
 // Project include(s).
 #include "detray/builders/bin_fillers.hpp"
+#include "detray/builders/grid_baker.hpp"
+#include "detray/builders/grid_compactor.hpp"
 #include "detray/builders/grid_factory.hpp"
 #include "detray/builders/surface_factory_interface.hpp"
 #include "detray/builders/volume_builder.hpp"
@@ -16,10 +18,15 @@
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/geometry/tracking_volume.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // System include(s)
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -78,6 +85,12 @@ class grid_builder : public volume_decorator<detector_t> {
         m_id = sf_id;
     }
 
+    /// Bake the neighborhood in the search window @param win into the grid
+    /// bins, when the grid is built (a zero window disables the baking)
+    void set_baked_window(const darray<dindex, 2> &win) {
+        m_baked_window = win;
+    }
+
     /// Delegate init call depending on @param span type
     template <typename grid_shape_t>
     DETRAY_HOST void init_grid(
@@ -184,11 +197,42 @@ class grid_builder : public volume_decorator<detector_t> {
             }
         }
 
-        // Add the grid to the detector and link it to its volume
-        constexpr auto gid{detector_t::accel::template get_id<grid_t>()};
-        det.accelerator_store().template push_back<gid>(m_grid);
-        vol_ptr->set_link(m_id, gid,
-                          det.accelerator_store().template size<gid>() - 1);
+        // Precompute the bin neighborhoods, unless the grid content was
+        // already baked (e.g. from file IO)
+        if constexpr (grid_t::is_bakeable) {
+            if ((m_baked_window[0] > 0u || m_baked_window[1] > 0u) &&
+                !m_grid.is_baked()) {
+                m_grid = bake_neighborhood(m_grid, m_baked_window);
+            }
+        } else {
+            assert(m_baked_window[0] == 0u && m_baked_window[1] == 0u &&
+                   "Baking requires a grid with dynamic bin capacities");
+        }
+
+        // Add the grid to the detector and link it to its volume. If the
+        // detector stores the compact representation of the grid instead,
+        // finalize the grid first
+        using accel_t = typename detector_t::accel;
+        using compact16_t = typename compact_grid_t<
+            grid_t, std::uint_least16_t>::template type<false>;
+        using compact32_t = typename compact_grid_t<
+            grid_t, std::uint_least32_t>::template type<false>;
+
+        if constexpr (!accel_t::template is_defined<grid_t>() &&
+                      accel_t::template is_defined<compact16_t>()) {
+            vecmem::host_memory_resource host_mr;
+            add_grid<compact16_t>(
+                det, *vol_ptr,
+                compact_grid<std::uint_least16_t>(m_grid, host_mr));
+        } else if constexpr (!accel_t::template is_defined<grid_t>() &&
+                             accel_t::template is_defined<compact32_t>()) {
+            vecmem::host_memory_resource host_mr;
+            add_grid<compact32_t>(
+                det, *vol_ptr,
+                compact_grid<std::uint_least32_t>(m_grid, host_mr));
+        } else {
+            add_grid<grid_t>(det, *vol_ptr, m_grid);
+        }
 
         return vol_ptr;
     }
@@ -198,11 +242,24 @@ class grid_builder : public volume_decorator<detector_t> {
     auto &get() { return m_grid; }
 
     protected:
+    /// Add the grid @param gr to the detector @param det as the acceleration
+    /// structure type @tparam accel_grid_t and link it to the volume @param vol
+    template <typename accel_grid_t, typename owning_grid_t>
+    DETRAY_HOST void add_grid(detector_t &det,
+                              typename detector_t::volume_type &vol,
+                              const owning_grid_t &gr) const {
+        constexpr auto gid{detector_t::accel::template get_id<accel_grid_t>()};
+        det.accelerator_store().template push_back<gid>(gr);
+        vol.set_link(m_id, gid,
+                     det.accelerator_store().template size<gid>() - 1);
+    }
+
     link_id_t m_id{link_id_t::e_sensitive};
     grid_factory_t m_factory{};
     typename grid_t::template type<true> m_grid{};
     bin_filler_t m_bin_filler{};
     bool m_add_passives{false};
+    darray<dindex, 2> m_baked_window{0u, 0u};
 };
 
 /// Grid builder from single components
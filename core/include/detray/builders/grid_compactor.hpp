@@ -0,0 +1,119 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail {
+
+/// Get the index of a grid entry in the detector surface lookup
+struct surface_index_getter {
+    template <typename entry_t>
+    constexpr dindex operator()(const entry_t &entry) const {
+        if constexpr (std::is_integral_v<entry_t>) {
+            return static_cast<dindex>(entry);
+        } else {
+            return entry.index();
+        }
+    }
+};
+
+}  // namespace detail
+
+/// The data owning, compact grid type that corresponds to the grid @tparam
+/// grid_t, with bin entries of type @tparam index_t
+template <typename grid_t, typename index_t = std::uint_least16_t>
+using compact_grid_t = typename grid_t::template type<true>::template
+    rebind_bins<bins::compact_array<index_t>>;
+
+/// @brief Finalize a grid into its compact, read-only representation.
+///
+/// The bin content is transcribed into a CSR layout: The bin offsets and
+/// the bin entries are stored in two contiguous containers, where every
+/// entry is reduced to a narrow index (e.g. into the surface lookup of the
+/// detector). Empty bin slots and invalid entries are dropped. The compact
+/// grid can be searched in the same way as the original grid.
+///
+/// @tparam index_t the index type of the compact bin entries (16 or 32 bit)
+///
+/// @param gr the (populated) grid to be compacted, owning or non-owning
+/// @param resource the memory resource for the compact grid
+/// @param get_index maps a bin entry of @param gr to its index
+///
+/// @throws std::invalid_argument if an entry index cannot be represented by
+///         @tparam index_t
+///
+/// @returns the data owning compact grid
+template <typename index_t = std::uint_least16_t, typename grid_t,
+          typename index_getter_t = detail::surface_index_getter>
+DETRAY_HOST auto compact_grid(const grid_t &gr,
+                              vecmem::memory_resource &resource,
+                              index_getter_t get_index = {})
+    -> compact_grid_t<grid_t, index_t> {
+
+    static_assert(std::is_integral_v<index_t> && std::is_unsigned_v<index_t>,
+                  "Compact bin entries need to be unsigned indices");
+
+    using compact_t = compact_grid_t<grid_t, index_t>;
+    using axes_t = typename compact_t::axes_type;
+
+    // Transcribe the bin content
+    typename compact_t::bin_container_type bin_data{&resource};
+    bin_data.offsets.reserve(gr.nbins() + 1u);
+    bin_data.offsets.push_back(0u);
+
+    for (const auto &bin : gr.bins()) {
+        for (const auto &entry : bin) {
+            const dindex idx{get_index(entry)};
+
+            if (idx == dindex_invalid) {
+                continue;
+            }
+            if (idx > std::numeric_limits<index_t>::max()) {
+                throw std::invalid_argument(
+                    "ERROR: Grid entry index " + std::to_string(idx) +
+                    " does not fit into the compact bin index type");
+            }
+
+            bin_data.entries.push_back(static_cast<index_t>(idx));
+        }
+        bin_data.offsets.push_back(
+            static_cast<dindex>(bin_data.entries.size()));
+    }
+
+    // Copy the axes (for a non-owning grid, the edge offsets point into the
+    // global bin edges container)
+    const auto &edge_offsets = gr.axes().bin_edge_offsets();
+    const auto &bin_edges = gr.axes().bin_edges();
+
+    dvector<dindex_range> axes_data(edge_offsets.begin(), edge_offsets.end(),
+                                    &resource);
+    dvector<typename grid_t::scalar_type> edges(bin_edges.begin(),
+                                                bin_edges.end(), &resource);
+
+    return compact_t(std::move(bin_data),
+                     axes_t(std::move(axes_data), std::move(edges)));
+}
+
+}  // namespace detray
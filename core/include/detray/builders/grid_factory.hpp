@@ -656,7 +656,8 @@ class grid_factory {
     }
 
     private:
-    /// Initialize a single axis (either regular or irregular)
+    /// Initialize a single axis (regular, irregular or irregular with index
+    /// table)
     /// @note change to template lambda as soon as it becomes available.
     template <std::size_t I, typename binnings>
     auto axis_init([[maybe_unused]] const std::vector<scalar_type> &spans,
@@ -672,6 +673,22 @@ class grid_factory {
                                  static_cast<dindex>(n_bins.at(I))});
             bin_edges.push_back(spans.at(I * 2u));
             bin_edges.push_back(spans.at(I * 2u + 1u));
+        } else if constexpr (std::is_same_v<types::at<binnings, I>,
+                                            axis::irregular_lut<
+                                                host_container_types,
+                                                scalar_type>>) {
+            // The index table is stored behind the bin edges
+            const auto &bin_edges_loc = ax_bin_edges.at(I);
+            axes_data.push_back(
+                {static_cast<dindex>(bin_edges.size()),
+                 static_cast<dindex>(bin_edges_loc.size() - 1u)});
+            bin_edges.insert(bin_edges.end(), bin_edges_loc.begin(),
+                             bin_edges_loc.end());
+
+            const auto index_table =
+                types::at<binnings, I>::make_index_table(bin_edges_loc);
+            bin_edges.insert(bin_edges.end(), index_table.begin(),
+                             index_table.end());
         } else {
             const auto &bin_edges_loc = ax_bin_edges.at(I);
             axes_data.push_back(
@@ -766,11 +783,24 @@ auto grid_factory<bin_t, serializer_t, algebra_t>::to_string(
     std::cout << "}" << std::endl;
 }
 
+namespace detail {
+
+/// Infer the grid factory type from the template arguments of a grid type
+template <typename grid_t, typename algebra_t>
+struct grid_factory_type_impl;
+
+template <typename axes_t, typename bin_t,
+          template <std::size_t> class serializer_t, typename algebra_t>
+struct grid_factory_type_impl<grid_impl<axes_t, bin_t, serializer_t>,
+                              algebra_t> {
+    using type = grid_factory<bin_t, serializer_t, algebra_t>;
+};
+
+}  // namespace detail
+
 // Infer a grid factory type from an already completely assembled grid type
 template <typename grid_t, typename algebra_t = ALGEBRA_PLUGIN<detray::scalar>>
 using grid_factory_type =
-    grid_factory<typename grid_t::bin_type,
-                 simple_serializer /*grid_t::template serializer_type*/,
-                 algebra_t>;
+    typename detail::grid_factory_type_impl<grid_t, algebra_t>::type;
 
 }  // namespace detray
@@ -15,6 +15,7 @@
 #include "detray/builders/surface_factory_interface.hpp"
 #include "detray/builders/volume_builder_interface.hpp"
 #include "detray/geometry/tracking_surface.hpp"
+#include "detray/materials/indexed_material_map.hpp"
 #include "detray/materials/material_map.hpp"
 
 // System include(s)
@@ -23,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -249,7 +251,14 @@ struct add_sf_material_map {
             // The detector only knows the non-owning grid types
             using non_owning_t =
                 typename decltype(mat_grid)::template type<false>;
-            static_assert(materials_t::template is_defined<non_owning_t>());
+            // The detector might store the maps with indexed material instead
+            using indexed_t = typename non_owning_t::template rebind_bins<
+                bins::single<material_index_slab<scalar_t>>>;
+            using map_t = std::conditional_t<
+                !materials_t::template is_defined<non_owning_t>() &&
+                    materials_t::template is_defined<indexed_t>(),
+                indexed_t, non_owning_t>;
+            static_assert(materials_t::template is_defined<map_t>());
 
             // Add the material slabs to the grid
             for (const auto& bin : bin_data) {
@@ -257,8 +266,9 @@ struct add_sf_material_map {
                                                       bin.single_element);
             }
 
-            // Add the material grid to the detector
-            constexpr auto gid{materials_t::template get_id<non_owning_t>()};
+            // Add the material grid to the detector (an indexed material
+            // collection converts the material slabs)
+            constexpr auto gid{materials_t::template get_id<map_t>()};
             mat_store.template push_back<gid>(mat_grid);
 
             // Return the index of the new material map
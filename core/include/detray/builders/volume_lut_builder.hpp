@@ -0,0 +1,178 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/builders/grid_factory.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes.hpp"
+#include "detray/utils/grid/populators.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @brief Get the extent of a cylindrical portal in r and z.
+///
+/// @returns the extent as {r_min, r_max, z_min, z_max}, or an inverted
+/// extent if the portal shape does not bound a cylindrical volume
+struct portal_rz_extent {
+
+    template <typename mask_group_t, typename index_t,
+              typename transform3_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+        using scalar_t = typename mask_t::scalar_type;
+
+        constexpr scalar_t inv{std::numeric_limits<scalar_t>::max()};
+        darray<scalar_t, 4> extent{inv, -inv, inv, -inv};
+
+        // Only portals with a single mask are considered
+        if constexpr (std::is_integral_v<index_t>) {
+            const auto &m = mask_group[index];
+            const scalar_t z{trf.translation()[2]};
+
+            if constexpr (std::is_same_v<shape_t, cylinder2D> ||
+                          std::is_same_v<shape_t, concentric_cylinder2D>) {
+                extent = {m[shape_t::e_r], m[shape_t::e_r],
+                          z + m[shape_t::e_lower_z],
+                          z + m[shape_t::e_upper_z]};
+            } else if constexpr (std::is_same_v<shape_t, ring2D>) {
+                extent = {m[shape_t::e_inner_r], m[shape_t::e_outer_r], z, z};
+            }
+        }
+
+        return extent;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Build an r-z lookup table of the cylindrical detector volumes.
+///
+/// The extent of every cylinder volume is taken from its portals. The
+/// boundaries of all volumes then define an irregular r-z binning (with a
+/// single phi bin), in which every bin holds the index of the volume that
+/// covers it. A volume lookup therefore reduces to two binary searches.
+///
+/// @note Assumes concentric volumes that are aligned with the z-axis. Bins
+/// that are not covered by exactly one volume are left empty.
+///
+/// @tparam grid_t the volume finder grid type (cylinder3D, single bins)
+///
+/// @param det the detector for which to build the lookup table
+///
+/// @returns the lookup table, which is empty, if the detector does not
+/// contain any cylinder volumes
+template <typename grid_t, typename detector_t>
+DETRAY_HOST auto build_rz_volume_lut(const detector_t &det) -> grid_t {
+
+    using scalar_t = typename detector_t::scalar_type;
+    using point_t = typename grid_t::point_type;
+    using extent_t = darray<scalar_t, 4>;
+
+    constexpr scalar_t inv{std::numeric_limits<scalar_t>::max()};
+
+    // Gather the r-z extent of the volumes from their portals
+    std::vector<extent_t> vol_extents(det.volumes().size(),
+                                      extent_t{inv, -inv, inv, -inv});
+
+    for (const auto &sf : det.surfaces()) {
+        if (!sf.is_portal() ||
+            det.volume(sf.volume()).id() != volume_id::e_cylinder) {
+            continue;
+        }
+
+        const auto pt_extent =
+            det.mask_store().template visit<detail::portal_rz_extent>(
+                sf.mask(), det.transform_store().at(sf.transform()));
+
+        auto &vol_extent = vol_extents[sf.volume()];
+        vol_extent[0] = std::min(vol_extent[0], pt_extent[0]);
+        vol_extent[1] = std::max(vol_extent[1], pt_extent[1]);
+        vol_extent[2] = std::min(vol_extent[2], pt_extent[2]);
+        vol_extent[3] = std::max(vol_extent[3], pt_extent[3]);
+    }
+
+    // The volume boundaries define the bin edges
+    std::vector<scalar_t> r_edges;
+    std::vector<scalar_t> z_edges;
+    for (const auto &ext : vol_extents) {
+        if (ext[0] < ext[1] && ext[2] < ext[3]) {
+            r_edges.insert(r_edges.end(), {ext[0], ext[1]});
+            z_edges.insert(z_edges.end(), {ext[2], ext[3]});
+        }
+    }
+
+    if (r_edges.empty()) {
+        return grid_t{};
+    }
+
+    for (auto *edges : {&r_edges, &z_edges}) {
+        std::sort(edges->begin(), edges->end());
+        edges->erase(std::unique(edges->begin(), edges->end()), edges->end());
+    }
+
+    const std::size_t n_r_bins{r_edges.size() - 1u};
+    const std::size_t n_z_bins{z_edges.size() - 1u};
+
+    mask<cylinder3D> lut_dims{0u,
+                              r_edges.front(),
+                              -constant<scalar_t>::pi,
+                              z_edges.front(),
+                              r_edges.back(),
+                              constant<scalar_t>::pi,
+                              z_edges.back()};
+
+    grid_factory_type<grid_t> lut_factory{};
+    grid_t lut = lut_factory.template new_grid<grid_t>(
+        lut_dims, {n_r_bins, 1u, n_z_bins}, {},
+        {r_edges, {-constant<scalar_t>::pi, constant<scalar_t>::pi}, z_edges});
+
+    // Fill every bin with the volume that contains the bin center
+    for (std::size_t ir = 0u; ir < n_r_bins; ++ir) {
+        const scalar_t r{0.5f * (r_edges[ir] + r_edges[ir + 1u])};
+
+        for (std::size_t iz = 0u; iz < n_z_bins; ++iz) {
+            const scalar_t z{0.5f * (z_edges[iz] + z_edges[iz + 1u])};
+
+            dindex vol_idx{dindex_invalid};
+            dindex n_matches{0u};
+            for (dindex v = 0u; v < vol_extents.size(); ++v) {
+                const auto &ext = vol_extents[v];
+                if (ext[0] <= r && r < ext[1] && ext[2] <= z && z < ext[3]) {
+                    vol_idx = v;
+                    ++n_matches;
+                }
+            }
+
+            if (n_matches == 1u) {
+                lut.template populate<replace<>>(point_t{r, 0.f, z}, vol_idx);
+            }
+        }
+    }
+
+    return lut;
+}
+
+}  // namespace detray
@@ -355,7 +355,8 @@ class multi_store {
     ///
     /// @return the functor output
     template <typename functor_t, typename... Args>
-    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id, Args &&... args) {
+    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id,
+                                            Args &&... args) const {
         return m_tuple_container.template visit<functor_t>(
             static_cast<std::size_t>(id), std::forward<Args>(args)...);
     }
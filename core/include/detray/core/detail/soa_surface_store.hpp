@@ -0,0 +1,339 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/utils/type_registry.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// Write the boundary values of the mask @param m into the SIMD lane
+/// @param lane of the SoA mask @param soa_mask
+template <typename soa_mask_t, typename mask_t>
+DETRAY_HOST_DEVICE inline void pack_lane(soa_mask_t &soa_mask,
+                                         const mask_t &m, const dindex lane) {
+    for (std::size_t i = 0u; i < m.values().size(); ++i) {
+        soa_mask[i][lane] = m[i];
+    }
+}
+
+/// Placement of a SIMD vector of surfaces, from which the SoA transform is
+/// built once all lanes are filled
+template <typename simd_algebra_t>
+struct soa_placement {
+
+    using vector3_type = dvector3D<simd_algebra_t>;
+    using transform3_type = dtransform3D<simd_algebra_t>;
+
+    /// Translations, local z-axes and local x-axes
+    vector3_type t{}, z{}, x{};
+
+    /// Write the (AoS) transform @param trf into the SIMD lane @param lane
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE inline void pack_lane(const transform3_t &trf,
+                                             const dindex lane) {
+        const auto &mat = trf.matrix();
+        const auto trl = trf.translation();
+        const auto ax_z = getter::vector<3>(mat, 0u, 2u);
+        const auto ax_x = getter::vector<3>(mat, 0u, 0u);
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            t[i][lane] = trl[i];
+            z[i][lane] = ax_z[i];
+            x[i][lane] = ax_x[i];
+        }
+    }
+
+    /// @returns the SoA transform
+    DETRAY_HOST_DEVICE
+    inline transform3_type transform() const {
+        return transform3_type(t, z, x);
+    }
+};
+
+/// @brief The surfaces of one mask type, packed into SIMD vectors.
+///
+/// Every chunk holds the mask boundaries and placements of up to
+/// @c width surfaces, one surface per SIMD lane.
+template <typename mask_t, typename simd_algebra_t,
+          template <typename...> class vector_t = dvector>
+struct soa_surface_chunks {
+
+    /// Number of surfaces per chunk
+    static constexpr dindex width{
+        static_cast<dindex>(dscalar<simd_algebra_t>::size())};
+
+    using mask_type =
+        mask<typename mask_t::shape, typename mask_t::links_type,
+             simd_algebra_t>;
+    using transform3_type = dtransform3D<simd_algebra_t>;
+    /// Global surface indices of the lanes (unused lanes: dindex_invalid)
+    using lanes_type = darray<dindex, width>;
+
+    vector_t<mask_type> masks;
+    vector_t<transform3_type> transforms;
+    vector_t<lanes_type> surfaces;
+
+    /// Default constructor
+    soa_surface_chunks() = default;
+
+    /// Construct with a specific memory resource @param resource
+    DETRAY_HOST
+    explicit soa_surface_chunks(vecmem::memory_resource &resource)
+        : masks(&resource), transforms(&resource), surfaces(&resource) {}
+
+    /// @returns the number of chunks
+    DETRAY_HOST_DEVICE
+    dindex size() const { return static_cast<dindex>(masks.size()); }
+};
+
+/// Unroll the mask types of a mask registry into a tuple of chunk collections
+template <typename registry_t, typename simd_algebra_t>
+struct soa_chunk_tuple {};
+
+template <typename ID, typename... mask_ts, typename simd_algebra_t>
+struct soa_chunk_tuple<type_registry<ID, mask_ts...>, simd_algebra_t> {
+    using type = std::tuple<soa_surface_chunks<mask_ts, simd_algebra_t>...>;
+};
+
+}  // namespace detail
+
+/// @brief SoA mirror of the surface placements and mask boundaries.
+///
+/// The surfaces of every volume are sorted by mask type and packed into
+/// chunks of SIMD width (see @c detail::soa_surface_chunks), so that the
+/// SoA intersectors can be run directly on the detector data. A surface is
+/// found in the mirror by its global index, i.e. by the index that is stored
+/// in the acceleration structures (e.g. grid bins).
+///
+/// @note Only surfaces with a single mask are mirrored. The volume links
+/// of the SoA masks are not meaningful per lane, they have to be taken from
+/// the detector masks.
+///
+/// @tparam detector_t the detector type that is mirrored
+/// @tparam simd_algebra_t the SoA algebra (e.g. Vc based)
+template <typename detector_t, typename simd_algebra_t>
+class soa_surface_store {
+
+    using mask_registry = typename detector_t::masks;
+
+    public:
+    using mask_id = typename mask_registry::id;
+    using chunk_tuple =
+        typename detail::soa_chunk_tuple<mask_registry, simd_algebra_t>::type;
+
+    /// Number of surfaces per chunk
+    static constexpr dindex width{
+        static_cast<dindex>(dscalar<simd_algebra_t>::size())};
+
+    /// Position of a surface in the mirror
+    struct lane_link {
+        mask_id id{static_cast<mask_id>(mask_registry::e_unknown)};
+        dindex chunk{dindex_invalid};
+        dindex lane{dindex_invalid};
+
+        /// @returns true if the surface is not mirrored
+        DETRAY_HOST_DEVICE
+        constexpr bool is_invalid() const { return chunk == dindex_invalid; }
+    };
+
+    /// Empty store
+    soa_surface_store() = default;
+
+    /// Build the mirror of the detector @param det in the geometry context
+    /// @param ctx
+    DETRAY_HOST
+    soa_surface_store(const detector_t &det, vecmem::memory_resource &resource,
+                      const typename detector_t::geometry_context &ctx = {})
+        : soa_surface_store(
+              det, resource, ctx,
+              std::make_index_sequence<mask_registry::n_types>{}) {}
+
+    /// @returns the number of volumes that are mirrored
+    DETRAY_HOST_DEVICE
+    dindex n_volumes() const {
+        return static_cast<dindex>(m_volume_ranges.size() /
+                                   mask_registry::n_types);
+    }
+
+    /// @returns the packed surfaces of the mask type @tparam id
+    template <mask_id id>
+    DETRAY_HOST_DEVICE decltype(auto) chunks() const {
+        return std::get<mask_registry::to_index(id)>(m_chunks);
+    }
+
+    /// @returns the packed surfaces of type @tparam chunks_t for the runtime
+    /// mask id @param id (the same mask type can be registered for several ids)
+    template <typename chunks_t>
+    DETRAY_HOST_DEVICE const chunks_t &chunks(const mask_id id) const {
+        return chunks<chunks_t>(
+            mask_registry::to_index(id),
+            std::make_index_sequence<mask_registry::n_types>{});
+    }
+
+    /// @returns the range of chunks of the mask type @param id that belong to
+    /// the volume with index @param volume_idx
+    DETRAY_HOST_DEVICE
+    const dindex_range &chunk_range(const dindex volume_idx,
+                                    const mask_id id) const {
+        return m_volume_ranges[volume_idx * mask_registry::n_types +
+                               mask_registry::to_index(id)];
+    }
+
+    /// @returns the position of the surface with global index @param sf_idx
+    /// in the mirror
+    DETRAY_HOST_DEVICE
+    const lane_link &link(const dindex sf_idx) const {
+        return m_surface_links[sf_idx];
+    }
+
+    private:
+    /// Build the chunks for every mask type
+    template <std::size_t... I>
+    DETRAY_HOST soa_surface_store(
+        const detector_t &det, vecmem::memory_resource &resource,
+        const typename detector_t::geometry_context &ctx,
+        std::index_sequence<I...>)
+        : m_chunks(std::tuple_element_t<I, chunk_tuple>(resource)...),
+          m_volume_ranges(det.volumes().size() * mask_registry::n_types,
+                          {0u, 0u}, &resource),
+          m_surface_links(det.surfaces().size(), lane_link{}, &resource) {
+        (fill<I>(det, ctx), ...);
+    }
+
+    /// @returns the chunks at tuple index @param idx
+    template <typename chunks_t, std::size_t... I>
+    DETRAY_HOST_DEVICE const chunks_t &chunks(
+        const std::size_t idx, std::index_sequence<I...>) const {
+        const chunks_t *ptr{nullptr};
+        ((ptr = (I == idx) ? chunks_ptr<chunks_t, I>() : ptr), ...);
+        assert(ptr != nullptr);
+        return *ptr;
+    }
+
+    /// @returns a pointer to the chunks at tuple index @tparam I, if they are
+    /// of type @tparam chunks_t, otherwise nullptr
+    template <typename chunks_t, std::size_t I>
+    DETRAY_HOST_DEVICE const chunks_t *chunks_ptr() const {
+        if constexpr (std::is_same_v<std::tuple_element_t<I, chunk_tuple>,
+                                     chunks_t>) {
+            return &std::get<I>(m_chunks);
+        } else {
+            return nullptr;
+        }
+    }
+
+    /// Pack the surfaces of the mask type with index @tparam I volume by
+    /// volume
+    template <std::size_t I>
+    DETRAY_HOST void fill(const detector_t &det,
+                          const typename detector_t::geometry_context &ctx) {
+
+        constexpr mask_id id{mask_registry::to_id(I)};
+
+        const auto &masks = det.mask_store().template get<id>();
+        auto &chunks = std::get<I>(m_chunks);
+
+        // Surface indices and mask indices of this type, per volume
+        std::vector<std::vector<std::pair<dindex, dindex>>> vol_surfaces(
+            det.volumes().size());
+
+        for (dindex sf_idx = 0u; sf_idx < det.surfaces().size(); ++sf_idx) {
+            const auto &sf = det.surfaces()[sf_idx];
+            if (sf.mask().id() != id) {
+                continue;
+            }
+
+            const auto mask_idx = single_mask_index(sf.mask().index());
+            if (mask_idx != dindex_invalid) {
+                vol_surfaces[sf.volume()].emplace_back(sf_idx, mask_idx);
+            }
+        }
+
+        for (dindex vol_idx = 0u; vol_idx < vol_surfaces.size(); ++vol_idx) {
+            const auto &surfaces = vol_surfaces[vol_idx];
+            const dindex first_chunk{chunks.size()};
+
+            for (dindex first = 0u; first < surfaces.size(); first += width) {
+                const auto n_lanes{static_cast<dindex>(std::min(
+                    static_cast<std::size_t>(width), surfaces.size() - first))};
+
+                typename std::tuple_element_t<I, chunk_tuple>::mask_type
+                    soa_mask{};
+                detail::soa_placement<simd_algebra_t> placement{};
+                darray<dindex, width> lanes{};
+
+                for (dindex lane = 0u; lane < width; ++lane) {
+                    // Pad the unused lanes with the last surface, so that
+                    // they hold valid numbers
+                    const auto &[sf_idx, mask_idx] =
+                        surfaces[first + std::min(lane, n_lanes - 1u)];
+
+                    detail::pack_lane(soa_mask, masks[mask_idx], lane);
+                    placement.pack_lane(
+                        det.transform_store().at(
+                            det.surfaces()[sf_idx].transform(), ctx),
+                        lane);
+
+                    if (lane < n_lanes) {
+                        lanes[lane] = sf_idx;
+                        m_surface_links[sf_idx] = {id, chunks.size(), lane};
+                    } else {
+                        lanes[lane] = dindex_invalid;
+                    }
+                }
+
+                chunks.masks.push_back(soa_mask);
+                chunks.transforms.push_back(placement.transform());
+                chunks.surfaces.push_back(lanes);
+            }
+
+            m_volume_ranges[vol_idx * mask_registry::n_types + I] = {
+                first_chunk, chunks.size()};
+        }
+    }
+
+    /// @returns the mask index of a surface that has a single mask, otherwise
+    /// dindex_invalid
+    template <typename index_t>
+    DETRAY_HOST static dindex single_mask_index(const index_t &idx) {
+        if constexpr (std::is_integral_v<index_t>) {
+            return static_cast<dindex>(idx);
+        } else {
+            return (idx[1] - idx[0] == 1u) ? static_cast<dindex>(idx[0])
+                                           : dindex_invalid;
+        }
+    }
+
+    /// Packed surfaces per mask type
+    chunk_tuple m_chunks{};
+    /// Chunk range per volume and mask type
+    dvector<dindex_range> m_volume_ranges{};
+    /// Position of every detector surface in the mirror
+    dvector<lane_link> m_surface_links{};
+};
+
+}  // namespace detray
@@ -19,11 +19,20 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
 namespace detray::detail {
 
+/// How to find the tuple element that corresponds to a runtime index
+enum class visit_dispatch : std::uint_least8_t {
+    /// Compare the index against every tuple index in turn
+    e_linear = 0,
+    /// Jump to the tuple element via switch statements (jump tables)
+    e_switch = 1,
+};
+
 /// @brief detray tuple wrapper.
 ///
 /// @tparam An enum of type IDs that needs to match the [value] types of the
@@ -128,14 +137,23 @@ class tuple_container {
     /// Visits a tuple element according to its @param idx and calls
     /// @tparam functor_t with the arguments @param As on it.
     ///
+    /// @tparam dispatch how to find the tuple element for the index
+    ///
     /// @returns the functor result (this is necessarily always of the same
     /// type, regardless the input tuple element type).
-    template <typename functor_t, typename... Args>
+    template <typename functor_t,
+              visit_dispatch dispatch = visit_dispatch::e_switch,
+              typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const std::size_t idx,
                                             Args &&... As) const {
 
-        return visit<functor_t>(idx, std::make_index_sequence<sizeof...(Ts)>{},
-                                std::forward<Args>(As)...);
+        if constexpr (dispatch == visit_dispatch::e_switch) {
+            return visit_switch<functor_t, 0u>(idx, std::forward<Args>(As)...);
+        } else {
+            return visit<functor_t>(idx,
+                                    std::make_index_sequence<sizeof...(Ts)>{},
+                                    std::forward<Args>(As)...);
+        }
     }
 
     private:
@@ -214,6 +232,110 @@ class tuple_container {
         }
     }
 
+    /// Result type of a visitor @tparam functor_t
+    template <typename functor_t, typename... Args>
+    using visit_result_t =
+        std::invoke_result_t<functor_t,
+                             const detail::tuple_element_t<0, tuple_type> &,
+                             Args...>;
+
+    /// Maximal number of case labels per switch statement
+    static constexpr std::size_t n_switch_cases{16u};
+
+    /// Calls @tparam functor_t on the tuple element @tparam I , if it exists
+    template <typename functor_t, std::size_t I, typename... Args>
+    DETRAY_HOST_DEVICE visit_result_t<functor_t, Args...> visit_case(
+        Args &&... As) const {
+
+        if constexpr (I < sizeof...(Ts)) {
+            return functor_t()(get<I>(), std::forward<Args>(As)...);
+        } else if constexpr (not std::is_same_v<
+                                 visit_result_t<functor_t, Args...>, void>) {
+            // Cannot be reached: no matching element for this case label
+            return {};
+        }
+    }
+
+    /// Visit the tuple element that corresponds to @param idx with a switch
+    /// statement, which the compiler can turn into a jump table. Every switch
+    /// covers @c n_switch_cases tuple elements, starting at @tparam offset.
+    /// The tuple elements beyond that are handled in a nested switch.
+    ///
+    /// @note this does not need function pointers and is therefore also
+    /// available in device code.
+    template <typename functor_t, std::size_t offset, typename... Args>
+    DETRAY_HOST_DEVICE visit_result_t<functor_t, Args...> visit_switch(
+        const std::size_t idx, Args &&... As) const {
+
+        switch (idx - offset) {
+            case 0u:
+                return visit_case<functor_t, offset>(std::forward<Args>(As)...);
+            case 1u:
+                return visit_case<functor_t, offset + 1u>(
+                    std::forward<Args>(As)...);
+            case 2u:
+                return visit_case<functor_t, offset + 2u>(
+                    std::forward<Args>(As)...);
+            case 3u:
+                return visit_case<functor_t, offset + 3u>(
+                    std::forward<Args>(As)...);
+            case 4u:
+                return visit_case<functor_t, offset + 4u>(
+                    std::forward<Args>(As)...);
+            case 5u:
+                return visit_case<functor_t, offset + 5u>(
+                    std::forward<Args>(As)...);
+            case 6u:
+                return visit_case<functor_t, offset + 6u>(
+                    std::forward<Args>(As)...);
+            case 7u:
+                return visit_case<functor_t, offset + 7u>(
+                    std::forward<Args>(As)...);
+            case 8u:
+                return visit_case<functor_t, offset + 8u>(
+                    std::forward<Args>(As)...);
+            case 9u:
+                return visit_case<functor_t, offset + 9u>(
+                    std::forward<Args>(As)...);
+            case 10u:
+                return visit_case<functor_t, offset + 10u>(
+                    std::forward<Args>(As)...);
+            case 11u:
+                return visit_case<functor_t, offset + 11u>(
+                    std::forward<Args>(As)...);
+            case 12u:
+                return visit_case<functor_t, offset + 12u>(
+                    std::forward<Args>(As)...);
+            case 13u:
+                return visit_case<functor_t, offset + 13u>(
+                    std::forward<Args>(As)...);
+            case 14u:
+                return visit_case<functor_t, offset + 14u>(
+                    std::forward<Args>(As)...);
+            case 15u:
+                return visit_case<functor_t, offset + 15u>(
+                    std::forward<Args>(As)...);
+            default:
+                break;
+        }
+
+        static_assert(n_switch_cases == 16u,
+                      "Case labels do not match the switch size");
+
+        // Tuple elements beyond the cases of this switch
+        if constexpr (offset + n_switch_cases < sizeof...(Ts)) {
+            if (idx >= offset + n_switch_cases) {
+                return visit_switch<functor_t, offset + n_switch_cases>(
+                    idx, std::forward<Args>(As)...);
+            }
+        }
+        // If there is no matching ID, return default output
+        if constexpr (not std::is_same_v<visit_result_t<functor_t, Args...>,
+                                         void>) {
+            return {};
+        }
+    }
+
     /// The underlying tuple container
     tuple_type _tuple;
 };
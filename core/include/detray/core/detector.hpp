@@ -16,17 +16,22 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/geometry/coordinates/cylindrical3D.hpp"
 #include "detray/geometry/detail/volume_descriptor.hpp"
 #include "detray/utils/ranges.hpp"  // @TODO remove
+#include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
 #include <algorithm>
+#include <cassert>
 #include <map>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 namespace detray {
 
@@ -214,16 +219,59 @@ class detector {
     }
 
     /// @return the volume by global cartesian @param position - const access
+    ///
+    /// @note the position has to lie inside of the detector, use
+    /// @c volume_index() to check
     DETRAY_HOST_DEVICE
     inline const auto &volume(const point3_type &p) const {
-        // The 3D cylindrical volume search grid is concentric
-        const transform3_type identity{};
-        const auto loc_pos =
-            _volume_finder.project(identity, p, identity.translation());
+        const dindex vol_idx{volume_index(p)};
+        assert(vol_idx != dindex_invalid &&
+               "Position is not contained in a detector volume");
+        return _volumes[vol_idx];
+    }
 
-        // Only one entry per bin
-        dindex volume_index{*_volume_finder.search(loc_pos)};
-        return _volumes[volume_index];
+    /// @returns the index of the volume that contains the global cartesian
+    /// position @param p, or dindex_invalid if it could not be found
+    DETRAY_HOST_DEVICE
+    inline dindex volume_index(const point3_type &p) const {
+
+        if constexpr (detail::is_grid_v<volume_finder>) {
+            if (_volume_finder.bins().size() == 0u) {
+                return dindex_invalid;
+            }
+
+            dindex vol_idx{dindex_invalid};
+
+            // Fast path for r-z lookup tables: no phi binning to resolve
+            if constexpr (std::is_same_v<
+                              typename volume_finder::local_frame_type,
+                              cylindrical3D<algebra_type>>) {
+                const auto &phi_axis =
+                    _volume_finder.template get_axis<axis::label::e_phi>();
+
+                if (phi_axis.nbins() == 1u) {
+                    const typename volume_finder::point_type loc_pos{
+                        getter::perp(p), 0.f, p[2]};
+                    const auto mbin = _volume_finder.axes().bins(loc_pos);
+                    vol_idx = *_volume_finder.bin(mbin);
+
+                    return (vol_idx < _volumes.size()) ? vol_idx
+                                                       : dindex_invalid;
+                }
+            }
+
+            // The 3D cylindrical volume search grid is concentric
+            const transform3_type identity{};
+            const auto loc_pos =
+                _volume_finder.project(identity, p, identity.translation());
+
+            // Only one entry per bin
+            vol_idx = *_volume_finder.search(loc_pos);
+
+            return (vol_idx < _volumes.size()) ? vol_idx : dindex_invalid;
+        } else {
+            return dindex_invalid;
+        }
     }
 
     /// @return the sub-volumes of the detector - const access
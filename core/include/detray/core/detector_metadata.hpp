@@ -21,6 +21,7 @@
 #include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
+#include "detray/navigation/accelerators/bounding_volume_hierarchy.hpp"
 #include "detray/navigation/accelerators/brute_force_finder.hpp"
 #include "detray/navigation/accelerators/surface_grid.hpp"
 
@@ -249,8 +250,9 @@ unbounded_cell, unmasked_plane*/>;
         e_cylinder2_grid = 2,  // e.g. barrel layers
         e_irr_disc_grid = 3,
         e_irr_cylinder2_grid = 4,
-        // e_cylinder3_grid = 5,
-        // e_irr_cylinder3_grid = 6,
+        e_bvh = 5,  // e.g. irregular volumes with many passive surfaces
+        // e_cylinder3_grid = 6,
+        // e_irr_cylinder3_grid = 7,
         // ... e.g. frustum navigation types
         e_default = e_brute_force,
     };
@@ -271,8 +273,9 @@ unbounded_cell, unmasked_plane*/>;
                         cylinder2D_sf_grid<surface_type, container_t>>,
                     grid_collection<
                         irr_disc_sf_grid<surface_type, container_t>>,
-                    grid_collection<irr_cylinder2D_sf_grid<
-                        surface_type, container_t>> /*,
+                    grid_collection<
+                        irr_cylinder2D_sf_grid<surface_type, container_t>>,
+                    bvh_collection<surface_type, container_t> /*,
 grid_collection<cylinder3D_sf_grid<surface_type,
 container_t>>,
 grid_collection<irr_cylinder3D_sf_grid<surface_type,
@@ -281,8 +284,8 @@ container_t>>*/>;
     /// Volume search grid
     template <typename container_t = host_container_types>
     using volume_finder =
-        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular,
-                  axis::regular, axis::irregular>,
+        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular_lut,
+                  axis::regular, axis::irregular_lut>,
              bins::single<dindex>, simple_serializer, container_t>;
 };
 
@@ -28,6 +28,28 @@ DETRAY_HOST_DEVICE inline void sequential_sort(RandomIt first, RandomIt last) {
 #endif
 }
 
+/// @brief sequential (single thread) sort function for ranges that are
+/// already almost sorted (linear in the number of elements and inversions)
+template <class RandomIt>
+DETRAY_HOST_DEVICE inline void sequential_resort(RandomIt first,
+                                                 RandomIt last) {
+    detray::shift_insertion_sort(first, last);
+}
+
+/// @brief sequential (single thread) partial sort function: The smallest
+/// elements are sorted into [first, middle)
+template <class RandomIt>
+DETRAY_HOST_DEVICE inline void sequential_partial_sort(RandomIt first,
+                                                       RandomIt middle,
+                                                       RandomIt last) {
+#if defined(__CUDACC__) || defined(CL_SYCL_LANGUAGE_VERSION) || \
+    defined(SYCL_LANGUAGE_VERSION)
+    detray::partial_selection_sort(first, middle, last);
+#else
+    std::partial_sort(first, middle, last);
+#endif
+}
+
 /// @brief find_if implementation for host/devcie (single thread)
 template <class RandomIt, class Predicate>
 DETRAY_HOST_DEVICE inline auto find_if(RandomIt first, RandomIt last,
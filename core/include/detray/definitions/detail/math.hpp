@@ -31,6 +31,7 @@ using std::copysign;
 using std::cos;
 using std::exp;
 using std::fabs;
+using std::floor;
 using std::fma;
 using std::log;
 using std::max;
@@ -44,4 +44,13 @@ enum class binning {
     e_irregular = 1,
 };
 
+/// memory layout of the grid bins, i.e. the grid serializer type.
+///
+/// simple: row-major order of the bins.
+/// morton: Z-order of the bins, for neighborhood lookups.
+enum class bin_layout {
+    e_simple = 0,
+    e_morton = 1,
+};
+
 }  // namespace detray::axis
@@ -12,9 +12,26 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/material.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <type_traits>
 
 namespace detray::detail {
 
+/// @returns the surface descriptor for an entry of an acceleration data
+/// structure: Either the entry is the descriptor itself, or an index into the
+/// surface lookup of the detector @param det (e.g. for compact grids)
+template <typename detector_t, typename entry_t>
+DETRAY_HOST_DEVICE inline decltype(auto) get_surface(const detector_t &det,
+                                                     const entry_t &entry) {
+    if constexpr (std::is_integral_v<entry_t>) {
+        return det.surface(static_cast<dindex>(entry));
+    } else {
+        return (entry);
+    }
+}
+
 /// A functor to retrieve the material parameters
 struct get_material_params {
     template <typename mat_group_t, typename index_t, typename point_t>
@@ -47,14 +64,16 @@ struct surface_getter {
 
     /// Call operator that forwards the neighborhood search call in a volume
     /// to a surface finder data structure
-    template <typename accel_group_t, typename accel_index_t, typename... Args>
+    template <typename accel_group_t, typename accel_index_t,
+              typename detector_t, typename... Args>
     DETRAY_HOST_DEVICE inline void operator()(const accel_group_t &group,
                                               const accel_index_t index,
+                                              const detector_t &det,
                                               Args &&... args) const {
 
         // Run over the surfaces in a single acceleration data structure
         for (const auto &sf : group[index].all()) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+            functor_t{}(get_surface(det, sf), std::forward<Args>(args)...);
         }
     }
 };
@@ -74,10 +93,56 @@ struct neighborhood_getter {
         const track_t &track, const config_t &cfg, Args &&... args) const {
 
         decltype(auto) accel = group[index];
+        using accel_t = std::remove_cvref_t<decltype(accel)>;
+
+        // Skip the duplicate entries of the search window. Configurations
+        // that cannot request the unique search always get the plain search
+        if constexpr (detray::detail::is_grid_v<accel_t> &&
+                      detray::detail::has_unique_grid_search_v<config_t>) {
+            if (cfg.unique_grid_search) {
+                for (const auto &sf :
+                     accel.search_unique(det, volume, track, cfg)) {
+                    functor_t{}(get_surface(det, sf),
+                                std::forward<Args>(args)...);
+                }
+                return;
+            }
+        }
 
         // Run over the surfaces in a single acceleration data structure
         for (const auto &sf : accel.search(det, volume, track, cfg)) {
-            functor_t{}(sf, std::forward<Args>(args)...);
+            functor_t{}(get_surface(det, sf), std::forward<Args>(args)...);
+        }
+    }
+};
+
+/// A functor to find surfaces along the straight line tangential to the track,
+/// up to a maximal distance: Grids are searched by ray marching, all other
+/// acceleration structures by their regular neighborhood search
+template <typename functor_t>
+struct along_track_getter {
+
+    template <typename accel_group_t, typename accel_index_t,
+              typename detector_t, typename track_t, typename config_t,
+              typename scalar_t, typename... Args>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const accel_group_t &group, const accel_index_t index,
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        const track_t &track, const config_t &cfg, const scalar_t max_dist,
+        Args &&... args) const {
+
+        decltype(auto) accel = group[index];
+        using accel_t = std::remove_cvref_t<decltype(accel)>;
+
+        if constexpr (detray::detail::is_grid_v<accel_t>) {
+            for (const auto &sf :
+                 accel.search_along(det, volume, track, max_dist)) {
+                functor_t{}(get_surface(det, sf), std::forward<Args>(args)...);
+            }
+        } else {
+            for (const auto &sf : accel.search(det, volume, track, cfg)) {
+                functor_t{}(get_surface(det, sf), std::forward<Args>(args)...);
+            }
         }
     }
 };
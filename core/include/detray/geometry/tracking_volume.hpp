@@ -140,7 +140,7 @@ class tracking_volume {
               typename... Args>
     DETRAY_HOST_DEVICE constexpr void visit_surfaces(Args &&... args) const {
         visit_surfaces_impl<detail::surface_getter<functor_t>>(
-            std::forward<Args>(args)...);
+            m_detector, std::forward<Args>(args)...);
     }
 
     /// Apply a functor to a neighborhood of surfaces around a track position
@@ -159,6 +159,29 @@ class tracking_volume {
             m_detector, m_desc, track, cfg, std::forward<Args>(args)...);
     }
 
+    /// Apply a functor to the surfaces along a track in a single acceleration
+    /// structure of the volume: Grids are searched along the straight line
+    /// tangential to the track up to the path length @param max_dist.
+    ///
+    /// @tparam functor_t the prescription to be applied to the surfaces
+    /// @tparam id        the type id of the acceleration structure link
+    /// @tparam track_t   the track along which to build up the neighborhood
+    /// @tparam Args      types of additional arguments to the functor
+    template <typename functor_t, typename descr_t::object_id id,
+              typename track_t, typename config_t, typename... Args>
+    DETRAY_HOST_DEVICE constexpr void visit_accel_along_track(
+        const track_t &track, const config_t &cfg, const scalar_type max_dist,
+        Args &&... args) const {
+        const auto &link{m_desc.template accel_link<id>()};
+
+        if (not link.is_invalid()) {
+            m_detector.accelerator_store()
+                .template visit<detail::along_track_getter<functor_t>>(
+                    link, m_detector, m_desc, track, cfg, max_dist,
+                    std::forward<Args>(args)...);
+        }
+    }
+
     /// Call a functor on the volume material with additional arguments.
     ///
     /// @tparam functor_t the prescription to be applied to the material
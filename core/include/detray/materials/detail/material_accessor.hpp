@@ -32,10 +32,12 @@ DETRAY_HOST_DEVICE inline constexpr decltype(auto) get(
 }
 
 /// Access to material slabs in a material map or volume material
-template <
-    class material_coll_t,
-    std::enable_if_t<detail::is_grid_v<typename material_coll_t::value_type>,
-                     bool> = true>
+template <class material_coll_t,
+          std::enable_if_t<
+              detail::is_grid_v<typename material_coll_t::value_type> &&
+                  !detail::is_indexed_material_map_v<
+                      typename material_coll_t::value_type>,
+              bool> = true>
 DETRAY_HOST_DEVICE inline constexpr decltype(auto) get(
     const material_coll_t &material_coll, const dindex idx,
     const typename material_coll_t::value_type::point_type
@@ -45,6 +47,21 @@ DETRAY_HOST_DEVICE inline constexpr decltype(auto) get(
     return *(material_coll[idx].search(loc_point));
 }
 
+/// Access to material slabs in an indexed material map: The bin entry is
+/// resolved against the material table of the collection
+template <class material_coll_t,
+          std::enable_if_t<detail::is_indexed_material_map_v<
+                               typename material_coll_t::value_type>,
+                           bool> = true>
+DETRAY_HOST_DEVICE inline constexpr auto get(
+    const material_coll_t &material_coll, const dindex idx,
+    const typename material_coll_t::value_type::point_type
+        &loc_point) noexcept {
+
+    // Find the material index and thickness (only one entry per bin)
+    return material_coll.slab(*(material_coll[idx].search(loc_point)));
+}
+
 }  // namespace material_accessor
 
 }  // namespace detray::detail
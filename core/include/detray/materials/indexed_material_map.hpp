@@ -0,0 +1,385 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/utils/grid/detail/grid_bins.hpp"
+#include "detray/utils/grid/grid.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+#include "detray/utils/grid/serializers.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cassert>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Bin entry of an indexed material map.
+///
+/// Instead of the full material parameters, only the index of the material
+/// in the material table of the map collection and the slab thickness are
+/// stored.
+template <typename scalar_t>
+struct material_index_slab {
+    using scalar_type = scalar_t;
+
+    constexpr material_index_slab() = default;
+
+    /// Constructor
+    /// @param idx index of the material in the material table
+    /// @param thickness is the thickness of the slab
+    DETRAY_HOST_DEVICE
+    constexpr material_index_slab(const dindex idx, const scalar_type thickness)
+        : m_index(idx), m_thickness(thickness) {}
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const material_index_slab& rhs) const {
+        return (m_index == rhs.m_index && m_thickness == rhs.m_thickness);
+    }
+
+    /// @returns the index of the material in the material table
+    DETRAY_HOST_DEVICE
+    constexpr dindex index() const { return m_index; }
+    /// @returns the thickness
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type thickness() const { return m_thickness; }
+
+    private:
+    dindex m_index{dindex_invalid};
+    scalar_type m_thickness{0.f};
+};
+
+/// @brief Material slab that is assembled from an indexed material map entry.
+///
+/// Refers to the material in the material table, so that it provides the
+/// same interface as the @c material_slab without copying the material
+/// parameters. The thickness in X0/L0 is computed on the fly.
+template <typename scalar_t>
+struct indexed_material_slab {
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_t>;
+
+    /// Constructor
+    /// @param mat the material in the material table
+    /// @param thickness is the thickness of the slab
+    DETRAY_HOST_DEVICE
+    constexpr indexed_material_slab(const material_type& mat,
+                                    const scalar_type thickness)
+        : m_material(&mat), m_thickness(thickness) {}
+
+    /// Boolean operator
+    DETRAY_HOST_DEVICE
+    constexpr explicit operator bool() const {
+        if (m_thickness <= std::numeric_limits<scalar_type>::epsilon() ||
+            m_thickness == std::numeric_limits<scalar_type>::max() ||
+            *m_material == vacuum<scalar_type>() ||
+            m_material->mass_density() == 0.f ||
+            m_material->molar_density() == 0.f) {
+            return false;
+        }
+        return true;
+    }
+
+    /// Access the (average) material parameters.
+    DETRAY_HOST_DEVICE
+    constexpr const material_type& get_material() const { return *m_material; }
+    /// Return the thickness.
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type thickness() const { return m_thickness; }
+    /// Return the radiation length fraction.
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type thickness_in_X0() const {
+        return m_thickness / m_material->X0();
+    }
+    /// Return the nuclear interaction length fraction.
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type thickness_in_L0() const {
+        return m_thickness / m_material->L0();
+    }
+
+    /// @returns the path segment through the material
+    ///
+    /// @param cos_inc_angle cosine of the track incidence angle
+    DETRAY_HOST_DEVICE constexpr scalar_type path_segment(
+        const scalar_type cos_inc_angle, const scalar_type = 0.f) const {
+        return m_thickness / cos_inc_angle;
+    }
+
+    /// @returns the path segment through the material in X0
+    ///
+    /// @param cos_inc_angle cosine of the track incidence angle
+    DETRAY_HOST_DEVICE constexpr scalar_type path_segment_in_X0(
+        const scalar_type cos_inc_angle, const scalar_type = 0.f) const {
+        return thickness_in_X0() / cos_inc_angle;
+    }
+
+    /// @returns the path segment through the material in L0
+    ///
+    /// @param cos_inc_angle cosine of the track incidence angle
+    DETRAY_HOST_DEVICE constexpr scalar_type path_segment_in_L0(
+        const scalar_type cos_inc_angle, const scalar_type = 0.f) const {
+        return thickness_in_L0() / cos_inc_angle;
+    }
+
+    /// @returns a copy of the full material slab
+    DETRAY_HOST_DEVICE
+    constexpr material_slab<scalar_type> to_slab() const {
+        return {*m_material, m_thickness};
+    }
+
+    /// @returns a string stream that prints the material details
+    DETRAY_HOST
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const indexed_material_slab& mat) {
+        os << "slab: ";
+        os << mat.get_material().to_string();
+        os << " | thickness: " << mat.thickness() << "mm";
+
+        return os;
+    }
+
+    private:
+    const material_type* m_material{nullptr};
+    scalar_type m_thickness{0.f};
+};
+
+/// Definition of binned material, where the bins refer to a material table
+template <typename shape, typename scalar_t,
+          typename container_t = host_container_types, bool owning = false>
+using indexed_material_map =
+    grid<axes<shape>, bins::single<material_index_slab<scalar_t>>,
+         simple_serializer, container_t, owning>;
+
+/// @brief A collection of indexed material maps and their material table.
+///
+/// Wraps a @c grid_collection of indexed material maps together with the
+/// table of distinct materials the bins refer to. Material maps with full
+/// material slabs are converted when they are added: Every distinct
+/// material is stored only once, which shrinks the bin storage considerably
+/// for detectors that are built from few materials.
+///
+/// @tparam map_t the non-owning indexed material map type
+template <typename map_t>
+class indexed_material_collection {
+
+    using map_collection_type = grid_collection<map_t>;
+    using entry_type = typename map_t::value_type;
+
+    static_assert(!map_t::is_owning,
+                  "Indexed material collection requires non-owning maps");
+
+    public:
+    using value_type = map_t;
+    using size_type = dindex;
+    using scalar_type = typename entry_type::scalar_type;
+    using material_type = material<scalar_type>;
+
+    template <typename T>
+    using vector_type = typename map_collection_type::template vector_type<T>;
+    using material_container_type = vector_type<material_type>;
+
+    /// The owning material map with full material slabs this collection
+    /// can be filled from
+    using slab_map_type = typename map_t::template rebind_bins<
+        bins::single<material_slab<scalar_type>>>::template type<true>;
+
+    /// Vecmem based view type
+    using view_type =
+        dmulti_view<typename map_collection_type::view_type,
+                    detail::get_view_t<material_container_type>>;
+
+    /// Vecmem based view type - const
+    using const_view_type =
+        dmulti_view<typename map_collection_type::const_view_type,
+                    detail::get_view_t<const material_container_type>>;
+
+    /// Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<typename map_collection_type::buffer_type,
+                      detail::get_buffer_t<material_container_type>>;
+
+    /// Make the collection default constructible: Empty
+    indexed_material_collection() = default;
+
+    /// Create empty collection from specific vecmem memory resource
+    DETRAY_HOST
+    explicit indexed_material_collection(vecmem::memory_resource* resource)
+        : m_maps(resource), m_materials(resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE indexed_material_collection(coll_view_t& view)
+        : m_maps(detail::get<0>(view.m_view)),
+          m_materials(detail::get<1>(view.m_view)) {}
+
+    /// @returns the number of material maps in the collection - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> dindex { return m_maps.size(); }
+
+    /// @returns true if the collection does not contain any maps
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool { return m_maps.empty(); }
+
+    /// @returns an iterator that points to the first material map
+    DETRAY_HOST_DEVICE
+    constexpr auto begin() const noexcept { return m_maps.begin(); }
+
+    /// @returns an iterator that points to the coll. end
+    DETRAY_HOST_DEVICE
+    constexpr auto end() const noexcept { return m_maps.end(); }
+
+    /// @brief Resize the underlying containers
+    /// @note Not defined! The amount of memory can differ for every map
+    DETRAY_HOST_DEVICE
+    constexpr void resize(std::size_t) noexcept { /*Not defined*/
+    }
+
+    /// @brief Reserve memory
+    /// @note Not defined! The amount of memory can differ for every map
+    DETRAY_HOST_DEVICE
+    constexpr void reserve(std::size_t) noexcept { /*Not defined*/
+    }
+
+    /// Removes all material maps and the material table
+    DETRAY_HOST_DEVICE
+    constexpr void clear() noexcept {
+        m_maps.clear();
+        m_materials.clear();
+    }
+
+    /// Insert a number of material maps
+    /// @note Not defined! There is no grid iterator implementation
+    template <typename... Args>
+    DETRAY_HOST_DEVICE constexpr void insert(Args&&...) noexcept {
+        /*Not defined*/
+    }
+
+    /// @returns the indexed material map with index @param i
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> map_t { return m_maps[i]; }
+
+    /// @returns the material table - const
+    DETRAY_HOST_DEVICE
+    constexpr auto materials() const -> const material_container_type& {
+        return m_materials;
+    }
+
+    /// @returns the material slab that corresponds to the bin entry
+    /// @param entry of an indexed material map in this collection
+    DETRAY_HOST_DEVICE
+    constexpr auto slab(const entry_type& entry) const
+        -> indexed_material_slab<scalar_type> {
+        assert(entry.index() < m_materials.size());
+        return {m_materials[entry.index()], entry.thickness()};
+    }
+
+    /// @returns a vecmem view on the collection data - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_maps),
+                         detray::get_data(m_materials)};
+    }
+
+    /// @returns a vecmem view on the collection data - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_maps),
+                               detray::get_data(m_materials)};
+    }
+
+    /// Add a new material map @param gr to the collection.
+    ///
+    /// The material slabs of the map are split into the material, which is
+    /// added to the material table if it is not known yet, and the thickness.
+    DETRAY_HOST auto push_back(const slab_map_type& gr) noexcept(false)
+        -> void {
+
+        using indexed_map_t = typename map_t::template type<true>;
+        using axes_t = typename indexed_map_t::axes_type;
+        using bin_t = typename indexed_map_t::bin_type;
+
+        typename indexed_map_t::bin_container_type bin_data{};
+        bin_data.reserve(gr.nbins());
+
+        for (const auto& bin : gr.bins()) {
+            const material_slab<scalar_type>& mat_slab = *bin;
+
+            bin_t idx_bin{};
+            idx_bin.init(entry_type{intern(mat_slab.get_material()),
+                                    mat_slab.thickness()});
+            bin_data.push_back(idx_bin);
+        }
+
+        // The axes of the owning map are the same for both bin types
+        const auto& edge_offsets = gr.axes().bin_edge_offsets();
+        const auto& bin_edges = gr.axes().bin_edges();
+
+        dvector<dindex_range> axes_data(edge_offsets.begin(),
+                                        edge_offsets.end());
+        dvector<scalar_type> edges(bin_edges.begin(), bin_edges.end());
+
+        m_maps.push_back(indexed_map_t(
+            std::move(bin_data),
+            axes_t(std::move(axes_data), std::move(edges))));
+    }
+
+    private:
+    /// @returns the index of the material @param mat in the material table,
+    /// after adding it, if it was not known yet
+    DETRAY_HOST dindex intern(const material_type& mat) {
+        for (dindex i = 0u; i < m_materials.size(); ++i) {
+            if (m_materials[i] == mat) {
+                return i;
+            }
+        }
+        m_materials.push_back(mat);
+
+        return static_cast<dindex>(m_materials.size() - 1u);
+    }
+
+    /// The indexed material maps
+    map_collection_type m_maps{};
+    /// Table of the distinct materials in all maps
+    material_container_type m_materials{};
+};
+
+namespace detail {
+
+template <class material_t>
+struct is_indexed_material_map<
+    material_t,
+    std::enable_if_t<
+        is_grid_v<material_t> &&
+            std::is_same_v<typename material_t::value_type,
+                           material_index_slab<
+                               typename material_t::value_type::scalar_type>>,
+        void>> : public std::true_type {};
+
+// Indexed material maps are material maps as well
+template <class material_t>
+struct is_material_map<
+    material_t, std::enable_if_t<is_indexed_material_map_v<material_t>, void>>
+    : public std::true_type {};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,378 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+
+// System include(s)
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+
+namespace detray {
+
+/// @brief Tabulated material interactions for a single particle hypothesis.
+///
+/// The mean energy loss (Bethe-Bloch), its derivative with respect to q/p,
+/// the width of the energy loss distribution (Landau) and the momentum
+/// dependent part of the multiple scattering angle (Highland/Rossi-Greisen)
+/// are evaluated once per material on a regular grid in log(p). A lookup
+/// then reduces to one logarithm and a linear interpolation between two
+/// nodes, instead of evaluating the relativistic quantities, the density
+/// effect and several logarithms on every call.
+///
+/// The relative interpolation error for the default binning is below 1e-3
+/// for muons between 100 MeV and 100 GeV. Outside of the tabulated momentum
+/// range, the analytic expressions in @c interaction are used.
+///
+/// @tparam scalar_t the scalar type
+/// @tparam vector_t the vector type of the underlying storage
+template <typename scalar_t, template <typename...> class vector_t = dvector>
+class interaction_table {
+
+    public:
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_t>;
+    using interaction_type = interaction<scalar_t>;
+    using relativistic_quantities =
+        detail::relativistic_quantities<scalar_type>;
+
+    /// Values per node in the material tables
+    enum material_column : unsigned int {
+        e_stopping_power = 0u,
+        e_derivative_stopping_power = 1u,
+        e_landau_sigma_qop = 2u,
+        e_n_material_columns = 3u,
+    };
+
+    /// Values per node in the multiple scattering table (material
+    /// independent)
+    enum scattering_column : unsigned int {
+        e_inv_p_beta = 0u,
+        e_log_q2_over_beta2 = 1u,
+        e_n_scattering_columns = 2u,
+    };
+
+    /// Default binning
+    static constexpr scalar_type default_p_min{50.f * unit<scalar_type>::MeV};
+    static constexpr scalar_type default_p_max{100.f * unit<scalar_type>::GeV};
+    static constexpr dindex default_n_nodes{512u};
+
+    /// Empty table
+    interaction_table() = default;
+
+    /// Build an (empty) table for a particle hypothesis
+    ///
+    /// @param pdg the pdg code of the particle
+    /// @param mass the particle mass
+    /// @param q the particle charge
+    /// @param p_min lower end of the tabulated momentum range
+    /// @param p_max upper end of the tabulated momentum range
+    /// @param n_nodes number of nodes in log(p)
+    DETRAY_HOST
+    interaction_table(const int pdg, const scalar_type mass,
+                      const scalar_type q,
+                      const scalar_type p_min = default_p_min,
+                      const scalar_type p_max = default_p_max,
+                      const dindex n_nodes = default_n_nodes)
+        : m_pdg{pdg},
+          m_mass{mass},
+          m_charge{math::fabs(q)},
+          m_n_nodes{n_nodes},
+          m_log_p_min{math::log(p_min)} {
+
+        if (q == 0.f) {
+            throw std::invalid_argument(
+                "Interaction table: Neutral particles do not interact");
+        }
+        if (!(0.f < p_min && p_min < p_max) || n_nodes < 2u) {
+            throw std::invalid_argument(
+                "Interaction table: Invalid momentum binning");
+        }
+
+        const scalar_type step{(math::log(p_max) - m_log_p_min) /
+                               static_cast<scalar_type>(m_n_nodes - 1u)};
+        m_inv_step = 1.f / step;
+        m_log_p_max =
+            m_log_p_min + static_cast<scalar_type>(m_n_nodes - 1u) * step;
+
+        // The multiple scattering terms only depend on the particle
+        m_scattering_data.reserve(m_n_nodes * e_n_scattering_columns);
+        for (dindex i = 0u; i < m_n_nodes; ++i) {
+            const relativistic_quantities rq(m_mass, node_qop(i), m_charge);
+
+            m_scattering_data.push_back(math::sqrt(rq.m_q2OverBeta2) /
+                                        node_p(i));
+            m_scattering_data.push_back(math::log(rq.m_q2OverBeta2));
+        }
+    }
+
+    /// @returns the pdg code of the particle hypothesis
+    DETRAY_HOST_DEVICE
+    constexpr int pdg() const { return m_pdg; }
+
+    /// @returns the mass of the particle hypothesis
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type mass() const { return m_mass; }
+
+    /// @returns the (absolute) charge of the particle hypothesis
+    DETRAY_HOST_DEVICE
+    constexpr scalar_type charge() const { return m_charge; }
+
+    /// @returns true if the table was built for the particle hypothesis
+    /// with pdg code @param pdg, mass @param mass and charge @param q
+    DETRAY_HOST_DEVICE
+    bool matches(const int pdg, const scalar_type mass,
+                 const scalar_type q) const {
+        // Allow for rounding in the unit conversions of the mass
+        constexpr scalar_type tol{
+            10.f * std::numeric_limits<scalar_type>::epsilon()};
+
+        return (pdg == m_pdg) && (math::fabs(mass - m_mass) <= tol * m_mass) &&
+               (math::fabs(q) == m_charge);
+    }
+
+    /// @returns the number of nodes in log(p)
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_nodes() const { return m_n_nodes; }
+
+    /// @returns the number of tabulated materials
+    DETRAY_HOST_DEVICE
+    constexpr dindex n_materials() const {
+        return static_cast<dindex>(m_materials.size());
+    }
+
+    /// @returns the tabulated material with index @param mat_idx
+    DETRAY_HOST_DEVICE
+    constexpr const material_type& get_material(const dindex mat_idx) const {
+        return m_materials[mat_idx];
+    }
+
+    /// Tabulate the interactions in the material @param mat
+    ///
+    /// @returns the index of the material in the table
+    DETRAY_HOST
+    dindex add_material(const material_type& mat) {
+
+        if (const dindex idx{find(mat)}; idx != dindex_invalid) {
+            return idx;
+        }
+
+        const interaction_type I{};
+        m_materials.push_back(mat);
+        m_data.reserve(m_data.size() + m_n_nodes * e_n_material_columns);
+
+        for (dindex i = 0u; i < m_n_nodes; ++i) {
+            const scalar_type qop{node_qop(i)};
+            const relativistic_quantities rq(m_mass, qop, m_charge);
+
+            const scalar_type bethe{I.compute_bethe_bloch(mat, m_pdg, rq)};
+            m_data.push_back(bethe);
+            m_data.push_back(I.derive_bethe_bloch(mat, m_pdg, rq, bethe));
+            m_data.push_back(I.compute_energy_loss_landau_sigma_QOverP(
+                1.f, mat, m_pdg, m_mass, qop, m_charge));
+        }
+
+        return static_cast<dindex>(m_materials.size() - 1u);
+    }
+
+    /// @returns the index of the material @param mat in the table or
+    /// dindex_invalid, if it was not tabulated
+    DETRAY_HOST_DEVICE
+    dindex find(const material_type& mat) const {
+        for (dindex i = 0u; i < m_materials.size(); ++i) {
+            if (m_materials[i] == mat) {
+                return i;
+            }
+        }
+        return dindex_invalid;
+    }
+
+    /// @returns the stopping power (Bethe-Bloch) in the material with index
+    /// @param mat_idx for the track with @param qop
+    DETRAY_HOST_DEVICE
+    scalar_type stopping_power(const dindex mat_idx,
+                               const scalar_type qop) const {
+        const node_pos pos{locate(qop)};
+        if (!pos.inside) {
+            const relativistic_quantities rq(m_mass, qop, m_charge);
+            return interaction_type{}.compute_bethe_bloch(
+                get_material(mat_idx), m_pdg, rq);
+        }
+        return interpolate(mat_idx, e_stopping_power, pos);
+    }
+
+    /// @returns the derivative of the stopping power with respect to q/p
+    /// in the material with index @param mat_idx for the track with
+    /// @param qop
+    DETRAY_HOST_DEVICE
+    scalar_type derive_stopping_power(const dindex mat_idx,
+                                      const scalar_type qop) const {
+        const node_pos pos{locate(qop)};
+        if (!pos.inside) {
+            const relativistic_quantities rq(m_mass, qop, m_charge);
+            const interaction_type I{};
+            const auto& mat = get_material(mat_idx);
+            return I.derive_bethe_bloch(mat, m_pdg, rq,
+                                        I.compute_bethe_bloch(mat, m_pdg, rq));
+        }
+        // Tabulated for positive q/p (the derivative is odd in q/p)
+        const scalar_type dsdqop{
+            interpolate(mat_idx, e_derivative_stopping_power, pos)};
+        return (qop < 0.f) ? -dsdqop : dsdqop;
+    }
+
+    /// @returns the mean energy loss along @param path_segment in the
+    /// material with index @param mat_idx for the track with @param qop
+    DETRAY_HOST_DEVICE
+    scalar_type compute_energy_loss_bethe_bloch(
+        const scalar_type path_segment, const dindex mat_idx,
+        const scalar_type qop) const {
+        return path_segment * stopping_power(mat_idx, qop);
+    }
+
+    /// @returns the q/p uncertainty due to the energy loss fluctuations
+    /// along @param path_segment in the material with index @param mat_idx
+    /// for the track with @param qop
+    DETRAY_HOST_DEVICE
+    scalar_type compute_energy_loss_landau_sigma_QOverP(
+        const scalar_type path_segment, const dindex mat_idx,
+        const scalar_type qop) const {
+        const node_pos pos{locate(qop)};
+        if (!pos.inside) {
+            return interaction_type{}.compute_energy_loss_landau_sigma_QOverP(
+                path_segment, get_material(mat_idx), m_pdg, m_mass, qop,
+                m_charge);
+        }
+        // The width is proportional to the path length
+        return path_segment * interpolate(mat_idx, e_landau_sigma_qop, pos);
+    }
+
+    /// @returns the projected multiple scattering angle for the track with
+    /// @param qop in a material of thickness @param xOverX0
+    DETRAY_HOST_DEVICE
+    scalar_type compute_multiple_scattering_theta0(
+        const scalar_type xOverX0, const scalar_type qop) const {
+        const node_pos pos{locate(qop)};
+        if (!pos.inside) {
+            return interaction_type{}.compute_multiple_scattering_theta0(
+                xOverX0, m_pdg, m_mass, qop, m_charge);
+        }
+        if (xOverX0 <= 0.f) {
+            return 0.f;
+        }
+
+        // 1/p * q/beta
+        const scalar_type inv_p_beta{
+            interpolate_scattering(e_inv_p_beta, pos)};
+        const scalar_type sqrt_x{math::sqrt(xOverX0)};
+
+        if ((m_pdg == pdg_particle::eElectron) or
+            (m_pdg == pdg_particle::ePositron)) {
+            return 17.5f * unit<scalar_type>::MeV * inv_p_beta * sqrt_x *
+                   (1.0f + 0.125f * math::log10(10.0f * xOverX0));
+        } else {
+            // log((x/X0) * (q²/beta²)), see interaction::theta0Highland
+            const scalar_type log_term{
+                math::log(xOverX0) +
+                interpolate_scattering(e_log_q2_over_beta2, pos)};
+            return 13.6f * unit<scalar_type>::MeV * inv_p_beta * sqrt_x *
+                   (1.0f + 0.038f * log_term);
+        }
+    }
+
+    private:
+    /// Position of a momentum in the node grid
+    struct node_pos {
+        dindex i{0u};
+        scalar_type t{0.f};
+        bool inside{false};
+    };
+
+    /// @returns the momentum of the node @param i
+    DETRAY_HOST scalar_type node_p(const dindex i) const {
+        return math::exp(m_log_p_min +
+                         static_cast<scalar_type>(i) / m_inv_step);
+    }
+
+    /// @returns the (positive) q/p of the node @param i
+    DETRAY_HOST scalar_type node_qop(const dindex i) const {
+        return m_charge / node_p(i);
+    }
+
+    /// @returns the lower node and the interpolation weight for @param qop
+    DETRAY_HOST_DEVICE
+    node_pos locate(const scalar_type qop) const {
+        const scalar_type log_p{math::log(math::fabs(m_charge / qop))};
+        if (!(m_log_p_min <= log_p && log_p <= m_log_p_max)) {
+            return {};
+        }
+
+        const scalar_type f{(log_p - m_log_p_min) * m_inv_step};
+        const dindex i{math::min(static_cast<dindex>(f), m_n_nodes - 2u)};
+
+        return {i, f - static_cast<scalar_type>(i), true};
+    }
+
+    /// @returns the linear interpolation of @param col in the material table
+    /// of @param mat_idx at @param pos
+    DETRAY_HOST_DEVICE
+    scalar_type interpolate(const dindex mat_idx, const material_column col,
+                            const node_pos& pos) const {
+        assert(mat_idx < m_materials.size());
+        const dindex offset{(mat_idx * m_n_nodes + pos.i) *
+                                e_n_material_columns +
+                            col};
+        const scalar_type v0{m_data[offset]};
+        const scalar_type v1{m_data[offset + e_n_material_columns]};
+
+        return v0 + pos.t * (v1 - v0);
+    }
+
+    /// @returns the linear interpolation of @param col in the multiple
+    /// scattering table at @param pos
+    DETRAY_HOST_DEVICE
+    scalar_type interpolate_scattering(const scattering_column col,
+                                       const node_pos& pos) const {
+        const dindex offset{pos.i * e_n_scattering_columns + col};
+        const scalar_type v0{m_scattering_data[offset]};
+        const scalar_type v1{
+            m_scattering_data[offset + e_n_scattering_columns]};
+
+        return v0 + pos.t * (v1 - v0);
+    }
+
+    /// Particle hypothesis
+    int m_pdg{pdg_particle::eMuon};
+    scalar_type m_mass{105.7f * unit<scalar_type>::MeV};
+    scalar_type m_charge{1.f};
+
+    /// Binning in log(p)
+    dindex m_n_nodes{0u};
+    scalar_type m_log_p_min{0.f};
+    scalar_type m_log_p_max{0.f};
+    scalar_type m_inv_step{0.f};
+
+    /// Tabulated materials
+    vector_t<material_type> m_materials{};
+    /// Interpolation nodes per material (node major)
+    vector_t<scalar_type> m_data{};
+    /// Interpolation nodes of the multiple scattering terms
+    vector_t<scalar_type> m_scattering_data{};
+};
+
+}  // namespace detray
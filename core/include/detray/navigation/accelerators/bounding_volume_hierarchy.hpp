@@ -0,0 +1,528 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Detray include(s).
+#include "detray/core/detail/container_buffers.hpp"
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/shapes/cuboid3D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/utils/bounding_volume.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace detray {
+
+/// @brief Node of a bounding volume hierarchy.
+///
+/// The nodes of a hierarchy are stored depth-first in a flat container: The
+/// first child of an inner node directly follows its parent, the index of the
+/// second child is stored in the node.
+template <typename scalar_t>
+struct bvh_node {
+
+    /// Axis aligned bounding box in global coordinates
+    using box_type = axis_aligned_bounding_volume<cuboid3D, scalar_t>;
+
+    /// Box that contains all surfaces below this node
+    box_type box{};
+    /// Leaf: index of the first surface, inner node: index of second child
+    dindex index{0u};
+    /// Number of surfaces in a leaf (zero for inner nodes)
+    dindex n_surfaces{0u};
+
+    /// @returns whether the node holds surfaces
+    DETRAY_HOST_DEVICE
+    constexpr bool is_leaf() const { return n_surfaces > 0u; }
+};
+
+namespace detail {
+
+/// @brief Range of the surfaces in a bounding volume hierarchy, whose leaf
+/// boxes are intersected by a ray.
+///
+/// The boxes are grown by a tolerance before they are tested, so that no
+/// surface is missed that the navigator would accept within its mask
+/// tolerance.
+///
+/// The hierarchy is traversed lazily while iterating, so that no buffer is
+/// needed for the results.
+///
+/// @tparam bvh_t the bounding volume hierarchy
+/// @tparam algebra_t the algebra type of the ray
+template <typename bvh_t, typename algebra_t>
+class bvh_search_range {
+
+    using ray_type = detail::ray<algebra_t>;
+    using scalar_type = typename bvh_t::scalar_type;
+
+    public:
+    /// Single pass iterator that performs the traversal
+    class iterator {
+
+        public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = typename bvh_t::value_type;
+        using pointer = const value_type *;
+        using reference = const value_type &;
+        using iterator_category = std::input_iterator_tag;
+
+        /// Default constructor builds the end iterator
+        constexpr iterator() = default;
+
+        /// Start the traversal of the hierarchy @param bvh at the root
+        DETRAY_HOST_DEVICE
+        iterator(const bvh_t &bvh, const ray_type &ray, const scalar_type tol)
+            : m_bvh{&bvh}, m_ray{ray}, m_tol{tol} {
+            if (bvh.n_nodes() > 0u) {
+                m_stack[m_top++] = 0u;
+            }
+            next_leaf();
+        }
+
+        /// @returns the current surface
+        DETRAY_HOST_DEVICE
+        constexpr reference operator*() const { return m_bvh->surface(m_sf); }
+
+        /// @returns pointer to the current surface
+        DETRAY_HOST_DEVICE
+        constexpr pointer operator->() const { return &(m_bvh->surface(m_sf)); }
+
+        /// Advance to the next surface in an intersected leaf
+        DETRAY_HOST_DEVICE
+        constexpr iterator &operator++() {
+            if (++m_sf == m_sf_end) {
+                next_leaf();
+            }
+            return *this;
+        }
+
+        /// @returns true if both iterators are at the same traversal position
+        DETRAY_HOST_DEVICE
+        constexpr bool operator==(const iterator &rhs) const {
+            return (m_top == rhs.m_top) && (m_sf == rhs.m_sf) &&
+                   (m_sf_end == rhs.m_sf_end);
+        }
+
+        /// @returns true if the iterators are at different positions
+        DETRAY_HOST_DEVICE
+        constexpr bool operator!=(const iterator &rhs) const {
+            return !(*this == rhs);
+        }
+
+        private:
+        /// Traverse the hierarchy until the next leaf is hit by the ray
+        DETRAY_HOST_DEVICE
+        constexpr void next_leaf() {
+            m_sf = 0u;
+            m_sf_end = 0u;
+
+            while (m_top > 0u) {
+                const dindex node_idx{m_stack[--m_top]};
+                const auto &node = m_bvh->node(node_idx);
+
+                if (!node.box.intersect(m_ray, m_tol)) {
+                    continue;
+                }
+                if (node.is_leaf()) {
+                    m_sf = node.index;
+                    m_sf_end = node.index + node.n_surfaces;
+                    return;
+                }
+                // Visit the first child next
+                assert(m_top + 2u <= bvh_t::max_depth);
+                m_stack[m_top++] = node.index;
+                m_stack[m_top++] = node_idx + 1u;
+            }
+        }
+
+        /// The hierarchy
+        const bvh_t *m_bvh{nullptr};
+        /// The ray that is tested against the boxes
+        ray_type m_ray{};
+        /// Tolerance by which the boxes are grown
+        scalar_type m_tol{0.f};
+        /// Nodes that still need to be tested
+        darray<dindex, bvh_t::max_depth> m_stack;
+        /// Number of nodes on the stack
+        dindex m_top{0u};
+        /// Current surface and end of surface range in the current leaf
+        dindex m_sf{0u};
+        dindex m_sf_end{0u};
+    };
+
+    /// Construct from the hierarchy @param bvh, the @param ray and the
+    /// tolerance @param tol by which the boxes are grown
+    DETRAY_HOST_DEVICE
+    constexpr bvh_search_range(const bvh_t &bvh, const ray_type &ray,
+                               const scalar_type tol)
+        : m_bvh{&bvh}, m_ray{ray}, m_tol{tol} {}
+
+    /// @returns an iterator that starts the traversal
+    DETRAY_HOST_DEVICE
+    auto begin() const -> iterator { return iterator{*m_bvh, m_ray, m_tol}; }
+
+    /// @returns the end of the traversal
+    DETRAY_HOST_DEVICE
+    constexpr auto end() const -> iterator { return iterator{}; }
+
+    private:
+    const bvh_t *m_bvh;
+    ray_type m_ray;
+    scalar_type m_tol;
+};
+
+}  // namespace detail
+
+/// @brief A collection of bounding volume hierarchies, callable by index.
+///
+/// Every hierarchy holds the surfaces of a volume in its leafs and is
+/// searched by testing the track ray against the axis aligned bounding boxes
+/// of the nodes. This class fulfills all criteria to be used in the detector
+/// @c multi_store .
+///
+/// @tparam value_t the entry type in the collection (e.g. surface descriptors).
+/// @tparam container_t the types of underlying containers to be used.
+/// @tparam scalar_t the scalar type of the bounding boxes.
+template <class value_t, typename container_t = host_container_types,
+          typename scalar_t = scalar>
+class bvh_collection {
+
+    public:
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+    using size_type = dindex;
+    using node_type = bvh_node<scalar_t>;
+    using box_type = typename node_type::box_type;
+
+    /// A single bounding volume hierarchy (of one volume). This type will be
+    /// returned when the collection is queried for a particular volume.
+    class bvh {
+
+        using node_range_t =
+            detray::ranges::subrange<const vector_type<node_type>>;
+        using surface_range_t =
+            detray::ranges::subrange<const vector_type<value_t>>;
+
+        public:
+        using value_type = value_t;
+        using scalar_type = scalar_t;
+
+        /// Maximal depth of a hierarchy that can be traversed
+        static constexpr dindex max_depth{64u};
+
+        /// Default constructor
+        bvh() = default;
+
+        /// Constructor from the node and surface containers
+        DETRAY_HOST_DEVICE constexpr bvh(const vector_type<node_type> &nodes,
+                                         const dindex_range &node_range,
+                                         const vector_type<value_t> &surfaces,
+                                         const dindex_range &sf_range)
+            : m_nodes(nodes, node_range), m_surfaces(surfaces, sf_range) {}
+
+        /// @returns the surfaces in the leafs that are hit by the @param ray,
+        /// when the boxes are grown by @param tol
+        template <typename algebra_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detail::ray<algebra_t> &ray,
+            const scalar_t tol =
+                std::numeric_limits<scalar_t>::epsilon()) const {
+            return detail::bvh_search_range<bvh, algebra_t>{*this, ray, tol};
+        }
+
+        /// @returns the surfaces in the leafs that are hit by the straight
+        /// line tangential to the @param track. The boxes are grown by the
+        /// maximal mask tolerance of the navigation config @param cfg
+        template <typename detector_t, typename track_t, typename config_t>
+        DETRAY_HOST_DEVICE constexpr auto search(
+            const detector_t & /*det*/,
+            const typename detector_t::volume_type & /*volume*/,
+            const track_t &track, [[maybe_unused]] const config_t &cfg) const {
+            using algebra_t = typename detector_t::algebra_type;
+
+            scalar_t tol{std::numeric_limits<scalar_t>::epsilon()};
+            if constexpr (detail::has_max_mask_tolerance_v<config_t>) {
+                tol = static_cast<scalar_t>(cfg.max_mask_tolerance);
+            }
+
+            return search(detail::ray<algebra_t>(track), tol);
+        }
+
+        /// @returns the node at a given index @param i
+        DETRAY_HOST_DEVICE constexpr const node_type &node(
+            const dindex i) const {
+            return m_nodes[i];
+        }
+
+        /// @returns the number of nodes in the hierarchy
+        DETRAY_HOST_DEVICE constexpr dindex n_nodes() const {
+            return static_cast<dindex>(m_nodes.size());
+        }
+
+        /// @returns the surface at a given index @param i
+        DETRAY_HOST_DEVICE constexpr const value_t &surface(
+            const dindex i) const {
+            return m_surfaces[i];
+        }
+
+        /// @returns the surface at a given index @param i - const
+        DETRAY_HOST_DEVICE constexpr value_t at(const dindex i) const {
+            return m_surfaces[i];
+        }
+
+        /// @returns an iterator over all surfaces in the data structure
+        DETRAY_HOST_DEVICE constexpr auto all() const { return m_surfaces; }
+
+        /// @return the maximum number of surface candidates during a
+        /// neighborhood lookup
+        DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const
+            -> unsigned int {
+            return static_cast<unsigned int>(m_surfaces.size());
+        }
+
+        private:
+        /// The nodes of this hierarchy
+        node_range_t m_nodes{};
+        /// The surfaces, ordered by leaf
+        surface_range_t m_surfaces{};
+    };
+
+    using value_type = bvh;
+
+    using view_type =
+        dmulti_view<dvector_view<size_type>, dvector_view<size_type>,
+                    dvector_view<node_type>, dvector_view<value_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const size_type>,
+                    dvector_view<const size_type>,
+                    dvector_view<const node_type>, dvector_view<const value_t>>;
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<size_type>, dvector_buffer<size_type>,
+                      dvector_buffer<node_type>, dvector_buffer<value_t>>;
+
+    /// Default constructor
+    constexpr bvh_collection() {
+        // Start of first subranges
+        m_node_offsets.push_back(0u);
+        m_sf_offsets.push_back(0u);
+    };
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource *resource)
+        : m_node_offsets(resource),
+          m_sf_offsets(resource),
+          m_nodes(resource),
+          m_surfaces(resource) {
+        // Start of first subranges
+        m_node_offsets.push_back(0u);
+        m_sf_offsets.push_back(0u);
+    }
+
+    /// Constructor from memory resource
+    DETRAY_HOST
+    explicit constexpr bvh_collection(vecmem::memory_resource &resource)
+        : bvh_collection(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename coll_view_t,
+              typename std::enable_if_t<detail::is_device_view_v<coll_view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE bvh_collection(coll_view_t &view)
+        : m_node_offsets(detail::get<0>(view.m_view)),
+          m_sf_offsets(detail::get<1>(view.m_view)),
+          m_nodes(detail::get<2>(view.m_view)),
+          m_surfaces(detail::get<3>(view.m_view)) {}
+
+    /// @returns number of hierarchies (at most one per volume) - const
+    DETRAY_HOST_DEVICE
+    constexpr auto size() const noexcept -> size_type {
+        // The start index of the first range is always present
+        return static_cast<dindex>(m_node_offsets.size()) - 1u;
+    }
+
+    /// @note outside of navigation, the number of elements is unknown
+    DETRAY_HOST_DEVICE
+    constexpr auto empty() const noexcept -> bool {
+        return size() == size_type{0};
+    }
+
+    /// @return access to the surface container - const.
+    DETRAY_HOST_DEVICE
+    auto all() const -> const vector_type<value_t> & { return m_surfaces; }
+
+    /// @return access to the surface container - non-const.
+    DETRAY_HOST_DEVICE
+    auto all() -> vector_type<value_t> & { return m_surfaces; }
+
+    /// @return access to the node container - const.
+    DETRAY_HOST_DEVICE
+    auto nodes() const -> const vector_type<node_type> & { return m_nodes; }
+
+    /// Create a bounding volume hierarchy from the containers - const
+    DETRAY_HOST_DEVICE
+    auto operator[](const size_type i) const -> value_type {
+        return {m_nodes,
+                dindex_range{m_node_offsets[i], m_node_offsets[i + 1u]},
+                m_surfaces,
+                dindex_range{m_sf_offsets[i], m_sf_offsets[i + 1u]}};
+    }
+
+    /// Build a new hierarchy over the @param surfaces
+    ///
+    /// The nodes are split at the median of the box centers along the axis
+    /// of largest extent, until at most @param max_leaf_size surfaces remain.
+    ///
+    /// @param boxes the global bounding boxes of the surfaces
+    template <typename sf_container_t, typename box_container_t>
+    DETRAY_HOST auto push_back(const sf_container_t &surfaces,
+                               const box_container_t &boxes,
+                               const dindex max_leaf_size = 4u) noexcept(false)
+        -> void {
+        assert(surfaces.size() == boxes.size());
+        assert(max_leaf_size > 0u);
+
+        const auto n_surfaces{static_cast<dindex>(surfaces.size())};
+
+        if (n_surfaces > 0u) {
+            // Order in which the surfaces are placed in the leafs
+            std::vector<dindex> order(n_surfaces);
+            std::iota(order.begin(), order.end(), 0u);
+
+            m_nodes.reserve(m_nodes.size() + 2u * n_surfaces);
+            build_node(boxes, order, 0u, n_surfaces, 0u,
+                       static_cast<dindex>(m_nodes.size()), max_leaf_size);
+
+            m_surfaces.reserve(m_surfaces.size() + n_surfaces);
+            for (const dindex i : order) {
+                m_surfaces.push_back(surfaces[i]);
+            }
+        }
+
+        // End of this range is the start of the next range
+        m_node_offsets.push_back(static_cast<dindex>(m_nodes.size()));
+        m_sf_offsets.push_back(static_cast<dindex>(m_surfaces.size()));
+    }
+
+    /// @return the view on the hierarchies - non-const
+    DETRAY_HOST
+    constexpr auto get_data() noexcept -> view_type {
+        return view_type{detray::get_data(m_node_offsets),
+                         detray::get_data(m_sf_offsets),
+                         detray::get_data(m_nodes),
+                         detray::get_data(m_surfaces)};
+    }
+
+    /// @return the view on the hierarchies - const
+    DETRAY_HOST
+    constexpr auto get_data() const noexcept -> const_view_type {
+        return const_view_type{
+            detray::get_data(m_node_offsets), detray::get_data(m_sf_offsets),
+            detray::get_data(m_nodes), detray::get_data(m_surfaces)};
+    }
+
+    private:
+    /// Recursively build the nodes for the surfaces in [first, last) of the
+    /// @param order
+    ///
+    /// @returns the index of the new node relative to @param node_offset
+    template <typename box_container_t>
+    DETRAY_HOST dindex build_node(const box_container_t &boxes,
+                                  std::vector<dindex> &order,
+                                  const dindex first, const dindex last,
+                                  const dindex depth, const dindex node_offset,
+                                  const dindex max_leaf_size) {
+        using center_t = darray<scalar_t, 3>;
+
+        const auto node_idx{static_cast<dindex>(m_nodes.size())};
+        m_nodes.emplace_back();
+
+        // Find the extent of the boxes and their centers
+        constexpr scalar_t inv{detail::invalid_value<scalar_t>()};
+        center_t box_min{inv, inv, inv};
+        center_t box_max{-inv, -inv, -inv};
+        center_t c_min{inv, inv, inv};
+        center_t c_max{-inv, -inv, -inv};
+        for (dindex i = first; i < last; ++i) {
+            const auto &box = boxes[order[i]];
+            const auto c = box.template center<center_t>();
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                box_min[j] = math::min(box_min[j], box[j]);
+                box_max[j] = math::max(box_max[j], box[j + 3u]);
+                c_min[j] = math::min(c_min[j], c[j]);
+                c_max[j] = math::max(c_max[j], c[j]);
+            }
+        }
+        m_nodes[node_idx].box =
+            box_type{0u,         box_min[0], box_min[1], box_min[2],
+                     box_max[0], box_max[1], box_max[2]};
+
+        // Make a leaf (keep space on the traversal stack for the siblings)
+        const dindex n{last - first};
+        if (n <= max_leaf_size || depth + 2u >= bvh::max_depth) {
+            m_nodes[node_idx].index = first;
+            m_nodes[node_idx].n_surfaces = n;
+
+            return node_idx - node_offset;
+        }
+
+        // Split at the median along the axis of largest extent
+        unsigned int axis{0u};
+        for (unsigned int j = 1u; j < 3u; ++j) {
+            if ((c_max[j] - c_min[j]) > (c_max[axis] - c_min[axis])) {
+                axis = j;
+            }
+        }
+        const dindex mid{first + n / 2u};
+        std::nth_element(order.begin() + first, order.begin() + mid,
+                         order.begin() + last,
+                         [&boxes, axis](const dindex a, const dindex b) {
+                             return boxes[a].template center<center_t>()[axis] <
+                                    boxes[b].template center<center_t>()[axis];
+                         });
+
+        // The first child directly follows its parent
+        build_node(boxes, order, first, mid, depth + 1u, node_offset,
+                   max_leaf_size);
+        const dindex second{build_node(boxes, order, mid, last, depth + 1u,
+                                       node_offset, max_leaf_size)};
+        m_nodes[node_idx].index = second;
+
+        return node_idx - node_offset;
+    }
+
+    /// Offsets for the respective volumes into the node storage
+    vector_type<size_type> m_node_offsets{};
+    /// Offsets for the respective volumes into the surface storage
+    vector_type<size_type> m_sf_offsets{};
+    /// The nodes of all hierarchies
+    vector_type<node_type> m_nodes{};
+    /// The storage for all surface handles
+    vector_type<value_t> m_surfaces{};
+};
+
+}  // namespace detray
@@ -35,7 +35,7 @@ struct cuboid_intersector {
     template <typename algebra_t, typename mask_t>
     DETRAY_HOST_DEVICE bool operator()(
         const detail::ray<algebra_t> &ray, const mask_t &box,
-        const dscalar<algebra_t> /*mask_tolerance*/ = 0.f) const {
+        const dscalar<algebra_t> mask_tolerance = 0.f) const {
 
         using scalar_type = dscalar<algebra_t>;
         using point3_type = dpoint3D<algebra_t>;
@@ -51,12 +51,13 @@ struct cuboid_intersector {
                                    rd[2] == 0.f ? inv : 1.f / rd[2]};
 
         // This is prob. slow -> @todo refactor masks to hold custom mask values
-        const vector3_type min{box[boundaries::e_min_x],
-                               box[boundaries::e_min_y],
-                               box[boundaries::e_min_z]};
-        const vector3_type max{box[boundaries::e_max_x],
-                               box[boundaries::e_max_y],
-                               box[boundaries::e_max_z]};
+        // The box is grown by the mask tolerance on every side
+        const vector3_type min{box[boundaries::e_min_x] - mask_tolerance,
+                               box[boundaries::e_min_y] - mask_tolerance,
+                               box[boundaries::e_min_z] - mask_tolerance};
+        const vector3_type max{box[boundaries::e_max_x] + mask_tolerance,
+                               box[boundaries::e_max_y] + mask_tolerance,
+                               box[boundaries::e_max_z] + mask_tolerance};
         /// @TODO: Try to avoid copies ?
         // const auto* min = new (box.values().data()) point3_type ();
         // const auto* max = new (box.values().data() + 3) point3_type ();
@@ -75,7 +76,7 @@ struct cuboid_intersector {
         const bool t_comp = t1[0] > t2[0];
         scalar_type tmin{t_comp ? t2[0] : t1[0]}, tmax{t_comp ? t1[0] : t2[0]};
 
-        for (unsigned int i{0u}; i < 2u; ++i) {
+        for (unsigned int i{1u}; i < 3u; ++i) {
             if (t1[i] > t2[i]) {
                 tmin = t2[i] < tmin ? tmin : t2[i];
                 tmax = t1[i] > tmax ? tmax : t1[i];
@@ -0,0 +1,186 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/geometry/tracking_surface.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/utils/invalid_values.hpp"
+
+// System include(s)
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+namespace detray {
+
+/// @brief Slim record of a surface candidate in the navigation cache.
+///
+/// Keeps only what the navigator needs to sort the candidates and to switch
+/// volumes: The surface descriptor is looked up in the detector by barcode
+/// and the local position is not stored, but recomputed on the current
+/// surface when needed (see @c navigator::state::local()). Can be used as
+/// the intersection type of the navigator in place of @c intersection2D.
+///
+/// @tparam surface_descr_t is the type of surface descriptor
+template <typename surface_descr_t, typename algebra_t>
+struct navigation_candidate {
+
+    using T = typename algebra_t::value_type;
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using nav_link_t = typename surface_descr_t::navigation_link;
+    /// Full intersection record the candidate is made from
+    using intersection_type = intersection2D<surface_descr_t, algebra_t>;
+
+    /// Status bits
+    enum flags : std::uint8_t {
+        e_inside = 1u << 0u,
+        e_along = 1u << 1u,
+    };
+
+    /// Barcode of the surface this candidate belongs to
+    geometry::barcode barcode{};
+
+    /// Distance between track and candidate
+    scalar_type path = detail::invalid_value<T>();
+
+    /// Navigation information (next volume to go to)
+    nav_link_t volume_link{detail::invalid_value<nav_link_t>()};
+
+    /// Result of the intersection and direction with respect to the track
+    std::uint8_t status_bits{e_along};
+
+    /// Default constructor
+    constexpr navigation_candidate() = default;
+
+    /// Construct from a full intersection @param sfi (implicit, so that the
+    /// intersection kernels can fill a candidate cache directly)
+    DETRAY_HOST_DEVICE
+    constexpr navigation_candidate(const intersection_type &sfi)  // NOLINT
+        : barcode{sfi.sf_desc.barcode()},
+          path{sfi.path},
+          volume_link{sfi.volume_link},
+          status_bits{static_cast<std::uint8_t>(
+              (sfi.status ? e_inside : 0u) | (sfi.direction ? e_along : 0u))} {
+    }
+
+    /// @returns the result of the intersection (true = inside)
+    DETRAY_HOST_DEVICE
+    constexpr bool status() const { return (status_bits & e_inside) != 0u; }
+
+    /// @returns the direction of the intersection with respect to the track
+    /// (true = along, false = opposite)
+    DETRAY_HOST_DEVICE
+    constexpr bool direction() const { return (status_bits & e_along) != 0u; }
+
+    /// @param rhs is the right hand side candidate for comparison
+    DETRAY_HOST_DEVICE
+    bool operator<(const navigation_candidate &rhs) const {
+        return (math::fabs(path) < math::fabs(rhs.path));
+    }
+
+    /// @param rhs is the left hand side candidate for comparison
+    DETRAY_HOST_DEVICE
+    bool operator>(const navigation_candidate &rhs) const {
+        return (math::fabs(path) > math::fabs(rhs.path));
+    }
+
+    /// @param rhs is the left hand side candidate for comparison
+    DETRAY_HOST_DEVICE
+    bool operator==(const navigation_candidate &rhs) const {
+        return math::fabs(path - rhs.path) <
+               std::numeric_limits<float>::epsilon();
+    }
+
+    DETRAY_HOST_DEVICE
+    constexpr bool is_inside() const { return status(); }
+
+    /// Transform to a string for output debugging
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &out_stream,
+                                    const navigation_candidate &c) {
+        out_stream << "dist:" << c.path << "\tsurface: " << c.barcode
+                   << ", links to vol:" << c.volume_link << ")"
+                   << (c.status() ? ", status: inside" : ", status: outside")
+                   << (c.direction() ? ", status: along"
+                                     : ", status: opposite")
+                   << std::endl;
+        return out_stream;
+    }
+};
+
+namespace detail {
+
+/// @returns the barcode of the surface that belongs to the intersection
+/// @param sfi
+template <typename intersection_t>
+DETRAY_HOST_DEVICE constexpr auto candidate_barcode(const intersection_t &sfi)
+    -> geometry::barcode {
+    return sfi.sf_desc.barcode();
+}
+
+/// @returns the barcode of the surface that belongs to the slim candidate
+/// @param c
+template <typename surface_descr_t, typename algebra_t>
+DETRAY_HOST_DEVICE constexpr auto candidate_barcode(
+    const navigation_candidate<surface_descr_t, algebra_t> &c)
+    -> geometry::barcode {
+    return c.barcode;
+}
+
+/// @returns the descriptor of the surface that belongs to the intersection
+/// @param sfi
+template <typename detector_t, typename intersection_t>
+DETRAY_HOST_DEVICE constexpr decltype(auto) candidate_surface(
+    const detector_t & /*det*/, const intersection_t &sfi) {
+    return (sfi.sf_desc);
+}
+
+/// @returns the descriptor of the surface that belongs to the slim candidate
+/// @param c, as found in the detector @param det
+template <typename detector_t, typename surface_descr_t, typename algebra_t>
+DETRAY_HOST_DEVICE constexpr decltype(auto) candidate_surface(
+    const detector_t &det,
+    const navigation_candidate<surface_descr_t, algebra_t> &c) {
+    return det.surface(c.barcode);
+}
+
+/// @returns the global position of the intersection @param sfi, computed
+/// from its local position on the surface in @param det
+template <typename detector_t, typename intersection_t, typename point3_t,
+          typename vector3_t>
+DETRAY_HOST_DEVICE constexpr auto candidate_position(
+    const detector_t &det, const typename detector_t::geometry_context &ctx,
+    const intersection_t &sfi, const point3_t & /*track_pos*/,
+    const vector3_t &track_dir) {
+    return tracking_surface{det, candidate_surface(det, sfi)}.local_to_global(
+        ctx, sfi.local, track_dir);
+}
+
+/// @returns the global position of the slim candidate @param c: The local
+/// position is not stored, but the candidate lies on the tangent of the track
+/// at @param track_pos along @param track_dir
+template <typename detector_t, typename surface_descr_t, typename algebra_t,
+          typename point3_t, typename vector3_t>
+DETRAY_HOST_DEVICE constexpr auto candidate_position(
+    const detector_t & /*det*/,
+    const typename detector_t::geometry_context & /*ctx*/,
+    const navigation_candidate<surface_descr_t, algebra_t> &c,
+    const point3_t &track_pos, const vector3_t &track_dir) {
+    return point3_t{track_pos + c.path * track_dir};
+}
+
+}  // namespace detail
+
+}  // namespace detray
@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
@@ -70,10 +71,9 @@ struct intersection_initialize {
     }
 
     private:
-    template <typename is_container_t>
+    template <typename intersection_t, typename is_container_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
-        const typename is_container_t::value_type &sfi,
-        is_container_t &intersections) const {
+        const intersection_t &sfi, is_container_t &intersections) const {
 
         if (sfi.status) {
             assert(intersections.size() < intersections.capacity() &&
@@ -83,9 +83,9 @@ struct intersection_initialize {
         return sfi.status;
     }
 
-    template <typename is_container_t>
+    template <typename intersection_t, typename is_container_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
-        std::array<typename is_container_t::value_type, 2> &&solutions,
+        std::array<intersection_t, 2> &&solutions,
         is_container_t &intersections) const {
         bool is_valid = false;
         for (auto &sfi : solutions) {
@@ -100,6 +100,52 @@ struct intersection_initialize {
     }
 };
 
+/// A functor to add all valid intersections between the trajectory and a
+/// batch of surfaces that share the same mask type
+template <template <typename, typename> class intersector_t>
+struct intersection_initialize_batch {
+
+    /// Operator function to initalize intersections for a batch of surfaces
+    ///
+    /// @tparam mask_group_t is the mask group of the surfaces in the batch
+    /// @tparam surface_t is the input surface type
+    ///
+    /// @param mask_group is the input mask group
+    /// @param surfaces points to the surfaces in the batch
+    /// @param n_surfaces is the number of surfaces in the batch
+    /// @param is_container is the intersection container to be filled
+    /// @param traj is the input trajectory
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size (not applied to
+    ///                       portals)
+    /// @param overstep_tol negative cutoff for the path
+    template <typename mask_group_t, typename surface_t,
+              typename is_container_t, typename traj_t,
+              typename transform_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const surface_t *surfaces,
+        const dindex n_surfaces, is_container_t &is_container,
+        const traj_t &traj, const transform_container_t &contextual_transforms,
+        const std::array<scalar_t, 2u> &mask_tolerance =
+            {0.f, 1.f * unit<scalar_t>::mm},
+        const scalar_t mask_tol_scalor = 0.f,
+        const scalar_t overstep_tol = 0.f) const {
+
+        constexpr intersection_initialize<intersector_t> init_kernel{};
+
+        // The mask type is resolved only once for all surfaces in the batch
+        for (dindex i = 0u; i < n_surfaces; ++i) {
+            const surface_t &sf = surfaces[i];
+
+            init_kernel(mask_group, sf.mask().index(), is_container, traj, sf,
+                        contextual_transforms,
+                        sf.is_portal() ? std::array<scalar_t, 2>{0.f, 0.f}
+                                       : mask_tolerance,
+                        mask_tol_scalor, overstep_tol);
+        }
+    }
+};
+
 /// A functor to update the closest intersection between the trajectory and
 /// surface
 template <template <typename, typename> class intersector_t>
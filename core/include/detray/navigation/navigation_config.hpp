@@ -13,6 +13,7 @@
 #include "detray/definitions/units.hpp"
 
 // System include(s)
+#include <cstdint>
 #include <ostream>
 
 namespace detray::navigation {
@@ -25,6 +26,12 @@ enum class trust_level {
     e_full = 4   ///< don't update anything
 };
 
+/// How the grid based acceleration structures are searched
+enum class grid_search : std::uint_least8_t {
+    e_window = 0,    ///< all bins in the search window around the track
+    e_ray_march = 1  ///< bins crossed by the track up to the next portal
+};
+
 /// Navigation configuration
 struct config {
     /// Tolerance on the mask 'is_inside' check:
@@ -43,6 +50,20 @@ struct config {
     /// Search window size for grid based acceleration structures
     /// (0, 0): only look at current bin
     std::array<dindex, 2> search_window = {0u, 0u};
+    /// How to search the grid based acceleration structures
+    grid_search grid_search_mode{grid_search::e_window};
+    /// Return surfaces that span multiple bins of the search window only once
+    /// (always the case in ray marching mode)
+    bool unique_grid_search{false};
+    /// Maximal path length along which the grids are searched in ray marching
+    /// mode (is limited to the distance to the next portal during navigation)
+    float search_distance{1.f * unit<float>::m};
+    /// Number of nearest candidates that are kept sorted, the remaining
+    /// candidates are sorted on demand (0: sort all candidates)
+    unsigned int n_sorted_candidates{0u};
+    /// Repair the order of the previously sorted candidates on a 'fair trust'
+    /// update, instead of sorting them from scratch
+    bool incremental_sort{true};
 };
 
 /// Print the navigation configuration
@@ -59,7 +80,18 @@ inline std::ostream& operator<<(std::ostream& out,
         << "  Overstep tolerance    : "
         << cfg.overstep_tolerance / detray::unit<float>::um << " [um]\n"
         << "  Search window         : " << cfg.search_window[0] << " x "
-        << cfg.search_window[1] << "\n";
+        << cfg.search_window[1] << "\n"
+        << "  Grid search mode      : "
+        << (cfg.grid_search_mode == grid_search::e_ray_march ? "ray march"
+                                                             : "window")
+        << "\n"
+        << "  Search distance       : "
+        << cfg.search_distance / detray::unit<float>::mm << " [mm]\n"
+        << std::boolalpha
+        << "  Unique grid search    : " << cfg.unique_grid_search << "\n"
+        << "  No. sorted candidates : " << cfg.n_sorted_candidates << "\n"
+        << "  Incremental sort      : " << cfg.incremental_sort << "\n"
+        << std::noboolalpha;
 
     return out;
 }
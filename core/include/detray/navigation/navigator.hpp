@@ -22,15 +22,21 @@
 #include "detray/geometry/barcode.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/navigation_candidate.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
 #include "detray/navigation/intersection_kernel.hpp"
 #include "detray/navigation/navigation_config.hpp"
+#include "detray/navigation/soa_intersection_kernel.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/sort.hpp"
 
 // vecmem include(s)
 #include <vecmem/containers/data/jagged_vector_buffer.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s)
+#include <type_traits>
+
 namespace detray {
 
 namespace navigation {
@@ -104,10 +110,14 @@ struct void_inspector {
 /// @tparam detector_t the detector to navigate
 /// @tparam inspector_t is a validation inspector that can record information
 ///         about the navigation state at different points of the nav. flow.
+/// @tparam simd_algebra_t SoA algebra that is used to intersect the surfaces
+///         of the same mask type in SIMD vectors during the local navigation
+///         (void: intersect the surfaces one by one)
 template <
     typename detector_t, typename inspector_t = navigation::void_inspector,
     typename intersection_t = intersection2D<typename detector_t::surface_type,
-                                             typename detector_t::algebra_type>>
+                                             typename detector_t::algebra_type>,
+    typename simd_algebra_t = void>
 class navigator {
 
     public:
@@ -121,8 +131,27 @@ class navigator {
     using vector_type = typename detector_t::template vector_type<T>;
     using intersection_type = intersection_t;
     using nav_link_type = typename detector_t::surface_type::navigation_link;
+    /// SoA mirror of the surfaces, from which the batches can be intersected
+    /// (only with an SoA algebra)
+    using soa_store_type = soa_surface_store<detector_t, simd_algebra_t>;
 
     private:
+    using surface_type = typename detector_t::surface_type;
+    using mask_id = typename detector_t::masks::id;
+    /// Intersection record that is filled by the intersectors
+    using full_intersection_type =
+        intersection2D<surface_type, typename detector_t::algebra_type>;
+
+    /// Maximal number of surfaces that are gathered before they are
+    /// intersected in batches of the same mask type
+    static constexpr dindex max_batch_size{32u};
+
+    /// Intersects a batch of surfaces with the same mask type
+    using batch_kernel_type =
+        std::conditional_t<std::is_void_v<simd_algebra_t>,
+                           intersection_initialize_batch<ray_intersector>,
+                           soa_intersection_initialize_batch<simd_algebra_t>>;
+
     /// A functor that fills the navigation candidates vector by intersecting
     /// the surfaces in the volume neighborhood
     struct candidate_search {
@@ -147,6 +176,93 @@ class navigator {
         }
     };
 
+    /// Neighborhood surfaces that wait to be intersected
+    struct surface_batch {
+        darray<surface_type, max_batch_size> surfaces{};
+        dindex size{0u};
+    };
+
+    /// Orders the surfaces in a batch by their mask type
+    struct mask_id_less {
+        DETRAY_HOST_DEVICE constexpr bool operator()(
+            const surface_type &lhs, const surface_type &rhs) const {
+            return lhs.mask().id() < rhs.mask().id();
+        }
+    };
+
+    /// A functor that gathers the surfaces in the volume neighborhood and
+    /// fills the navigation candidates once a batch of surfaces is complete
+    struct candidate_batch_search {
+
+        template <typename track_t>
+        DETRAY_HOST_DEVICE void operator()(
+            const surface_type &sf_descr, surface_batch &batch,
+            const detector_type &det, const soa_store_type *soa_store,
+            const track_t &track, vector_type<intersection_type> &candidates,
+            const std::array<scalar_type, 2> mask_tol,
+            const scalar_type mask_tol_scalor,
+            const scalar_type overstep_tol) const {
+
+            batch.surfaces[batch.size++] = sf_descr;
+
+            if (batch.size == max_batch_size) {
+                intersect_batch(batch, det, soa_store, track, candidates,
+                                mask_tol, mask_tol_scalor, overstep_tol);
+            }
+        }
+    };
+
+    /// Intersect the surfaces in @param batch grouped by their mask type and
+    /// add the valid intersections to the @param candidates. Every mask type
+    /// is dispatched only once and its surfaces are handled in a tight loop.
+    /// If an SoA mirror @param soa_store of the detector is given, the packed
+    /// surfaces are taken from there. Empties the batch.
+    template <typename track_t>
+    DETRAY_HOST_DEVICE static inline void intersect_batch(
+        surface_batch &batch, const detector_type &det,
+        [[maybe_unused]] const soa_store_type *soa_store, const track_t &track,
+        vector_type<intersection_type> &candidates,
+        const std::array<scalar_type, 2> mask_tol,
+        const scalar_type mask_tol_scalor, const scalar_type overstep_tol) {
+
+        const auto first = batch.surfaces.begin();
+        detray::shift_insertion_sort(first, first + batch.size,
+                                     mask_id_less{});
+
+        const auto ray = detail::ray(track);
+
+        dindex begin{0u};
+        while (begin < batch.size) {
+            const mask_id id{batch.surfaces[begin].mask().id()};
+
+            dindex end{begin + 1u};
+            while (end < batch.size && batch.surfaces[end].mask().id() == id) {
+                ++end;
+            }
+
+            if constexpr (!std::is_void_v<simd_algebra_t>) {
+                if (soa_store != nullptr) {
+                    det.mask_store().template visit<batch_kernel_type>(
+                        id, batch.surfaces.data() + begin, end - begin,
+                        *soa_store, candidates, ray, det.transform_store(),
+                        mask_tol, mask_tol_scalor, overstep_tol);
+
+                    begin = end;
+                    continue;
+                }
+            }
+
+            det.mask_store().template visit<batch_kernel_type>(
+                id, batch.surfaces.data() + begin, end - begin, candidates,
+                ray, det.transform_store(), mask_tol, mask_tol_scalor,
+                overstep_tol);
+
+            begin = end;
+        }
+
+        batch.size = 0u;
+    }
+
     public:
     /// @brief A navigation state object used to cache the information of the
     /// current navigation stream.
@@ -189,7 +305,7 @@ class navigator {
         /// Constructor from candidates vector
         DETRAY_HOST_DEVICE state(const detector_type &det,
                                  vector_type<intersection_type> candidates)
-            : m_detector(&det), m_candidates(candidates) {}
+            : m_detector(&det), m_candidates(std::move(candidates)) {}
 
         /// Constructor from candidates vector_view
         template <
@@ -225,6 +341,19 @@ class navigator {
         DETRAY_HOST_DEVICE
         auto detector() const { return m_detector; }
 
+        /// @returns a pointer to the SoA mirror of the detector (can be null)
+        DETRAY_HOST_DEVICE
+        auto soa_store() const -> const soa_store_type * {
+            return m_soa_store;
+        }
+
+        /// Intersect the surfaces with the packed masks and placements of the
+        /// SoA mirror @param store, which has to outlive the navigation state
+        DETRAY_HOST_DEVICE
+        void set_soa_store(const soa_store_type &store) {
+            m_soa_store = &store;
+        }
+
         /// Scalar representation of the navigation state,
         /// @returns distance to next
         DETRAY_HOST_DEVICE
@@ -237,6 +366,15 @@ class navigator {
             return m_candidates;
         }
 
+        /// Hand the candidate cache back to the caller, so that its memory
+        /// can be recycled for the next track. Leaves the state empty.
+        DETRAY_HOST
+        inline auto release_candidates() -> vector_type<intersection_type> {
+            vector_type<intersection_type> candidates{std::move(m_candidates)};
+            clear();
+            return candidates;
+        }
+
         /// @returns numer of currently cached (reachable) candidates - const
         DETRAY_HOST_DEVICE
         inline auto n_candidates() const ->
@@ -276,14 +414,14 @@ class navigator {
         /// (invalid when not on surface) - const
         DETRAY_HOST_DEVICE
         inline auto barcode() const -> geometry::barcode {
-            return current()->sf_desc.barcode();
+            return detail::candidate_barcode(*current());
         }
 
         /// @returns the next surface the navigator intends to reach
         DETRAY_HOST_DEVICE
         inline auto next_surface() const {
-            return tracking_surface<detector_type>{*m_detector,
-                                                   m_next->sf_desc.barcode()};
+            return tracking_surface<detector_type>{
+                *m_detector, detail::candidate_barcode(*m_next)};
         }
 
         /// @returns current detector surface the navigator is on
@@ -294,6 +432,18 @@ class navigator {
             return tracking_surface<detector_type>{*m_detector, barcode()};
         }
 
+        /// @returns the local position of the track @param track on the
+        /// current detector surface (recomputed, since the candidate cache
+        /// does not need to keep the local positions)
+        template <typename track_t>
+        DETRAY_HOST_DEVICE inline auto local(
+            const track_t &track,
+            const typename detector_type::geometry_context &ctx = {}) const
+            -> point3_type {
+            return get_surface().global_to_local(ctx, track.pos(),
+                                                 track.dir());
+        }
+
         /// @returns current navigation status - const
         DETRAY_HOST_DEVICE
         inline auto status() const -> navigation::status { return m_status; }
@@ -369,8 +519,9 @@ class navigator {
         DETRAY_HOST_DEVICE
         inline auto encountered_sf_material() const -> bool {
             return (is_on_module() || is_on_portal()) &&
-                   (current()->sf_desc.material().id() !=
-                    detector_t::materials::id::e_none);
+                   (detail::candidate_surface(*m_detector, *current())
+                        .material()
+                        .id() != detector_t::materials::id::e_none);
         }
 
         /// Helper method to check if a kernel is exhausted - const
@@ -451,6 +602,7 @@ class navigator {
             m_candidates.clear();
             m_next = m_candidates.end();
             m_last = m_candidates.end();
+            m_sorted_end = m_candidates.end();
         }
 
         /// Call the navigation inspector
@@ -472,6 +624,9 @@ class navigator {
         /// Detector pointer
         const detector_type *const m_detector;
 
+        /// SoA mirror of the detector surfaces (optional)
+        const soa_store_type *m_soa_store{nullptr};
+
         /// Our cache of candidates (intersections with any kind of surface)
         vector_type<intersection_type> m_candidates = {};
 
@@ -481,6 +636,9 @@ class navigator {
         /// The last reachable candidate
         candidate_itr_t m_last = m_candidates.end();
 
+        /// End of the range of candidates that are sorted
+        candidate_itr_t m_sorted_end = m_candidates.end();
+
         /// The inspector type of this navigation engine
         inspector_type m_inspector;
 
@@ -522,21 +680,38 @@ class navigator {
         navigation.clear();
         navigation.m_heartbeat = true;
         // Get the max number of candidates & run them through the kernel
-        // detail::call_reserve(navigation.candidates(), volume.n_objects());
+        // (no allocation, if the buffer was already sized for the detector)
         // @TODO: switch to fixed size buffer
-        detail::call_reserve(navigation.candidates(), 20u);
+        detail::call_reserve(navigation.candidates(),
+                             volume.n_max_candidates());
 
         // Search for neighboring surfaces and fill candidates into cache
-        volume.template visit_neighborhood<candidate_search>(
-            track, cfg, *det, track, navigation.candidates(),
-            std::array<scalar_type, 2u>{cfg.min_mask_tolerance,
-                                        cfg.max_mask_tolerance},
-            static_cast<scalar_type>(cfg.mask_tolerance_scalor),
-            static_cast<scalar_type>(cfg.overstep_tolerance));
+        if (cfg.grid_search_mode == navigation::grid_search::e_ray_march) {
+            march_neighborhood(volume, track, navigation.candidates(), cfg);
+        } else {
+            const std::array<scalar_type, 2u> mask_tol{cfg.min_mask_tolerance,
+                                                       cfg.max_mask_tolerance};
+            const auto mask_tol_scalor{
+                static_cast<scalar_type>(cfg.mask_tolerance_scalor)};
+            const auto overstep_tol{
+                static_cast<scalar_type>(cfg.overstep_tolerance)};
+
+            // Gather the surfaces and intersect them grouped by mask type
+            surface_batch batch{};
+            volume.template visit_neighborhood<candidate_batch_search>(
+                track, cfg, batch, *det, navigation.soa_store(), track,
+                navigation.candidates(), mask_tol, mask_tol_scalor,
+                overstep_tol);
+
+            // Intersect the remaining surfaces
+            intersect_batch(batch, *det, navigation.soa_store(), track,
+                            navigation.candidates(), mask_tol,
+                            mask_tol_scalor, overstep_tol);
+        }
 
-        // Sort all candidates and pick the closest one
-        detail::sequential_sort(navigation.candidates().begin(),
-                                navigation.candidates().end());
+        // Sort the (nearest) candidates and pick the closest one
+        sort_candidates(navigation, navigation.candidates().begin(),
+                        navigation.candidates().end(), cfg, false);
 
         navigation.set_next(navigation.candidates().begin());
         // No unreachable candidates in cache after local navigation
@@ -687,18 +862,31 @@ class navigator {
         // - do this when your navigation state is stale, but not invalid
         if (navigation.trust_level() == navigation::trust_level::e_fair) {
 
-            for (auto &candidate : navigation) {
+            // Move the unreachable candidates behind the reachable ones, but
+            // keep the order of the latter: The previous order is usually
+            // still (almost) correct after a step
+            const auto first = navigation.begin();
+            auto last_reachable = first;
+            for (auto itr = first; itr != navigation.end(); ++itr) {
                 // Disregard this candidate if it is not reachable
-                if (not update_candidate(candidate, track, det, cfg)) {
+                if (not update_candidate(*itr, track, det, cfg)) {
                     // Forcefully set dist to numeric max for sorting
-                    candidate.path = std::numeric_limits<scalar_type>::max();
+                    itr->path = std::numeric_limits<scalar_type>::max();
+                    continue;
+                }
+                if (itr != last_reachable) {
+                    const intersection_type tmp = *last_reachable;
+                    *last_reachable = *itr;
+                    *itr = tmp;
                 }
+                ++last_reachable;
             }
-            detail::sequential_sort(navigation.begin(), navigation.end());
+            sort_candidates(navigation, first, last_reachable, cfg,
+                            cfg.incremental_sort);
             // Take the nearest (sorted) candidate first
             navigation.set_next(navigation.begin());
             // Ignore unreachable elements (needed to determine exhaustion)
-            navigation.set_last(find_invalid(navigation.candidates()));
+            navigation.set_last(std::move(last_reachable));
             // Update navigation flow on the new candidate information
             update_navigation_state(cfg, propagation);
 
@@ -745,9 +933,19 @@ class navigator {
             // called once the cache has been updated to a full trust state).
             // Might lead to exhausted cache.
             ++navigation.next();
-            navigation.m_status = (navigation.current()->sf_desc.is_portal())
-                                      ? navigation::status::e_on_portal
-                                      : navigation::status::e_on_module;
+            // Sort the next batch of candidates, if only the nearest ones
+            // were sorted before
+            if (navigation.next() == navigation.m_sorted_end &&
+                !navigation.is_exhausted()) {
+                sort_candidates(navigation, navigation.next(),
+                                navigation.end(), cfg, false);
+            }
+            navigation.m_status =
+                detail::candidate_surface(*navigation.detector(),
+                                          *navigation.current())
+                        .is_portal()
+                    ? navigation::status::e_on_portal
+                    : navigation::status::e_on_module;
 
             stepping._step_size = navigation();
             stepping._initialized = true;
@@ -780,15 +978,40 @@ class navigator {
         intersection_type &candidate, const track_t &track,
         const detector_type *det, const navigation::config &cfg) const {
 
-        if (candidate.sf_desc.barcode().is_invalid()) {
+        if (detail::candidate_barcode(candidate).is_invalid()) {
             return false;
         }
 
-        const auto sf = tracking_surface{*det, candidate.sf_desc};
+        const auto sf = tracking_surface{
+            *det, detail::candidate_surface(*det, candidate)};
+
+        if constexpr (std::is_same_v<intersection_type,
+                                     full_intersection_type>) {
+            return update_intersection(sf, candidate, track, det, cfg);
+        } else {
+            // Slim candidates are updated through a full intersection record
+            full_intersection_type sfi{};
+            sfi.sf_desc = detail::candidate_surface(*det, candidate);
+            const bool is_reachable{
+                update_intersection(sf, sfi, track, det, cfg)};
+            candidate = sfi;
+
+            return is_reachable;
+        }
+    }
+
+    /// Helper method that updates a full intersection @param sfi with the
+    /// surface @param sf
+    ///
+    /// @returns whether the track can reach the surface.
+    template <typename surface_t, typename track_t>
+    DETRAY_HOST_DEVICE inline bool update_intersection(
+        const surface_t &sf, full_intersection_type &sfi, const track_t &track,
+        const detector_type *det, const navigation::config &cfg) const {
 
         // Check whether this candidate is reachable by the track
         return sf.template visit_mask<intersection_update<ray_intersector>>(
-            detail::ray(track), candidate, det->transform_store(),
+            detail::ray(track), sfi, det->transform_store(),
             sf.is_portal() ? std::array<scalar_type, 2>{0.f, 0.f}
                            : std::array<scalar_type, 2>{cfg.min_mask_tolerance,
                                                         cfg.max_mask_tolerance},
@@ -796,37 +1019,117 @@ class navigator {
             static_cast<scalar_type>(cfg.overstep_tolerance));
     }
 
-    /// Helper to evict all unreachable/invalid candidates from the cache:
-    /// Finds the first unreachable candidate (has been invalidated during
-    /// update) in a sorted (!) cache.
+    /// Helper to fill the candidates from the acceleration structures of a
+    /// volume in ray marching mode: The portals are searched first, so that
+    /// the grids only need to be searched up to the exit portal of the volume.
+    ///
+    /// @param volume the current volume
+    /// @param track the track that is marched through the volume
+    /// @param candidates the candidate cache to be filled
+    /// @param cfg the navigation configuration
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void march_neighborhood(
+        const tracking_volume<detector_type> &volume, const track_t &track,
+        vector_type<intersection_type> &candidates,
+        const navigation::config &cfg) const {
+
+        using accel_id = typename volume_type::object_id;
+
+        // Brute force search of the portals
+        auto max_dist{static_cast<scalar_type>(cfg.search_distance)};
+        search_accel<static_cast<int>(accel_id::e_portal)>(
+            volume, track, candidates, cfg, max_dist);
+
+        // The nearest portal ahead of the track is where it leaves the volume
+        for (const auto &candidate : candidates) {
+            if (detail::candidate_surface(volume.detector(), candidate)
+                    .is_portal() &&
+                candidate.path > 0.f) {
+                max_dist = math::min(
+                    max_dist, static_cast<scalar_type>(candidate.path +
+                                                       cfg.path_tolerance));
+            }
+        }
+
+        // Search the remaining acceleration structures up to that distance
+        search_accel<static_cast<int>(accel_id::e_size) - 1, 1>(
+            volume, track, candidates, cfg, max_dist);
+    }
+
+    /// Helper to fill the candidates from the acceleration structures with
+    /// the type ids in the range [@tparam L, @tparam I], where grids are
+    /// searched along the track up to the path length @param max_dist
+    template <int I, int L = I, typename track_t>
+    DETRAY_HOST_DEVICE inline void search_accel(
+        const tracking_volume<detector_type> &volume, const track_t &track,
+        vector_type<intersection_type> &candidates,
+        const navigation::config &cfg, const scalar_type max_dist) const {
+
+        using accel_id = typename volume_type::object_id;
+
+        if constexpr (I >= L) {
+            volume.template visit_accel_along_track<candidate_search,
+                                                    static_cast<accel_id>(I)>(
+                track, cfg, max_dist, volume.detector(), track, candidates,
+                std::array<scalar_type, 2u>{cfg.min_mask_tolerance,
+                                            cfg.max_mask_tolerance},
+                static_cast<scalar_type>(cfg.mask_tolerance_scalor),
+                static_cast<scalar_type>(cfg.overstep_tolerance));
+
+            search_accel<I - 1, L>(volume, track, candidates, cfg, max_dist);
+        }
+    }
+
+    /// Helper to sort the candidates in the range [@param first, @param last)
     ///
-    /// @param candidates the cache of candidates to be cleaned
-    DETRAY_HOST_DEVICE inline auto find_invalid(
-        vector_type<intersection_type> &candidates) const {
-        // Depends on previous invalidation of unreachable candidates!
-        auto not_reachable = [](const intersection_type &candidate) {
-            return candidate.path == std::numeric_limits<scalar_type>::max();
-        };
-
-        return detail::find_if(candidates.begin(), candidates.end(),
-                               not_reachable);
+    /// Only the nearest @c cfg.n_sorted_candidates are sorted, if the range
+    /// is larger than that, the remaining candidates are sorted once they are
+    /// needed (see @c update_navigation_state).
+    ///
+    /// @param navigation the navigation state that holds the candidates
+    /// @param cfg the navigation configuration
+    /// @param is_resort whether the range is (almost) sorted already
+    template <typename candidate_itr_t>
+    DETRAY_HOST_DEVICE inline void sort_candidates(
+        state &navigation, candidate_itr_t first, candidate_itr_t last,
+        const navigation::config &cfg, const bool is_resort) const {
+
+        const auto n_sorted{
+            static_cast<decltype(last - first)>(cfg.n_sorted_candidates)};
+
+        if (n_sorted == 0 || (last - first) <= n_sorted) {
+            if (is_resort) {
+                // Linear time on an (almost) sorted range
+                detail::sequential_resort(first, last);
+            } else {
+                detail::sequential_sort(first, last);
+            }
+            navigation.m_sorted_end = last;
+        } else {
+            detail::sequential_partial_sort(first, first + n_sorted, last);
+            navigation.m_sorted_end = first + n_sorted;
+        }
     }
 };
 
 /// @return the vecmem jagged vector buffer for surface candidates
+///
+/// @tparam intersection_t the candidate type of the navigator, i.e.
+///         @c navigator_t::intersection_type (e.g. slim candidates)
 // TODO: det.get_n_max_objects_per_volume() is way too many for
 // candidates size allocation. With the local navigation, the size can be
 // restricted to much smaller value
-template <typename detector_t>
-DETRAY_HOST vecmem::data::jagged_vector_buffer<intersection2D<
-    typename detector_t::surface_type, typename detector_t::algebra_type>>
+template <typename detector_t,
+          typename intersection_t =
+              intersection2D<typename detector_t::surface_type,
+                             typename detector_t::algebra_type>>
+DETRAY_HOST vecmem::data::jagged_vector_buffer<intersection_t>
 create_candidates_buffer(
     const detector_t &det, const std::size_t n_tracks,
     vecmem::memory_resource &device_resource,
     vecmem::memory_resource *host_access_resource = nullptr) {
     // Build the buffer from capacities, device and host accessible resources
-    return vecmem::data::jagged_vector_buffer<intersection2D<
-        typename detector_t::surface_type, typename detector_t::algebra_type>>(
+    return vecmem::data::jagged_vector_buffer<intersection_t>(
         std::vector<std::size_t>(n_tracks, det.n_max_candidates()),
         device_resource, host_access_resource,
         vecmem::data::buffer_type::resizable);
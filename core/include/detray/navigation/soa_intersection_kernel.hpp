@@ -0,0 +1,341 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/soa_surface_store.hpp"
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/coordinates/cartesian2D.hpp"
+#include "detray/geometry/coordinates/cylindrical2D.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/navigation/intersection/intersection.hpp"
+#include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+
+// System include(s)
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail {
+
+/// Shapes for which a ray can be intersected with the SoA kernels
+template <typename shape_t, typename algebra_t>
+inline constexpr bool has_soa_ray_kernel_v =
+    std::is_same_v<typename shape_t::template local_frame_type<algebra_t>,
+                   cartesian2D<algebra_t>> ||
+    std::is_same_v<typename shape_t::template local_frame_type<algebra_t>,
+                   cylindrical2D<algebra_t>>;
+
+}  // namespace detail
+
+/// @brief A functor to add all valid intersections between a ray and a batch
+/// of surfaces that share the same mask type, using the SoA intersectors.
+///
+/// The surfaces are gathered into SIMD vectors of @tparam simd_algebra_t
+/// (one surface per lane), which are then intersected in one go. Planar
+/// surfaces (e.g. rectangles and trapezoids) and cylinders are supported, all
+/// other shapes fall back to the scalar intersectors.
+template <typename simd_algebra_t>
+struct soa_intersection_initialize_batch {
+
+    using simd_scalar_type = dscalar<simd_algebra_t>;
+
+    /// Number of surfaces per SIMD vector
+    static constexpr dindex width{
+        static_cast<dindex>(simd_scalar_type::size())};
+
+    /// Operator function to initalize intersections for a batch of surfaces
+    ///
+    /// @tparam mask_group_t is the mask group of the surfaces in the batch
+    /// @tparam surface_t is the input surface type
+    ///
+    /// @param mask_group is the input mask group
+    /// @param surfaces points to the surfaces in the batch
+    /// @param n_surfaces is the number of surfaces in the batch
+    /// @param is_container is the intersection container to be filled
+    /// @param ray is the input ray
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size (not applied to
+    ///                       portals)
+    /// @param overstep_tol negative cutoff for the path
+    template <typename mask_group_t, typename surface_t,
+              typename is_container_t, typename ray_t,
+              typename transform_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const surface_t *surfaces,
+        const dindex n_surfaces, is_container_t &is_container,
+        const ray_t &ray, const transform_container_t &contextual_transforms,
+        const std::array<scalar_t, 2u> &mask_tolerance =
+            {0.f, 1.f * unit<scalar_t>::mm},
+        const scalar_t mask_tol_scalor = 0.f,
+        const scalar_t overstep_tol = 0.f) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+        using mask_index_t = typename surface_t::mask_link::index_type;
+
+        // Surfaces with multiple masks or without SoA kernel: scalar loop
+        if constexpr (!std::is_integral_v<mask_index_t> ||
+                      !detail::has_soa_ray_kernel_v<shape_t, simd_algebra_t>) {
+            intersection_initialize_batch<ray_intersector>{}(
+                mask_group, surfaces, n_surfaces, is_container, ray,
+                contextual_transforms, mask_tolerance, mask_tol_scalor,
+                overstep_tol);
+        } else {
+            using soa_mask_t = mask<shape_t, typename mask_t::links_type,
+                                    simd_algebra_t>;
+            using soa_intersector_t = ray_intersector<shape_t, simd_algebra_t>;
+
+            for (dindex first = 0u; first < n_surfaces; first += width) {
+                const dindex n_lanes{math::min(width, n_surfaces - first)};
+
+                // Gather the surface data (the unused lanes are padded with
+                // the last surface, so that they are valid, but never placed)
+                soa_mask_t soa_mask{};
+                detail::soa_placement<simd_algebra_t> placement{};
+                std::array<simd_scalar_type, 2u> soa_tol{};
+
+                for (dindex lane = 0u; lane < width; ++lane) {
+                    const surface_t &sf =
+                        surfaces[first + math::min(lane, n_lanes - 1u)];
+
+                    detail::pack_lane(soa_mask, mask_group[sf.mask().index()],
+                                      lane);
+                    placement.pack_lane(contextual_transforms[sf.transform()],
+                                        lane);
+
+                    soa_tol[0][lane] = sf.is_portal() ? 0.f : mask_tolerance[0];
+                    soa_tol[1][lane] = sf.is_portal() ? 0.f : mask_tolerance[1];
+                }
+
+                const auto sfi = soa_intersector_t{}(
+                    ray, surfaces[first], soa_mask, placement.transform(),
+                    soa_tol,
+                    simd_scalar_type(mask_tol_scalor),
+                    simd_scalar_type(overstep_tol));
+
+                if (!place_lanes(sfi, mask_group, surfaces + first, n_lanes,
+                                 is_container)) {
+                    // A lane could not be intersected, which invalidates the
+                    // whole SIMD vector: redo the lanes one by one
+                    intersection_initialize_batch<ray_intersector>{}(
+                        mask_group, surfaces + first, n_lanes, is_container,
+                        ray, contextual_transforms, mask_tolerance,
+                        mask_tol_scalor, overstep_tol);
+                }
+            }
+        }
+    }
+
+    /// Operator function to initalize intersections for a batch of surfaces,
+    /// for which the packed masks and placements are taken from the SoA
+    /// mirror of the detector.
+    ///
+    /// Every chunk of the mirror that holds a surface of the batch is
+    /// intersected once and only the lanes of the batch surfaces are added to
+    /// the container. Surfaces that are not mirrored are intersected one by
+    /// one. The placements are those of the geometry context that the mirror
+    /// was built with.
+    ///
+    /// @param soa_store is the SoA mirror of the detector
+    /// (see the other overload for the remaining parameters)
+    template <typename mask_group_t, typename surface_t, typename soa_store_t,
+              typename is_container_t, typename ray_t,
+              typename transform_container_t, typename scalar_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const surface_t *surfaces,
+        const dindex n_surfaces, const soa_store_t &soa_store,
+        is_container_t &is_container, const ray_t &ray,
+        const transform_container_t &contextual_transforms,
+        const std::array<scalar_t, 2u> &mask_tolerance,
+        const scalar_t mask_tol_scalor, const scalar_t overstep_tol) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using shape_t = typename mask_t::shape;
+        using mask_index_t = typename surface_t::mask_link::index_type;
+
+        // Not mirrored or no SoA kernel: gather the lanes on the fly
+        if constexpr (!std::is_integral_v<mask_index_t> ||
+                      !detail::has_soa_ray_kernel_v<shape_t, simd_algebra_t>) {
+            (*this)(mask_group, surfaces, n_surfaces, is_container, ray,
+                    contextual_transforms, mask_tolerance, mask_tol_scalor,
+                    overstep_tol);
+        } else {
+            using chunks_t =
+                detail::soa_surface_chunks<mask_t, simd_algebra_t>;
+            using soa_intersector_t = ray_intersector<shape_t, simd_algebra_t>;
+
+            const auto scalar_kernel =
+                intersection_initialize_batch<ray_intersector>{};
+
+            for (dindex i = 0u; i < n_surfaces; ++i) {
+                const auto &link = soa_store.link(surfaces[i].index());
+
+                if (link.is_invalid()) {
+                    scalar_kernel(mask_group, surfaces + i, 1u, is_container,
+                                  ray, contextual_transforms, mask_tolerance,
+                                  mask_tol_scalor, overstep_tol);
+                    continue;
+                }
+                // Chunk was already intersected for a previous surface
+                if (has_chunk(soa_store, surfaces, i, link.chunk)) {
+                    continue;
+                }
+
+                // No mask tolerance for the portals in the chunk
+                std::array<simd_scalar_type, 2u> soa_tol{
+                    simd_scalar_type(mask_tolerance[0]),
+                    simd_scalar_type(mask_tolerance[1])};
+                for (dindex j = i; j < n_surfaces; ++j) {
+                    const auto &lane_link = soa_store.link(surfaces[j].index());
+                    if (lane_link.chunk == link.chunk &&
+                        surfaces[j].is_portal()) {
+                        soa_tol[0][lane_link.lane] = 0.f;
+                        soa_tol[1][lane_link.lane] = 0.f;
+                    }
+                }
+
+                const auto &chunks =
+                    soa_store.template chunks<chunks_t>(link.id);
+                const auto sfi = soa_intersector_t{}(
+                    ray, surfaces[i], chunks.masks[link.chunk],
+                    chunks.transforms[link.chunk], soa_tol,
+                    simd_scalar_type(mask_tol_scalor),
+                    simd_scalar_type(overstep_tol));
+
+                // Only add the lanes that belong to the batch
+                const bool is_valid{is_finite(sfi)};
+                for (dindex j = i; j < n_surfaces; ++j) {
+                    const auto &lane_link = soa_store.link(surfaces[j].index());
+                    if (lane_link.chunk != link.chunk) {
+                        continue;
+                    }
+                    if (is_valid) {
+                        place_lane(sfi, mask_group, surfaces[j],
+                                   lane_link.lane, is_container);
+                    } else {
+                        scalar_kernel(mask_group, surfaces + j, 1u,
+                                      is_container, ray, contextual_transforms,
+                                      mask_tolerance, mask_tol_scalor,
+                                      overstep_tol);
+                    }
+                }
+            }
+        }
+    }
+
+    private:
+    /// @returns true if one of the first @param n surfaces of the batch lies
+    /// in the chunk @param chunk of the SoA mirror @param soa_store
+    template <typename soa_store_t, typename surface_t>
+    DETRAY_HOST_DEVICE inline bool has_chunk(const soa_store_t &soa_store,
+                                             const surface_t *surfaces,
+                                             const dindex n,
+                                             const dindex chunk) const {
+        for (dindex i = 0u; i < n; ++i) {
+            if (soa_store.link(surfaces[i].index()).chunk == chunk) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @returns false if the planar intersection failed for all lanes, due to
+    /// a single lane that is parallel to its surface
+    template <typename soa_intersection_t>
+    DETRAY_HOST_DEVICE inline bool is_finite(
+        const soa_intersection_t &sfi) const {
+        const auto check_sum = sfi.path.sum();
+        return !(std::isnan(check_sum) || std::isinf(check_sum));
+    }
+
+    /// The cylinder solutions are always valid
+    template <typename soa_intersection_t>
+    DETRAY_HOST_DEVICE inline bool is_finite(
+        const std::array<soa_intersection_t, 2> &) const {
+        return true;
+    }
+
+    /// Scatter the valid lanes of the SoA intersection @param sfi into the
+    /// intersection container @param is_container
+    ///
+    /// @returns false if no lane was added, because the intersection is not
+    /// finite
+    template <typename soa_intersection_t, typename mask_group_t,
+              typename surface_t, typename is_container_t>
+    DETRAY_HOST_DEVICE inline bool place_lanes(
+        const soa_intersection_t &sfi, const mask_group_t &mask_group,
+        const surface_t *surfaces, const dindex n_lanes,
+        is_container_t &is_container) const {
+
+        if (!is_finite(sfi)) {
+            return false;
+        }
+
+        for (dindex lane = 0u; lane < n_lanes; ++lane) {
+            place_lane(sfi, mask_group, surfaces[lane], lane, is_container);
+        }
+
+        return true;
+    }
+
+    /// Add the valid lanes of both SoA solutions (e.g. for cylinders)
+    template <typename soa_intersection_t, typename mask_group_t,
+              typename surface_t, typename is_container_t>
+    DETRAY_HOST_DEVICE inline void place_lane(
+        const std::array<soa_intersection_t, 2> &solutions,
+        const mask_group_t &mask_group, const surface_t &sf, const dindex lane,
+        is_container_t &is_container) const {
+
+        for (const auto &sfi : solutions) {
+            place_lane(sfi, mask_group, sf, lane, is_container);
+        }
+    }
+
+    /// Add the intersection in @param lane to the container, if it is valid
+    template <typename soa_intersection_t, typename mask_group_t,
+              typename surface_t, typename is_container_t>
+    DETRAY_HOST_DEVICE inline void place_lane(
+        const soa_intersection_t &sfi, const mask_group_t &mask_group,
+        const surface_t &sf, const dindex lane,
+        is_container_t &is_container) const {
+
+        // The cache may hold slim candidates, which are made from the full
+        // intersection
+        using intersection_t = intersection2D<
+            surface_t, typename is_container_t::value_type::algebra_type>;
+        using point3_t = typename intersection_t::point3_type;
+
+        if (!sfi.status[lane]) {
+            return;
+        }
+
+        intersection_t is{};
+        is.sf_desc = sf;
+        is.path = sfi.path[lane];
+        is.local = point3_t{sfi.local[0][lane], sfi.local[1][lane],
+                            sfi.local[2][lane]};
+        is.volume_link = mask_group[sf.mask().index()].volume_link();
+        is.direction = sfi.direction[lane];
+        is.status = true;
+
+        assert(is_container.size() < is_container.capacity() &&
+               "Navigation cache size too small");
+        is_container.push_back(is);
+    }
+};
+
+}  // namespace detray
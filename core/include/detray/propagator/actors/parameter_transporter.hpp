@@ -33,9 +33,6 @@ struct parameter_transporter : actor {
         using scalar_type = dscalar<algebra_t>;
         // Matrix actor
         using matrix_operator = dmatrix_operator<algebra_t>;
-        // 2D matrix type
-        template <std::size_t ROWS, std::size_t COLS>
-        using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
 
         /// @}
 
@@ -51,10 +48,6 @@ struct parameter_transporter : actor {
             using jacobian_engine_t = detail::jacobian_engine<frame_t>;
 
             using bound_matrix_t = bound_matrix<algebra_t>;
-            using bound_to_free_matrix_t =
-                typename jacobian_engine_t::bound_to_free_matrix_type;
-
-            using free_matrix_t = free_matrix<algebra_t>;
             using free_to_bound_matrix_t =
                 typename jacobian_engine_t::free_to_bound_matrix_type;
 
@@ -68,49 +61,35 @@ struct parameter_transporter : actor {
             stepping._bound_params.set_vector(
                 detail::free_to_bound_vector<frame_t>(trf3, free_vec));
 
-            // Free to bound jacobian at the destination surface
-            const free_to_bound_matrix_t free_to_bound_jacobian =
-                jacobian_engine_t::free_to_bound_jacobian(trf3, free_vec);
-
-            // Transport jacobian in free coordinate
-            free_matrix_t& free_transport_jacobian = stepping._jac_transport;
-
-            // Path correction factor
-            free_matrix_t path_correction = jacobian_engine_t::path_correction(
-                stepping().pos(), stepping().dir(), stepping.dtds(),
-                stepping.dqopds(), trf3);
-
-            const free_matrix_t correction_term =
-                matrix_operator()
-                    .template identity<e_free_size, e_free_size>() +
-                path_correction;
-
+            // The full jacobians are assembled from the free to bound
+            // jacobian at the destination surface, the path correction and
+            // the transport jacobian in free coordinates, exploiting the
+            // structure of the matrices
             bound_matrix_t new_cov =
                 matrix_operator().template zero<e_bound_size, e_bound_size>();
 
             if (propagation.param_type() == parameter_type::e_free) {
 
-                const matrix_type<e_bound_size, e_free_size> full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian;
+                const free_to_bound_matrix_t full_jacobian =
+                    jacobian_engine_t::free_to_bound_transport_jacobian(
+                        trf3, free_vec, stepping.dtds(), stepping.dqopds(),
+                        stepping._jac_transport);
 
-                new_cov = full_jacobian * stepping().covariance() *
-                          matrix_operator().transpose(full_jacobian);
+                new_cov = jacobian_engine_t::template transport_covariance<
+                    e_free_size>(full_jacobian, stepping().covariance());
 
                 propagation.set_param_type(parameter_type::e_bound);
 
             } else if (propagation.param_type() == parameter_type::e_bound) {
-                // Bound to free jacobian at the departure surface
-                const bound_to_free_matrix_t& bound_to_free_jacobian =
-                    stepping._jac_to_global;
-
+                // Includes the bound to free jacobian at the departure surface
                 stepping._full_jacobian =
-                    free_to_bound_jacobian * correction_term *
-                    free_transport_jacobian * bound_to_free_jacobian;
+                    jacobian_engine_t::bound_to_bound_transport_jacobian(
+                        trf3, free_vec, stepping.dtds(), stepping.dqopds(),
+                        stepping._jac_transport, stepping._jac_to_global);
 
-                new_cov = stepping._full_jacobian *
-                          stepping._bound_params.covariance() *
-                          matrix_operator().transpose(stepping._full_jacobian);
+                new_cov = jacobian_engine_t::template transport_covariance<
+                    e_bound_size>(stepping._full_jacobian,
+                                  stepping._bound_params.covariance());
             }
 
             // Calculate surface-to-surface covariance transport
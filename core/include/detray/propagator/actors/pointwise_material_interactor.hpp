@@ -13,6 +13,7 @@
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/materials/detail/material_accessor.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/ranges.hpp"
@@ -50,12 +51,60 @@ struct pointwise_material_interactor : actor {
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
 
+        /// Take the interactions from the tabulated values for the particle
+        /// hypothesis, if the material was tabulated
+        bool use_interaction_table = false;
+        /// Tabulated interactions (only used if the particle hypothesis
+        /// matches)
+        const interaction_table<scalar_type> *mat_table{nullptr};
+
+        /// Material of the last lookup in the interaction table
+        const material<scalar_type> *cached_mat{nullptr};
+        /// Interaction table of the last lookup
+        const interaction_table<scalar_type> *cached_table{nullptr};
+        /// Index of @c cached_mat in @c cached_table
+        dindex cached_table_idx{dindex_invalid};
+
         DETRAY_HOST_DEVICE
         void reset() {
             e_loss = 0.f;
             projected_scattering_angle = 0.f;
             sigma_qop = 0.f;
         }
+
+        /// @returns the index of the material @param mat in the interaction
+        /// table or dindex_invalid, if the table should not be used for a
+        /// particle with charge @param q
+        ///
+        /// The table is only searched when the material changes: Slabs of
+        /// the same (indexed) material map refer to the same material
+        /// instance, while consecutive homogeneous slabs are compared to the
+        /// cached table entry first.
+        DETRAY_HOST_DEVICE
+        dindex interaction_table_index(const material<scalar_type> &mat,
+                                       const scalar_type q) {
+            if (!use_interaction_table || mat_table == nullptr ||
+                !mat_table->matches(pdg, mass, q)) {
+                return dindex_invalid;
+            }
+
+            if (mat_table != cached_table) {
+                cached_table = mat_table;
+                cached_mat = nullptr;
+                cached_table_idx = dindex_invalid;
+            } else if (&mat == cached_mat) {
+                return cached_table_idx;
+            } else if (cached_table_idx != dindex_invalid &&
+                       mat_table->get_material(cached_table_idx) == mat) {
+                cached_mat = &mat;
+                return cached_table_idx;
+            }
+
+            cached_mat = &mat;
+            cached_table_idx = mat_table->find(mat);
+
+            return cached_table_idx;
+        }
     };
 
     /// Material store visitor
@@ -78,7 +127,9 @@ struct pointwise_material_interactor : actor {
             // Filter material types for which to do "pointwise" interactions
             if constexpr (detail::is_surface_material_v<material_t>) {
 
-                const auto mat = detail::material_accessor::get(
+                // Keep the address of the material stable for the table
+                // lookup (indexed slabs refer to the material table)
+                const auto &mat = detail::material_accessor::get(
                     material_group, mat_index, bound_params.bound_local());
 
                 // return early in case of zero thickness
@@ -93,6 +144,33 @@ struct pointwise_material_interactor : actor {
                 const scalar_type path_segment{
                     mat.path_segment(cos_inc_angle, approach)};
 
+                // Look the material up in the interaction table
+                const dindex table_idx{
+                    s.interaction_table_index(mat.get_material(), charge)};
+
+                if (table_idx != dindex_invalid) {
+                    const auto &table = *(s.mat_table);
+
+                    if (s.do_energy_loss) {
+                        s.e_loss = table.compute_energy_loss_bethe_bloch(
+                            path_segment, table_idx, qop);
+                    }
+                    if (s.do_energy_loss && s.do_covariance_transport) {
+                        s.sigma_qop =
+                            table.compute_energy_loss_landau_sigma_QOverP(
+                                path_segment, table_idx, qop);
+                    }
+                    if (s.do_multiple_scattering) {
+                        s.projected_scattering_angle =
+                            table.compute_multiple_scattering_theta0(
+                                mat.path_segment_in_X0(cos_inc_angle,
+                                                       approach),
+                                qop);
+                    }
+
+                    return true;
+                }
+
                 // Energy Loss
                 if (s.do_energy_loss) {
                     s.e_loss =
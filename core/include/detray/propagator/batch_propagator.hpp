@@ -0,0 +1,237 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/state_pool.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/thread_pool.hpp"
+
+// System include(s)
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace propagation {
+
+/// Outcome of the propagation of a single track in a batch
+template <typename algebra_t>
+struct track_result {
+    using scalar_type = dscalar<algebra_t>;
+
+    /// Did the track reach the end of the world?
+    bool success{false};
+    /// Track parameters at the end of the propagation
+    free_track_parameters<algebra_t> params{};
+    /// Signed and absolute path length that was travelled
+    scalar_type path_length{0.f};
+    scalar_type abs_path_length{0.f};
+    /// Final navigation status and volume
+    navigation::status status{navigation::status::e_unknown};
+    dindex volume{dindex_invalid};
+};
+
+/// Throughput statistics of a batch propagation
+struct batch_statistics {
+    /// Number of tracks in the batch
+    std::size_t n_tracks{0u};
+    /// Number of successfully propagated tracks
+    std::size_t n_success{0u};
+    /// Number of threads that were used
+    std::size_t n_threads{0u};
+    /// Wall time of the batch in seconds
+    double wall_time{0.};
+
+    /// @returns the number of processed tracks per second
+    DETRAY_HOST
+    double tracks_per_second() const {
+        return wall_time > 0. ? static_cast<double>(n_tracks) / wall_time
+                              : 0.;
+    }
+
+    /// Print the statistics
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &out,
+                                    const batch_statistics &stats) {
+        out << "  No. tracks            : " << stats.n_tracks << "\n"
+            << "  No. successful        : " << stats.n_success << "\n"
+            << "  No. threads           : " << stats.n_threads << "\n"
+            << "  Wall time [s]         : " << stats.wall_time << "\n"
+            << "  Throughput [tracks/s] : " << stats.tracks_per_second()
+            << "\n";
+        return out;
+    }
+};
+
+/// Per-track results together with the statistics of the batch
+template <typename algebra_t>
+struct batch_result {
+    std::vector<track_result<algebra_t>> tracks{};
+    batch_statistics stats{};
+};
+
+/// Actor state factory for propagators without actors
+struct no_actor_states {
+    DETRAY_HOST
+    auto operator()(std::size_t /*track_idx*/) const { return std::tuple<>{}; }
+};
+
+}  // namespace propagation
+
+/// @brief Propagates a batch of tracks on a host thread pool.
+///
+/// Every worker owns a propagation state pool, whose candidate buffers are
+/// sized once for the detector and recycled from track to track, so that the
+/// navigation cache does not have to be reallocated. The actor states are
+/// created per track by a user supplied factory, which keeps the tracks
+/// independent of each other.
+///
+/// @tparam propagator_t the propagator type that is run for every track
+template <typename propagator_t>
+class batch_propagator {
+
+    using detector_type = typename propagator_t::detector_type;
+    using algebra_type = typename propagator_t::algebra_type;
+    using state_pool_type = state_pool<propagator_t>;
+
+    public:
+    using result_type = propagation::batch_result<algebra_type>;
+
+    /// Configuration of the batch processing
+    struct config {
+        /// Number of threads (zero selects the number of hardware threads)
+        std::size_t n_threads{0u};
+        /// Number of consecutive tracks a thread takes at once
+        std::size_t chunk_size{8u};
+    };
+
+    /// Construct from a propagator @param p and the batch configuration
+    DETRAY_HOST
+    explicit batch_propagator(const propagator_t &p, const config &cfg = {})
+        : m_propagator{p},
+          m_cfg{cfg},
+          m_pool{cfg.n_threads} {}
+
+    /// @returns the number of worker threads
+    DETRAY_HOST
+    std::size_t n_threads() const { return m_pool.size(); }
+
+    /// Propagate all @param tracks through the detector @param det without
+    /// magnetic field.
+    ///
+    /// @param make_actor_states callable that returns a tuple of actor states
+    ///                          for a given track index
+    ///
+    /// @note @param make_actor_states is called concurrently from all threads
+    template <typename track_coll_t,
+              typename factory_t = propagation::no_actor_states>
+    DETRAY_HOST result_type propagate(const detector_type &det,
+                                      const track_coll_t &tracks,
+                                      factory_t &&make_actor_states = {}) {
+        return run([](state_pool_type &states,
+                      const auto &track) { return states.make_state(track); },
+                   det, tracks, make_actor_states);
+    }
+
+    /// Propagate all @param tracks through the detector @param det in the
+    /// magnetic field @param field.
+    ///
+    /// @param make_actor_states callable that returns a tuple of actor states
+    ///                          for a given track index
+    template <typename field_t, typename track_coll_t, typename factory_t>
+    DETRAY_HOST result_type propagate(const detector_type &det,
+                                      const field_t &field,
+                                      const track_coll_t &tracks,
+                                      factory_t &&make_actor_states) {
+        return run(
+            [&field](state_pool_type &states, const auto &track) {
+                return states.make_state(track, field);
+            },
+            det, tracks, make_actor_states);
+    }
+
+    private:
+    /// Run the batch on the thread pool
+    template <typename state_maker_t, typename track_coll_t,
+              typename factory_t>
+    DETRAY_HOST result_type run(state_maker_t &&make_state,
+                                const detector_type &det,
+                                const track_coll_t &tracks,
+                                factory_t &make_actor_states) {
+
+        result_type result{};
+        result.tracks.resize(tracks.size());
+        result.stats.n_tracks = tracks.size();
+        result.stats.n_threads = m_pool.size();
+
+        // Size the per-thread candidate caches once for the detector
+        if (m_states.empty() || &(m_states.front()->detector()) != &det) {
+            m_states.clear();
+            for (std::size_t i = 0u; i < m_pool.size(); ++i) {
+                m_states.push_back(std::make_unique<state_pool_type>(det));
+            }
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        m_pool.parallel_for(
+            tracks.size(), m_cfg.chunk_size,
+            [&](const std::size_t thread_idx, const std::size_t track_idx) {
+                // Returns the candidate buffer to the pool when done
+                auto propagation_handle =
+                    make_state(*m_states[thread_idx], tracks[track_idx]);
+                auto &propagation = *propagation_handle;
+
+                // Owning actor states, handed to the actor chain by reference
+                auto actor_states = make_actor_states(track_idx);
+                auto actor_state_refs = std::apply(
+                    [](auto &...states) { return std::tie(states...); },
+                    actor_states);
+
+                auto &res = result.tracks[track_idx];
+                res.success =
+                    m_propagator.propagate(propagation, actor_state_refs);
+                res.params = propagation._stepping();
+                res.path_length = propagation._stepping.path_length();
+                res.abs_path_length = propagation._stepping._abs_path_length;
+                res.status = propagation._navigation.status();
+                res.volume = propagation._navigation.volume();
+            });
+
+        const std::chrono::duration<double> wall_time{
+            std::chrono::steady_clock::now() - start};
+        result.stats.wall_time = wall_time.count();
+
+        for (const auto &res : result.tracks) {
+            result.stats.n_success += res.success ? 1u : 0u;
+        }
+
+        return result;
+    }
+
+    /// The propagator is shared by all threads (it is stateless)
+    propagator_t m_propagator;
+    /// Batch configuration
+    config m_cfg;
+    /// Thread pool that processes the tracks
+    thread_pool m_pool;
+    /// Propagation state pool per thread
+    std::vector<std::unique_ptr<state_pool_type>> m_states{};
+};
+
+}  // namespace detray
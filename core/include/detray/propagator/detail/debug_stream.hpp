@@ -0,0 +1,72 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace detray::detail {
+
+/// @brief String stream that is only allocated on first use.
+///
+/// Keeps the construction of a propagation state cheap, when no debug output
+/// is requested.
+class debug_stream {
+
+    public:
+    /// Write @param value to the stream (allocates the stream if needed)
+    template <typename T>
+    DETRAY_HOST debug_stream &operator<<(T &&value) {
+        stream() << std::forward<T>(value);
+        return *this;
+    }
+
+    /// Stream manipulators, e.g. std::endl
+    DETRAY_HOST
+    debug_stream &operator<<(std::ostream &(*manip)(std::ostream &)) {
+        manip(stream());
+        return *this;
+    }
+
+    /// Stream manipulators, e.g. std::left
+    DETRAY_HOST
+    debug_stream &operator<<(std::ios_base &(*manip)(std::ios_base &)) {
+        manip(stream());
+        return *this;
+    }
+
+    /// @returns the content of the stream
+    DETRAY_HOST
+    std::string str() const { return m_stream ? m_stream->str() : ""; }
+
+    /// Discard the content of the stream
+    DETRAY_HOST
+    void clear() { m_stream.reset(); }
+
+    private:
+    /// @returns the underlying stream, allocates it if needed
+    DETRAY_HOST
+    std::stringstream &stream() {
+        if (!m_stream) {
+            m_stream = std::make_unique<std::stringstream>();
+        }
+        return *m_stream;
+    }
+
+    std::unique_ptr<std::stringstream> m_stream{nullptr};
+};
+
+}  // namespace detray::detail
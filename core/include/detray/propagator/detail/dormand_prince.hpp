@@ -0,0 +1,62 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+namespace detray::detail {
+
+/// @brief Butcher tableau of the Dormand-Prince 5(4) method.
+///
+/// The last stage is evaluated at the 5th order solution, so that it can be
+/// reused as the first stage of the next step (first-same-as-last).
+///
+/// Reference: J.R. Dormand, P.J. Prince, "A family of embedded Runge-Kutta
+/// formulae", J. Comp. Appl. Math. 6 (1980) 19-26
+template <typename scalar_t>
+struct dormand_prince {
+
+    /// Number of stages
+    static constexpr unsigned int n_stages{7u};
+
+    /// @returns the coefficient a_ij of stage @param i and @param j < i
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t a(const unsigned int i, const unsigned int j) {
+        constexpr scalar_t coeff[n_stages][n_stages - 1u]{
+            {0., 0., 0., 0., 0., 0.},
+            {1. / 5., 0., 0., 0., 0., 0.},
+            {3. / 40., 9. / 40., 0., 0., 0., 0.},
+            {44. / 45., -56. / 15., 32. / 9., 0., 0., 0.},
+            {19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0.,
+             0.},
+            {9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176.,
+             -5103. / 18656., 0.},
+            {35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784.,
+             11. / 84.}};
+        return coeff[i][j];
+    }
+
+    /// @returns the weight of stage @param i in the 5th order solution
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t b(const unsigned int i) {
+        return i < n_stages - 1u ? a(n_stages - 1u, i) : scalar_t{0.};
+    }
+
+    /// @returns the difference between the weights of the 5th and 4th order
+    /// solutions for stage @param i (local error estimate)
+    DETRAY_HOST_DEVICE
+    static constexpr scalar_t e(const unsigned int i) {
+        constexpr scalar_t coeff[n_stages]{
+            71. / 57600.,  0.,          -71. / 16695., 71. / 1920.,
+            -17253. / 339200., 22. / 525., -1. / 40.};
+        return coeff[i];
+    }
+};
+
+}  // namespace detray::detail
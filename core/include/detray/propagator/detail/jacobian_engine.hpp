@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
@@ -20,6 +21,9 @@
 #include "detray/tracks/detail/track_helper.hpp"
 #include "detray/tracks/detail/transform_track_parameters.hpp"
 
+// System include(s).
+#include <cstddef>
+
 namespace detray::detail {
 
 /// @brief Generate Jacobians
@@ -41,6 +45,9 @@ struct jacobian_engine {
 
     // Matrix operator
     using matrix_operator = dmatrix_operator<algebra_type>;
+    // 2D matrix type
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_type, ROWS, COLS>;
     // Track helper
     using track_helper = detail::track_helper<matrix_operator>;
 
@@ -175,6 +182,226 @@ struct jacobian_engine {
 
         return derivative * path_derivative;
     }
+
+    /// @brief Free to bound jacobian including the path correction
+    ///
+    /// Fused version of 'free_to_bound_jacobian * (I + path_correction)':
+    /// The path correction is the outer product of the derivative of the free
+    /// parameters w.r.t. the path length 'd' and the path derivative 'p', so
+    /// the result is 'F2B + (F2B * d) * p'. Only the columns in which 'p' has
+    /// entries are updated.
+    DETRAY_HOST_DEVICE
+    static inline free_to_bound_matrix_type corrected_free_to_bound_jacobian(
+        const transform3_type& trf3, const free_vector<algebra_type>& free_vec,
+        const vector3_type& dtds, const scalar_type dqopds) {
+
+        free_to_bound_matrix_type jac = free_to_bound_jacobian(trf3, free_vec);
+
+        const vector3_type pos = track_helper().pos(free_vec);
+        const vector3_type dir = track_helper().dir(free_vec);
+
+        const free_to_path_matrix_type path_derivative =
+            jacobian_t::path_derivative(trf3, pos, dir, dtds);
+
+        // F2B * d: The local position only depends on the free position and
+        // the angles only on the free direction. The time entry of 'd' is
+        // zero and the q/p row of F2B is a unit vector
+        darray<scalar_type, e_bound_size> jac_times_d{};
+        for (unsigned int i = e_bound_loc0; i <= e_bound_loc1; ++i) {
+            jac_times_d[i] = dot3(jac, i, e_free_pos0, dir);
+        }
+        for (unsigned int i = e_bound_phi; i <= e_bound_theta; ++i) {
+            jac_times_d[i] = dot3(jac, i, e_free_dir0, dtds);
+        }
+        jac_times_d[e_bound_qoverp] = dqopds;
+
+        // Rank-one update (the time row stays a unit vector)
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            if (i == e_bound_time) {
+                continue;
+            }
+            for (unsigned int j = e_free_pos0; j <= e_free_pos2; ++j) {
+                matrix_operator().element(jac, i, j) +=
+                    jac_times_d[i] *
+                    matrix_operator().element(path_derivative, 0u, j);
+            }
+            if constexpr (jacobian_t::is_direction_dependent) {
+                for (unsigned int j = e_free_dir0; j <= e_free_dir2; ++j) {
+                    matrix_operator().element(jac, i, j) +=
+                        jac_times_d[i] *
+                        matrix_operator().element(path_derivative, 0u, j);
+                }
+            }
+        }
+
+        return jac;
+    }
+
+    /// @brief Jacobian from the free parameters at the start of the transport
+    /// to the bound parameters on the destination surface
+    ///
+    /// Fused version of
+    /// 'free_to_bound_jacobian * (I + path_correction) * transport_jacobian'
+    /// that skips the blocks of the corrected free to bound jacobian that are
+    /// known to be zero or unit vectors.
+    DETRAY_HOST_DEVICE
+    static inline free_to_bound_matrix_type free_to_bound_transport_jacobian(
+        const transform3_type& trf3, const free_vector<algebra_type>& free_vec,
+        const vector3_type& dtds, const scalar_type dqopds,
+        const free_matrix<algebra_type>& transport_jacobian) {
+
+        const free_to_bound_matrix_type corr_jac =
+            corrected_free_to_bound_jacobian(trf3, free_vec, dtds, dqopds);
+
+        free_to_bound_matrix_type full_jac =
+            matrix_operator().template zero<e_bound_size, e_free_size>();
+
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            const vector3_type pos_col =
+                column3(transport_jacobian, e_free_pos0, j);
+            const vector3_type dir_col =
+                column3(transport_jacobian, e_free_dir0, j);
+
+            // Local position: Direction entries only from the path correction
+            for (unsigned int i = e_bound_loc0; i <= e_bound_loc1; ++i) {
+                scalar_type val{dot3(corr_jac, i, e_free_pos0, pos_col)};
+                if constexpr (jacobian_t::is_direction_dependent) {
+                    val += dot3(corr_jac, i, e_free_dir0, dir_col);
+                }
+                matrix_operator().element(full_jac, i, j) = val;
+            }
+            // Angles: Position entries from the path correction
+            for (unsigned int i = e_bound_phi; i <= e_bound_theta; ++i) {
+                matrix_operator().element(full_jac, i, j) =
+                    dot3(corr_jac, i, e_free_pos0, pos_col) +
+                    dot3(corr_jac, i, e_free_dir0, dir_col);
+            }
+            // Time: Unit row
+            matrix_operator().element(full_jac, e_bound_time, j) =
+                matrix_operator().element(transport_jacobian, e_free_time, j);
+            // q/p: Unit row plus the path correction
+            scalar_type qop_val{
+                matrix_operator().element(transport_jacobian, e_free_qoverp,
+                                          j) +
+                dot3(corr_jac, e_bound_qoverp, e_free_pos0, pos_col)};
+            if constexpr (jacobian_t::is_direction_dependent) {
+                qop_val += dot3(corr_jac, e_bound_qoverp, e_free_dir0, dir_col);
+            }
+            matrix_operator().element(full_jac, e_bound_qoverp, j) = qop_val;
+        }
+
+        return full_jac;
+    }
+
+    /// @brief Jacobian from the bound parameters on the departure surface to
+    /// the bound parameters on the destination surface
+    ///
+    /// Fused version of 'free_to_bound_jacobian * (I + path_correction) *
+    /// transport_jacobian * bound_to_free_jacobian'. The bound to free
+    /// jacobian belongs to the departure surface, which can have a different
+    /// local frame, so only the blocks that are zero in every frame are
+    /// skipped.
+    DETRAY_HOST_DEVICE
+    static inline bound_matrix<algebra_type> bound_to_bound_transport_jacobian(
+        const transform3_type& trf3, const free_vector<algebra_type>& free_vec,
+        const vector3_type& dtds, const scalar_type dqopds,
+        const free_matrix<algebra_type>& transport_jacobian,
+        const bound_to_free_matrix_type& bound_to_free_jac) {
+
+        const free_to_bound_matrix_type free_jac =
+            free_to_bound_transport_jacobian(trf3, free_vec, dtds, dqopds,
+                                             transport_jacobian);
+
+        bound_matrix<algebra_type> full_jac =
+            matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+        // Local position: Only position entries
+        for (unsigned int j = e_bound_loc0; j <= e_bound_loc1; ++j) {
+            const vector3_type pos_col =
+                column3(bound_to_free_jac, e_free_pos0, j);
+
+            for (unsigned int i = 0u; i < e_bound_size; ++i) {
+                matrix_operator().element(full_jac, i, j) =
+                    dot3(free_jac, i, e_free_pos0, pos_col);
+            }
+        }
+        // Angles: Position and direction entries
+        for (unsigned int j = e_bound_phi; j <= e_bound_theta; ++j) {
+            const vector3_type pos_col =
+                column3(bound_to_free_jac, e_free_pos0, j);
+            const vector3_type dir_col =
+                column3(bound_to_free_jac, e_free_dir0, j);
+
+            for (unsigned int i = 0u; i < e_bound_size; ++i) {
+                matrix_operator().element(full_jac, i, j) =
+                    dot3(free_jac, i, e_free_pos0, pos_col) +
+                    dot3(free_jac, i, e_free_dir0, dir_col);
+            }
+        }
+        // Time and q/p: Unit columns
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            matrix_operator().element(full_jac, i, e_bound_time) =
+                matrix_operator().element(free_jac, i, e_free_time);
+            matrix_operator().element(full_jac, i, e_bound_qoverp) =
+                matrix_operator().element(free_jac, i, e_free_qoverp);
+        }
+
+        return full_jac;
+    }
+
+    /// @brief Transport the covariance @param cov with the jacobian @param jac
+    ///
+    /// Computes 'jac * cov * jac^T' for a symmetric covariance: Only the upper
+    /// triangle of the result is calculated and then mirrored.
+    ///
+    /// @tparam N the dimension of the covariance (free or bound)
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE static inline bound_matrix<algebra_type>
+    transport_covariance(const matrix_type<e_bound_size, N>& jac,
+                         const matrix_type<N, N>& cov) {
+
+        const matrix_type<e_bound_size, N> jac_cov = jac * cov;
+
+        bound_matrix<algebra_type> new_cov =
+            matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+        for (unsigned int i = 0u; i < e_bound_size; ++i) {
+            for (unsigned int j = i; j < e_bound_size; ++j) {
+                scalar_type val{0.f};
+                for (unsigned int k = 0u; k < N; ++k) {
+                    val += matrix_operator().element(jac_cov, i, k) *
+                           matrix_operator().element(jac, j, k);
+                }
+                matrix_operator().element(new_cov, i, j) = val;
+                matrix_operator().element(new_cov, j, i) = val;
+            }
+        }
+
+        return new_cov;
+    }
+
+    private:
+    /// @returns the three entries of column @param col of @param mat, starting
+    /// at row @param row
+    template <typename matrix_t>
+    DETRAY_HOST_DEVICE static inline vector3_type column3(
+        const matrix_t& mat, const unsigned int row, const unsigned int col) {
+        return {matrix_operator().element(mat, row, col),
+                matrix_operator().element(mat, row + 1u, col),
+                matrix_operator().element(mat, row + 2u, col)};
+    }
+
+    /// @returns the product of the three entries of row @param row of
+    /// @param mat, starting at column @param col, with the vector @param v
+    template <typename matrix_t>
+    DETRAY_HOST_DEVICE static inline scalar_type dot3(const matrix_t& mat,
+                                                      const unsigned int row,
+                                                      const unsigned int col,
+                                                      const vector3_type& v) {
+        return matrix_operator().element(mat, row, col) * v[0] +
+               matrix_operator().element(mat, row, col + 1u) * v[1] +
+               matrix_operator().element(mat, row, col + 2u) * v[2];
+    }
 };
 
 }  // namespace detray::detail
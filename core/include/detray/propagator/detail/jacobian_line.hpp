@@ -40,6 +40,11 @@ struct jacobian<line2D<algebra_t>> {
     using free_to_path_matrix_type = free_to_path_matrix<algebra_t>;
     /// @}
 
+    /// The reference frame depends on the track direction: The path
+    /// derivative has direction entries and the bound angles enter the
+    /// free position
+    static constexpr bool is_direction_dependent{true};
+
     DETRAY_HOST_DEVICE
     static inline rotation_matrix reference_frame(const transform3_type &trf3,
                                                   const point3_type & /*pos*/,
@@ -45,6 +45,10 @@ struct jacobian<polar2D<algebra_t>> {
     using free_to_path_matrix_type = free_to_path_matrix<algebra_t>;
     /// @}
 
+    /// The reference frame does not depend on the track direction: The
+    /// path derivative only has position entries
+    static constexpr bool is_direction_dependent{false};
+
     DETRAY_HOST_DEVICE
     static inline rotation_matrix reference_frame(
         const transform3_type &trf3, const point3_type & /*pos*/,
@@ -0,0 +1,202 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/navigation/policies.hpp"
+#include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s).
+#include <type_traits>
+
+namespace detray {
+
+/// Helix stepper implementation for homogeneous magnetic fields
+///
+/// The track is moved along the exact helix, so no integration error has to
+/// be controlled and the transport jacobian is known analytically. Neither
+/// the field gradient nor the continuous energy loss in volume material are
+/// taken into account.
+///
+/// @tparam magnetic_field_t the type of the (constant) magnetic field
+template <typename magnetic_field_t, typename algebra_t,
+          typename constraint_t = unconstrained_step,
+          typename policy_t = stepper_default_policy,
+          typename inspector_t = stepping::void_inspector>
+class helix_stepper final
+    : public base_stepper<algebra_t, constraint_t, policy_t, inspector_t> {
+
+    public:
+    using base_type =
+        base_stepper<algebra_t, constraint_t, policy_t, inspector_t>;
+
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using transform3_type = dtransform3D<algebra_t>;
+    using free_track_parameters_type =
+        typename base_type::free_track_parameters_type;
+    using bound_track_parameters_type =
+        typename base_type::bound_track_parameters_type;
+    using matrix_operator = typename base_type::matrix_operator;
+    using magnetic_field_type = magnetic_field_t;
+    template <std::size_t ROWS, std::size_t COLS>
+    using matrix_type = dmatrix<algebra_t, ROWS, COLS>;
+
+    struct state : public base_type::state {
+
+        static constexpr const stepping::id id = stepping::id::e_helix;
+
+        DETRAY_HOST_DEVICE
+        state(const free_track_parameters_type& t,
+              const magnetic_field_t& mag_field)
+            : base_type::state(t) {
+            set_field(mag_field);
+        }
+
+        template <typename detector_t>
+        DETRAY_HOST_DEVICE state(
+            const bound_track_parameters_type& bound_params,
+            const magnetic_field_t& mag_field, const detector_t& det)
+            : base_type::state(bound_params, det) {
+            set_field(mag_field);
+        }
+
+        /// The field vector (constant over the detector)
+        vector3_type _b_field{0.f, 0.f, 0.f};
+
+        /// Update the track state and the jacobian transport along the helix
+        /// through the current track position
+        DETRAY_HOST_DEVICE
+        inline void advance(const bool do_covariance_transport) {
+            auto& track = this->_track;
+            const scalar_type h{this->_step_size};
+
+            // Straight line for neutral tracks or without field
+            if (track.qop() == 0.f || getter::norm(_b_field) == 0.f) {
+                if (do_covariance_transport) {
+                    auto D = matrix_operator()
+                                 .template identity<e_free_size, e_free_size>();
+                    const matrix_type<3, 3> dxdn =
+                        h * matrix_operator().template identity<3, 3>();
+                    matrix_operator().template set_block<3, 3>(
+                        D, dxdn, e_free_pos0, e_free_dir0);
+
+                    this->_jac_transport = D * this->_jac_transport;
+                }
+                track.set_pos(track.pos() + h * track.dir());
+            } else {
+                const detail::helix<algebra_t> hlx(track, &_b_field);
+
+                if (do_covariance_transport) {
+                    this->_jac_transport =
+                        hlx.jacobian(h) * this->_jac_transport;
+                }
+                track.set_pos(hlx.pos(h));
+                track.set_dir(hlx.dir(h));
+            }
+
+            // Update path length
+            this->_path_length += h;
+            this->_abs_path_length += math::fabs(h);
+            this->_s += h;
+        }
+
+        /// Evaluate dtds, where t is the unit tangential direction
+        DETRAY_HOST_DEVICE
+        inline vector3_type dtds() const {
+            return this->_track.qop() *
+                   vector::cross(this->_track.dir(), _b_field);
+        }
+
+        /// No continuous energy loss
+        DETRAY_HOST_DEVICE
+        inline scalar_type dqopds() const { return 0.f; }
+
+        private:
+        /// Read the field vector at the track position from @param mag_field
+        DETRAY_HOST_DEVICE
+        inline void set_field(const magnetic_field_t& mag_field) {
+            const point3_type pos = this->_track.pos();
+            const auto bvec = mag_field.at(pos[0], pos[1], pos[2]);
+            _b_field[0] = bvec[0];
+            _b_field[1] = bvec[1];
+            _b_field[2] = bvec[2];
+        }
+    };
+
+    /// Take a step along the helix to the next navigation candidate
+    ///
+    /// @return returning the heartbeat, indicating if the stepping is alive
+    template <typename propagation_state_t>
+    DETRAY_HOST_DEVICE bool step(propagation_state_t& propagation,
+                                 const stepping::config& cfg = {}) {
+        // Get stepper and navigator states
+        state& stepping = propagation._stepping;
+        auto& navigation = propagation._navigation;
+
+        // The helix is exact: Step directly to the next candidate
+        stepping._step_size = navigation();
+
+        // Escape the initialized state
+        stepping._initialized = false;
+
+        // Update navigation direction
+        const step::direction step_dir = stepping._step_size >= 0.f
+                                             ? step::direction::e_forward
+                                             : step::direction::e_backward;
+        stepping.set_direction(step_dir);
+
+        // Check constraints
+        if (math::fabs(stepping.step_size()) >
+            math::fabs(
+                stepping.constraints().template size<>(stepping.direction()))) {
+            // Run inspection before step size is cut
+            stepping.run_inspector(cfg, "Before constraint: ");
+
+            stepping.set_step_size(
+                stepping.constraints().template size<>(stepping.direction()));
+        }
+
+        // Update track state and jacobian transport
+        stepping.advance(cfg.do_covariance_transport);
+
+        // Call navigation update policy
+        typename helix_stepper::policy_type{}(stepping.policy_state(),
+                                              propagation);
+
+        // Save the current step size
+        stepping._prev_step_size = stepping._step_size;
+
+        // Run inspection if needed
+        stepping.run_inspector(cfg, "Step complete: ");
+
+        return true;
+    }
+};
+
+/// Selects the stepper for a magnetic field type at compile time: The helix
+/// stepper for constant fields and the Runge-Kutta stepper otherwise
+template <typename magnetic_field_t, typename algebra_t,
+          typename constraint_t = unconstrained_step,
+          typename inspector_t = stepping::void_inspector>
+using field_stepper_t = std::conditional_t<
+    detail::is_const_field_v<magnetic_field_t>,
+    helix_stepper<magnetic_field_t, algebra_t, constraint_t,
+                  stepper_default_policy, inspector_t>,
+    rk_stepper<magnetic_field_t, algebra_t, constraint_t, stepper_rk_policy,
+               inspector_t>>;
+
+}  // namespace detray
@@ -14,6 +14,7 @@
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/debug_stream.hpp"
 #include "detray/propagator/propagation_config.hpp"
 #include "detray/tracks/tracks.hpp"
 
@@ -77,7 +78,9 @@ struct propagator {
             vector_type<intersection_type> &&candidates = {})
             : m_param_type(parameter_type::e_free),
               _stepping(t_in),
-              _navigation(det, std::move(candidates)) {}
+              _navigation(det, std::move(candidates)) {
+            locate_start_volume(det, t_in.pos());
+        }
 
         template <typename field_t>
         DETRAY_HOST_DEVICE state(
@@ -86,7 +89,9 @@ struct propagator {
             vector_type<intersection_type> &&candidates = {})
             : m_param_type(parameter_type::e_free),
               _stepping(t_in, magnetic_field),
-              _navigation(det, std::move(candidates)) {}
+              _navigation(det, std::move(candidates)) {
+            locate_start_volume(det, t_in.pos());
+        }
 
         /// Construct the propagation state with bound parameter
         DETRAY_HOST_DEVICE state(
@@ -113,7 +118,9 @@ struct propagator {
             typename navigator_type::state::view_type nav_view)
             : m_param_type(parameter_type::e_bound),
               _stepping(param),
-              _navigation(det, track_index, nav_view) {}
+              _navigation(det, track_index, nav_view) {
+            locate_start_volume(det, param.pos());
+        }
 
         /// Construct the propagation state from the navigator state view
         template <typename field_t>
@@ -124,7 +131,9 @@ struct propagator {
             typename navigator_type::state::view_type nav_view)
             : m_param_type(parameter_type::e_bound),
               _stepping(param, magnetic_field),
-              _navigation(det, track_index, nav_view) {}
+              _navigation(det, track_index, nav_view) {
+            locate_start_volume(det, param.pos());
+        }
 
         DETRAY_HOST_DEVICE
         parameter_type param_type() const { return m_param_type; }
@@ -132,6 +141,18 @@ struct propagator {
         DETRAY_HOST_DEVICE
         void set_param_type(const parameter_type t) { m_param_type = t; }
 
+        /// Start the navigation in the volume that contains the track
+        /// position @param pos (stays in the first volume if not found)
+        DETRAY_HOST_DEVICE
+        void locate_start_volume(
+            const detector_type &det,
+            const typename detector_type::point3_type &pos) {
+            const dindex vol_idx{det.volume_index(pos)};
+            if (vol_idx != dindex_invalid) {
+                _navigation.set_volume(vol_idx);
+            }
+        }
+
         // Is the propagation still alive?
         bool _heartbeat = false;
         // Starting type of track parametrization
@@ -142,7 +163,7 @@ struct propagator {
 
         bool do_debug = false;
 #if defined(__NO_DEVICE__)
-        std::stringstream debug_stream{};
+        detail::debug_stream debug_stream{};
 #endif
     };
 
@@ -11,17 +11,23 @@
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/materials/material.hpp"
 #include "detray/materials/predefined_materials.hpp"
 #include "detray/navigation/policies.hpp"
 #include "detray/propagator/base_stepper.hpp"
+#include "detray/propagator/detail/dormand_prince.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/matrix_helper.hpp"
+#include "detray/utils/type_traits.hpp"
 
 namespace detray {
 
 /// Runge-Kutta-Nystrom 4th order stepper implementation
 ///
+/// Optionally integrates with the Dormand-Prince 5(4) scheme instead (see
+/// @c stepping::config::scheme).
+///
 /// @tparam magnetic_field_t the type of magnetic field
 /// @tparam track_t the type of track that is being advanced by the stepper
 /// @tparam constraint_ the type of constraints on the stepper
@@ -55,6 +61,18 @@ class rk_stepper final
     DETRAY_HOST_DEVICE
     rk_stepper() {}
 
+    /// Stage data of the Dormand-Prince 5(4) scheme. Only lives for the
+    /// duration of a step, so that it does not add to the stepper state
+    struct dormand_prince_data {
+        // Stage directions, fields and q/p
+        std::array<vector3_type, 7u> t;
+        std::array<vector3_type, 7u> b;
+        std::array<scalar_type, 7u> qop;
+        // Stage derivatives dt/ds and d(q/p)/ds
+        std::array<vector3_type, 7u> dtds;
+        std::array<scalar_type, 7u> dqopds;
+    };
+
     struct state : public base_type::state {
 
         static constexpr const stepping::id id = stepping::id::e_rk;
@@ -83,6 +101,10 @@ class rk_stepper final
             std::array<vector3_type, 4u> dtds;
             // d(q/p)/ds
             std::array<scalar_type, 4u> dqopds;
+            // End point of the last step, at which b_last was evaluated
+            point3_type b_last_pos{0.f, 0.f, 0.f};
+            // Is b_last valid as the first field value of the next step?
+            bool b_last_valid{false};
         } _step_data;
 
         /// Magnetic field view
@@ -91,6 +113,12 @@ class rk_stepper final
         /// Material that track is passing through. Usually a volume material
         const detray::material<scalar_type>* _mat{nullptr};
 
+        /// Tabulated interactions for the particle hypothesis (optional)
+        const interaction_table<scalar_type>* _mat_table{nullptr};
+
+        /// Index of the volume material in the interaction table
+        dindex _mat_table_idx{dindex_invalid};
+
         /// Access the current volume material
         DETRAY_HOST_DEVICE
         const auto& volume_material() const {
@@ -98,6 +126,31 @@ class rk_stepper final
             return *_mat;
         }
 
+        /// Set the volume material @param mat and look it up in the
+        /// interaction table @param mat_table, if one is given and it was
+        /// built for the particle hypothesis of the track
+        DETRAY_HOST_DEVICE
+        void set_volume_material(
+            const detray::material<scalar_type>* mat,
+            const interaction_table<scalar_type>* mat_table = nullptr) {
+            _mat = mat;
+            _mat_table = mat_table;
+            _mat_table_idx =
+                (mat != nullptr && mat_table != nullptr &&
+                 mat_table->matches(this->_pdg, this->_mass,
+                                    this->_track.charge()))
+                    ? mat_table->find(*mat)
+                    : dindex_invalid;
+        }
+
+        /// @returns true if the energy loss in the volume material should
+        /// be taken from the interaction table according to @param cfg
+        DETRAY_HOST_DEVICE
+        bool use_interaction_table(const stepping::config& cfg) const {
+            return cfg.use_interaction_table && _mat_table != nullptr &&
+                   _mat_table_idx != dindex_invalid;
+        }
+
         /// Update the track state by Runge-Kutta-Nystrom integration.
         DETRAY_HOST_DEVICE
         inline void advance_track();
@@ -106,6 +159,28 @@ class rk_stepper final
         DETRAY_HOST_DEVICE
         inline void advance_jacobian(const stepping::config& cfg = {});
 
+        /// Evaluate the Dormand-Prince stages @param dp for the step size
+        /// @param h
+        ///
+        /// @returns the local error estimate
+        DETRAY_HOST_DEVICE
+        inline scalar_type evaluate_dormand_prince(
+            const scalar_type h, const stepping::config& cfg,
+            dormand_prince_data& dp);
+
+        /// Update the track state from the Dormand-Prince stages @param dp
+        DETRAY_HOST_DEVICE
+        inline void advance_track_dormand_prince(
+            const dormand_prince_data& dp);
+
+        /// Update the jacobian transport by integrating the variational
+        /// equations with the Dormand-Prince stages @param dp
+        ///
+        /// @note has to be called before the track is advanced
+        DETRAY_HOST_DEVICE
+        inline void advance_jacobian_dormand_prince(
+            const dormand_prince_data& dp, const stepping::config& cfg = {});
+
         /// evaulate dqopds for a given step size and material
         DETRAY_HOST_DEVICE
         inline scalar_type evaluate_dqopds(const std::size_t i,
@@ -121,6 +196,9 @@ class rk_stepper final
                                           const vector3_type& dtds_prev,
                                           const scalar_type qop);
 
+        /// Evaluate the field gradient dB/dr at @param pos. Uses the gradient
+        /// of the field access, if it provides one, and central finite
+        /// differences otherwise.
         DETRAY_HOST_DEVICE
         inline matrix_type<3, 3> evaluate_field_gradient(
             const point3_type& pos);
@@ -133,12 +211,16 @@ class rk_stepper final
         DETRAY_HOST_DEVICE
         inline scalar_type dqopds() const;
 
+        /// Evaulate d(qop)/ds for @param qop, using the interaction table
+        /// if it is enabled in @param cfg
         DETRAY_HOST_DEVICE
-        inline scalar_type dqopds(const scalar_type qop) const;
+        inline scalar_type dqopds(const scalar_type qop,
+                                  const stepping::config& cfg = {}) const;
 
         /// Evaulate d(d(qop)/ds)dqop
         DETRAY_HOST_DEVICE
-        inline scalar_type d2qopdsdqop(const scalar_type qop) const;
+        inline scalar_type d2qopdsdqop(const scalar_type qop,
+                                       const stepping::config& cfg = {}) const;
 
         /// Call the stepping inspector
         template <typename... Args>
@@ -189,21 +189,21 @@ DETRAY_HOST_DEVICE void detray::rk_stepper<
         getter::element(D, e_free_qoverp, e_free_qoverp) = 1.f;
     } else {
         // Pre-calculate dqop_n/dqop1
-        const scalar_type d2qop1dsdqop1 = this->d2qopdsdqop(sd.qop[0u]);
+        const scalar_type d2qop1dsdqop1 = this->d2qopdsdqop(sd.qop[0u], cfg);
 
         dqopn_dqop[0u] = 1.f;
         dqopn_dqop[1u] = 1.f + half_h * d2qop1dsdqop1;
 
         const scalar_type d2qop2dsdqop1 =
-            this->d2qopdsdqop(sd.qop[1u]) * dqopn_dqop[1u];
+            this->d2qopdsdqop(sd.qop[1u], cfg) * dqopn_dqop[1u];
         dqopn_dqop[2u] = 1.f + half_h * d2qop2dsdqop1;
 
         const scalar_type d2qop3dsdqop1 =
-            this->d2qopdsdqop(sd.qop[2u]) * dqopn_dqop[2u];
+            this->d2qopdsdqop(sd.qop[2u], cfg) * dqopn_dqop[2u];
         dqopn_dqop[3u] = 1.f + h * d2qop3dsdqop1;
 
         const scalar_type d2qop4dsdqop1 =
-            this->d2qopdsdqop(sd.qop[3u]) * dqopn_dqop[3u];
+            this->d2qopdsdqop(sd.qop[3u], cfg) * dqopn_dqop[3u];
 
         /*-----------------------------------------------------------------
          * Calculate the first terms of d(dqop_n/ds)/dqop1
@@ -399,6 +399,239 @@ DETRAY_HOST_DEVICE void detray::rk_stepper<
     this->_jac_transport = D * this->_jac_transport;
 }
 
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE auto detray::rk_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::evaluate_dormand_prince(const scalar_type h,
+                                             const detray::stepping::config&
+                                                 cfg,
+                                             dormand_prince_data& dp)
+    -> scalar_type {
+
+    using tableau = detail::dormand_prince<scalar_type>;
+
+    auto& sd = this->_step_data;
+    const auto& track = this->_track;
+    const point3_type pos = track.pos();
+    const vector3_type dir = track.dir();
+    const scalar_type qop = track.qop();
+
+    // The first stage is the first Runge-Kutta point of the step
+    dp.t[0u] = dir;
+    dp.b[0u] = sd.b_first;
+    dp.qop[0u] = qop;
+    dp.dtds[0u] = sd.dtds[0u];
+    dp.dqopds[0u] = sd.dqopds[0u];
+
+    for (unsigned int i = 1u; i < tableau::n_stages; ++i) {
+        vector3_type dr{0.f, 0.f, 0.f};
+        vector3_type dt{0.f, 0.f, 0.f};
+        scalar_type dqop{0.f};
+        for (unsigned int j = 0u; j < i; ++j) {
+            const scalar_type a_ij{tableau::a(i, j)};
+            dr = dr + a_ij * dp.t[j];
+            dt = dt + a_ij * dp.dtds[j];
+            dqop += a_ij * dp.dqopds[j];
+        }
+
+        const point3_type pos_i = pos + h * dr;
+        const auto bvec =
+            this->_magnetic_field.at(pos_i[0], pos_i[1], pos_i[2]);
+        dp.b[i][0] = bvec[0];
+        dp.b[i][1] = bvec[1];
+        dp.b[i][2] = bvec[2];
+
+        dp.t[i] = dir + h * dt;
+        dp.qop[i] = cfg.use_mean_loss ? qop + h * dqop : qop;
+
+        // dtds = qop * (t X B) from Lorentz force
+        dp.dtds[i] = dp.qop[i] * vector::cross(dp.t[i], dp.b[i]);
+        dp.dqopds[i] = this->dqopds(dp.qop[i], cfg);
+    }
+
+    // The last stage is evaluated at the end point of the step
+    constexpr unsigned int last{tableau::n_stages - 1u};
+    sd.b_last = dp.b[last];
+    sd.qop[3u] = dp.qop[last];
+    sd.dtds[3u] = dp.dtds[last];
+    sd.dqopds[3u] = dp.dqopds[last];
+
+    // Difference between the 5th and 4th order solutions
+    vector3_type err_pos{0.f, 0.f, 0.f};
+    vector3_type err_dir{0.f, 0.f, 0.f};
+    for (unsigned int i = 0u; i < tableau::n_stages; ++i) {
+        const scalar_type e_i{tableau::e(i)};
+        err_pos = err_pos + e_i * dp.t[i];
+        err_dir = err_dir + e_i * dp.dtds[i];
+    }
+
+    return math::max(getter::norm(h * err_pos),
+                     math::fabs(h) * getter::norm(h * err_dir));
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::advance_track_dormand_prince(const dormand_prince_data&
+                                                      dp) {
+
+    using tableau = detail::dormand_prince<scalar_type>;
+    constexpr unsigned int last{tableau::n_stages - 1u};
+
+    const scalar_type h{this->_step_size};
+    auto& track = this->_track;
+
+    // 5th order solution (the last stage has zero weight)
+    vector3_type dr{0.f, 0.f, 0.f};
+    for (unsigned int i = 0u; i < last; ++i) {
+        dr = dr + tableau::b(i) * dp.t[i];
+    }
+    track.set_pos(track.pos() + h * dr);
+
+    // The last stage was evaluated with the 5th order direction and q/p
+    track.set_dir(vector::normalize(dp.t[last]));
+    if (!(this->_mat == nullptr)) {
+        track.set_qop(dp.qop[last]);
+    }
+
+    // Update path length
+    this->_path_length += h;
+    this->_abs_path_length += math::fabs(h);
+    this->_s += h;
+}
+
+template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
+          typename policy_t, typename inspector_t,
+          template <typename, std::size_t> class array_t>
+DETRAY_HOST_DEVICE void detray::rk_stepper<
+    magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
+    array_t>::state::advance_jacobian_dormand_prince(const dormand_prince_data&
+                                                         dp,
+                                                     const detray::stepping::
+                                                         config& cfg) {
+
+    /// Integrates the variational equations of the free track parameters
+    /// with the same stages as the track itself:
+    ///     d/ds (dr/dx) = dt/dx
+    ///     d/ds (dt/dx) = qop * (dt/dx X B) + dqop/dx * (t X B)
+    ///                    + qop * (t X dB/dr * dr/dx)
+    ///     d/ds (dqop/dx) = d(dqop/ds)/dqop * dqop/dx,
+    /// for x = r1, t1, qop1. Without field gradient, the derivatives do not
+    /// depend on r1, without energy loss gradient dqop/dqop1 = 1.
+    using tableau = detail::dormand_prince<scalar_type>;
+    constexpr unsigned int n_stages{tableau::n_stages};
+    constexpr unsigned int last{n_stages - 1u};
+
+    const scalar_type h{this->_step_size};
+    const point3_type pos = this->_track.pos();
+
+    const bool use_eloss_gradient{cfg.use_eloss_gradient &&
+                                  cfg.use_mean_loss};
+    const bool use_field_gradient{cfg.use_field_gradient};
+
+    const matrix_type<3, 3> I33 = matrix_operator().template identity<3, 3>();
+    const matrix_type<3, 3> O33 = matrix_operator().template zero<3, 3>();
+
+    // Stage values of the derivatives of r, t and qop w.r.t. r1, t1 and qop1
+    std::array<matrix_type<3u, 3u>, n_stages> drdr;
+    std::array<matrix_type<3u, 3u>, n_stages> dtdr;
+    std::array<matrix_type<3u, 3u>, n_stages> drdt;
+    std::array<matrix_type<3u, 3u>, n_stages> dtdt;
+    std::array<vector3_type, n_stages> drdqop;
+    std::array<vector3_type, n_stages> dtdqop;
+    std::array<scalar_type, n_stages> dqopdqop;
+
+    // ... and their derivatives along s (dk = d(dt/ds), dg = d(dqop/ds))
+    std::array<matrix_type<3u, 3u>, n_stages> dkdr;
+    std::array<matrix_type<3u, 3u>, n_stages> dkdt;
+    std::array<vector3_type, n_stages> dkdqop;
+    std::array<scalar_type, n_stages> dgdqop;
+
+    for (unsigned int i = 0u; i < n_stages; ++i) {
+        drdr[i] = I33;
+        dtdr[i] = O33;
+        drdt[i] = O33;
+        dtdt[i] = I33;
+        drdqop[i] = vector3_type{0.f, 0.f, 0.f};
+        dtdqop[i] = vector3_type{0.f, 0.f, 0.f};
+        dqopdqop[i] = 1.f;
+
+        vector3_type dr{0.f, 0.f, 0.f};
+        for (unsigned int j = 0u; j < i; ++j) {
+            const scalar_type a_ij{tableau::a(i, j)};
+            const scalar_type h_a_ij{h * a_ij};
+            dr = dr + a_ij * dp.t[j];
+            drdt[i] = drdt[i] + h_a_ij * dtdt[j];
+            dtdt[i] = dtdt[i] + h_a_ij * dkdt[j];
+            drdqop[i] = drdqop[i] + h_a_ij * dtdqop[j];
+            dtdqop[i] = dtdqop[i] + h_a_ij * dkdqop[j];
+            if (use_field_gradient) {
+                drdr[i] = drdr[i] + h_a_ij * dtdr[j];
+                dtdr[i] = dtdr[i] + h_a_ij * dkdr[j];
+            }
+            if (use_eloss_gradient) {
+                dqopdqop[i] += h_a_ij * dgdqop[j];
+            }
+        }
+
+        dkdt[i] =
+            dp.qop[i] * mat_helper().column_wise_cross(dtdt[i], dp.b[i]);
+        dkdqop[i] = dp.qop[i] * vector::cross(dtdqop[i], dp.b[i]) +
+                    dqopdqop[i] * vector::cross(dp.t[i], dp.b[i]);
+        dgdqop[i] = use_eloss_gradient
+                        ? this->d2qopdsdqop(dp.qop[i], cfg) * dqopdqop[i]
+                        : 0.f;
+
+        if (use_field_gradient) {
+            // Field gradient at the stage position
+            const matrix_type<3, 3> dBdr =
+                evaluate_field_gradient(pos + h * dr);
+
+            // t X (dB/dr * dr/dx) = -(dB/dr * dr/dx) X t
+            dkdr[i] =
+                dp.qop[i] * mat_helper().column_wise_cross(dtdr[i], dp.b[i]) -
+                dp.qop[i] *
+                    mat_helper().column_wise_cross(dBdr * drdr[i], dp.t[i]);
+            dkdt[i] = dkdt[i] - dp.qop[i] * mat_helper().column_wise_cross(
+                                                dBdr * drdt[i], dp.t[i]);
+            dkdqop[i] = dkdqop[i] -
+                        dp.qop[i] * vector::cross(dBdr * drdqop[i], dp.t[i]);
+        }
+    }
+
+    // The last stage is the 5th order solution of t and qop, its row of
+    // the tableau equals the weights of the 5th order solution of r
+    matrix_type<3, 3> dFdr = I33;
+    matrix_type<3, 3> dFdt = O33;
+    vector3_type dFdqop{0.f, 0.f, 0.f};
+    for (unsigned int i = 0u; i < last; ++i) {
+        const scalar_type h_b_i{h * tableau::b(i)};
+        dFdr = dFdr + h_b_i * dtdr[i];
+        dFdt = dFdt + h_b_i * dtdt[i];
+        dFdqop = dFdqop + h_b_i * dtdqop[i];
+    }
+
+    // Set transport matrix (D) and update Jacobian transport
+    //( JacTransport = D * JacTransport )
+    auto D = matrix_operator().template identity<e_free_size, e_free_size>();
+
+    matrix_operator().set_block(D, dFdt, 0u, 4u);
+    matrix_operator().set_block(D, dtdt[last], 4u, 4u);
+    matrix_operator().set_block(D, dFdqop, 0u, 7u);
+    matrix_operator().set_block(D, dtdqop[last], 4u, 7u);
+    if (use_field_gradient) {
+        matrix_operator().set_block(D, dFdr, 0u, 0u);
+        matrix_operator().set_block(D, dtdr[last], 4u, 0u);
+    }
+    getter::element(D, e_free_qoverp, e_free_qoverp) = dqopdqop[last];
+
+    this->_jac_transport = D * this->_jac_transport;
+}
+
 template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           typename policy_t, typename inspector_t,
           template <typename, std::size_t> class array_t>
@@ -432,7 +665,7 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
                 sd.qop[i] = qop + h * dqopds_prev;
             }
         }
-        return this->dqopds(sd.qop[i]);
+        return this->dqopds(sd.qop[i], cfg);
     }
 }
 
@@ -470,6 +703,19 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
     matrix_type<3, 3> dBdr = matrix_operator().template zero<3, 3>();
 
+    // Analytic gradient, e.g. from the interpolation cell of the field map
+    if constexpr (detail::has_field_gradient_v<magnetic_field_t,
+                                               scalar_type>) {
+        const auto grad =
+            this->_magnetic_field.gradient(pos[0], pos[1], pos[2]);
+        for (unsigned int i = 0u; i < 3u; i++) {
+            for (unsigned int j = 0u; j < 3u; j++) {
+                getter::element(dBdr, i, j) = grad[i][j];
+            }
+        }
+        return dBdr;
+    }
+
     constexpr auto delta{1e-1f * unit<scalar_type>::mm};
 
     for (unsigned int i = 0; i < 3; i++) {
@@ -544,7 +790,8 @@ template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           template <typename, std::size_t> class array_t>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::dqopds(const scalar_type qop) const -> scalar_type {
+    array_t>::state::dqopds(const scalar_type qop,
+                            const stepping::config& cfg) const -> scalar_type {
 
     // d(qop)ds is zero for empty space
     if (this->_mat == nullptr) {
@@ -561,8 +808,10 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
 
     // Compute stopping power
     const scalar_type stopping_power =
-        interaction<scalar_type>().compute_stopping_power(mat, pdg,
-                                                          {mass, qop, q});
+        this->use_interaction_table(cfg)
+            ? this->_mat_table->stopping_power(this->_mat_table_idx, qop)
+            : interaction<scalar_type>().compute_stopping_power(
+                  mat, pdg, {mass, qop, q});
 
     // Assert that a momentum is a positive value
     assert(p >= 0.f);
@@ -577,7 +826,9 @@ template <typename magnetic_field_t, typename algebra_t, typename constraint_t,
           template <typename, std::size_t> class array_t>
 DETRAY_HOST_DEVICE auto detray::rk_stepper<
     magnetic_field_t, algebra_t, constraint_t, policy_t, inspector_t,
-    array_t>::state::d2qopdsdqop(const scalar_type qop) const -> scalar_type {
+    array_t>::state::d2qopdsdqop(const scalar_type qop,
+                                 const stepping::config& cfg) const
+    -> scalar_type {
 
     if (this->_mat == nullptr) {
         return 0.f;
@@ -592,22 +843,31 @@ DETRAY_HOST_DEVICE auto detray::rk_stepper<
     const auto& mass = this->_mass;
     const scalar_type E2 = p2 + mass * mass;
 
-    // Interaction object
-    interaction<scalar_type> I;
+    scalar_type bethe{0.f};
+    scalar_type dbethedqop{0.f};
+    if (this->use_interaction_table(cfg)) {
+        bethe = this->_mat_table->stopping_power(this->_mat_table_idx, qop);
+        dbethedqop =
+            this->_mat_table->derive_stopping_power(this->_mat_table_idx, qop);
+    } else {
+        // Interaction object
+        interaction<scalar_type> I;
+
+        const detail::relativistic_quantities<scalar_type> rq(mass, qop, q);
+        // We assume that stopping power ~ mean ionization eloss per
+        // pathlength
+        bethe = I.compute_bethe_bloch(mat, this->_pdg, rq);
+        dbethedqop = I.derive_bethe_bloch(mat, this->_pdg, rq, bethe);
+    }
 
     // g = dE/ds = -1 * (-dE/ds) = -1 * stopping power
-    const detail::relativistic_quantities<scalar_type> rq(mass, qop, q);
-    // We assume that stopping power ~ mean ionization eloss per pathlength
-    const scalar_type bethe = I.compute_bethe_bloch(mat, this->_pdg, rq);
     const scalar_type g = -1.f * bethe;
 
     // dg/d(qop) = -1 * derivation of stopping power
-    const scalar_type dgdqop =
-        -1.f * interaction<scalar_type>().derive_bethe_bloch(mat, this->_pdg,
-                                                             rq, bethe);
+    const scalar_type dgdqop = -1.f * dbethedqop;
 
     // d(qop)/ds = - qop^3 * E * g / q^2
-    const scalar_type dqopds = this->dqopds(qop);
+    const scalar_type dqopds = this->dqopds(qop, cfg);
 
     // Check Eq 3.12 of
     // (https://iopscience.iop.org/article/10.1088/1748-0221/4/04/P04016/meta)
@@ -638,22 +898,32 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
 
     const point3_type pos = stepping().pos();
 
+    // Look up the new material in the interaction table only when the
+    // material changes
     auto vol = tracking_volume{*navigation.detector(), navigation.volume()};
-    if (vol.has_material()) {
-        stepping._mat = vol.material_parameters(pos);
-    } else {
-        stepping._mat = nullptr;
+    const detray::material<scalar_type>* mat =
+        vol.has_material() ? vol.material_parameters(pos) : nullptr;
+    if (mat != stepping._mat) {
+        stepping.set_volume_material(mat, stepping._mat_table);
     }
 
     auto& sd = stepping._step_data;
 
     scalar_type error_estimate{0.f};
 
-    // First Runge-Kutta point
-    const auto bvec = magnetic_field.at(pos[0], pos[1], pos[2]);
-    sd.b_first[0] = bvec[0];
-    sd.b_first[1] = bvec[1];
-    sd.b_first[2] = bvec[2];
+    // First Runge-Kutta point: Reuse the field of the last point of the
+    // previous step (first-same-as-last), if it was evaluated at the current
+    // position (the track could have been moved or reset in the meantime)
+    if (cfg.use_field_cache && sd.b_last_valid && sd.b_last_pos[0] == pos[0] &&
+        sd.b_last_pos[1] == pos[1] && sd.b_last_pos[2] == pos[2]) {
+        sd.b_first = sd.b_last;
+    } else {
+        const auto bvec = magnetic_field.at(pos[0], pos[1], pos[2]);
+        sd.b_first[0] = bvec[0];
+        sd.b_first[1] = bvec[1];
+        sd.b_first[2] = bvec[2];
+    }
+    sd.b_last_valid = false;
 
     // qop should be recalcuated at every point
     // Reference: Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
@@ -714,6 +984,24 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
         return error_estimate;
     };
 
+    const bool use_dormand_prince{cfg.scheme ==
+                                  stepping::rk_scheme::e_dormand_prince};
+    typename rk_stepper::dormand_prince_data dp;
+
+    const auto estimate = [&](const scalar_type h) -> scalar_type {
+        return use_dormand_prince
+                   ? stepping.evaluate_dormand_prince(h, cfg, dp)
+                   : estimate_error(h);
+    };
+
+    // Step size scaling for the order of the integration scheme
+    const auto step_scaling = [&](const scalar_type err) -> scalar_type {
+        const scalar_type ratio{cfg.rk_error_tol / err};
+        return use_dormand_prince
+                   ? math::pow(ratio, static_cast<scalar_type>(0.2))
+                   : math::sqrt(math::sqrt(ratio));
+    };
+
     scalar_type error{1e20f};
 
     // Whenever navigator::init() is called the step size is set to navigation
@@ -722,7 +1010,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
     if (stepping._initialized) {
         for (unsigned int i_t = 0u; i_t < cfg.max_rk_updates; i_t++) {
 
-            error = math::max(estimate_error(stepping._step_size),
+            error = math::max(estimate(stepping._step_size),
                               static_cast<scalar_type>(1e-20));
 
             // Error is small enough
@@ -735,8 +1023,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
             // ---> Make step size smaller and esimate error again
             else {
 
-                scalar_type step_size_scaling =
-                    math::sqrt(math::sqrt(cfg.rk_error_tol / error));
+                scalar_type step_size_scaling = step_scaling(error);
 
                 stepping._step_size *= step_size_scaling;
 
@@ -747,7 +1034,7 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
         }
     } else {
         stepping._initialized = false;
-        error = math::max(estimate_error(stepping._step_size),
+        error = math::max(estimate(stepping._step_size),
                           static_cast<scalar_type>(1e-20));
     }
 
@@ -772,21 +1059,41 @@ DETRAY_HOST_DEVICE bool detray::rk_stepper<
 
         stepping.set_step_size(
             stepping.constraints().template size<>(stepping.direction()));
+
+        if (use_dormand_prince) {
+            // The stages have to be evaluated for the shortened step
+            error = math::max(estimate(stepping._step_size),
+                              static_cast<scalar_type>(1e-20));
+        }
     }
 
-    // Advance track state
-    stepping.advance_track();
+    // Only the last Dormand-Prince stage is evaluated at the end point of
+    // the step. The last RKN4 stage is a predicted point, which is not
+    // the final position
+    sd.b_last_valid = use_dormand_prince;
+
+    // Advance track state and jacobian transport
+    if (use_dormand_prince) {
+        // The stage positions are taken relative to the start of the step
+        if (cfg.do_covariance_transport) {
+            stepping.advance_jacobian_dormand_prince(dp, cfg);
+        }
+
+        stepping.advance_track_dormand_prince(dp);
+        sd.b_last_pos = stepping().pos();
+    } else {
+        stepping.advance_track();
 
-    // Advance jacobian transport
-    if (cfg.do_covariance_transport) {
-        stepping.advance_jacobian(cfg);
+        if (cfg.do_covariance_transport) {
+            stepping.advance_jacobian(cfg);
+        }
     }
 
     // Call navigation update policy
     typename rk_stepper::policy_type{}(stepping.policy_state(), propagation);
 
     const scalar_type step_size_scaling = static_cast<scalar_type>(
-        math::min(math::max(math::sqrt(math::sqrt(cfg.rk_error_tol / error)),
+        math::min(math::max(step_scaling(error),
                             static_cast<scalar_type>(0.25)),
                   static_cast<scalar_type>(4.)));
 
@@ -0,0 +1,576 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/boolean.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/propagator/stepping_config.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail::soa {
+
+/// Lane utilities that work for plain scalars (one lane) and Vc vectors
+/// @{
+template <typename scalar_t>
+constexpr std::size_t n_lanes() {
+    if constexpr (std::is_arithmetic_v<scalar_t>) {
+        return 1u;
+    } else {
+        return scalar_t::size();
+    }
+}
+
+/// @returns @param a where the @param mask is set, @param b otherwise
+template <typename scalar_t>
+inline scalar_t select(const bool mask, const scalar_t &a, const scalar_t &b) {
+    return mask ? a : b;
+}
+
+/// @returns the value of lane @param i
+template <typename scalar_t>
+inline auto get_lane(const scalar_t &v, [[maybe_unused]] const std::size_t i) {
+    if constexpr (std::is_arithmetic_v<scalar_t>) {
+        return v;
+    } else {
+        return static_cast<typename scalar_t::EntryType>(v[i]);
+    }
+}
+
+/// Set the value of lane @param i to @param val
+template <typename scalar_t, typename value_t>
+inline void set_lane(scalar_t &v, [[maybe_unused]] const std::size_t i,
+                     const value_t val) {
+    if constexpr (std::is_arithmetic_v<scalar_t>) {
+        v = static_cast<scalar_t>(val);
+    } else {
+        v[i] = static_cast<typename scalar_t::EntryType>(val);
+    }
+}
+
+/// Element-wise minimum/maximum
+template <typename scalar_t,
+          std::enable_if_t<std::is_arithmetic_v<scalar_t>, bool> = true>
+inline scalar_t min(const scalar_t a, const scalar_t b) {
+    return std::min(a, b);
+}
+
+template <typename scalar_t,
+          std::enable_if_t<std::is_arithmetic_v<scalar_t>, bool> = true>
+inline scalar_t max(const scalar_t a, const scalar_t b) {
+    return std::max(a, b);
+}
+
+/// Element-wise square root
+template <typename scalar_t,
+          std::enable_if_t<std::is_arithmetic_v<scalar_t>, bool> = true>
+inline scalar_t sqrt(const scalar_t a) {
+    return std::sqrt(a);
+}
+
+#if (IS_SOA)
+template <typename mask_t, typename scalar_t,
+          std::enable_if_t<Vc::Traits::is_simd_mask<mask_t>::value, bool> =
+              true>
+inline scalar_t select(const mask_t &mask, const scalar_t &a,
+                       const scalar_t &b) {
+    return Vc::iif(mask, a, b);
+}
+
+template <typename scalar_t,
+          std::enable_if_t<Vc::Traits::is_simd_vector<scalar_t>::value,
+                           bool> = true>
+inline scalar_t min(const scalar_t &a, const scalar_t &b) {
+    return Vc::min(a, b);
+}
+
+template <typename scalar_t,
+          std::enable_if_t<Vc::Traits::is_simd_vector<scalar_t>::value,
+                           bool> = true>
+inline scalar_t max(const scalar_t &a, const scalar_t &b) {
+    return Vc::max(a, b);
+}
+
+template <typename scalar_t,
+          std::enable_if_t<Vc::Traits::is_simd_vector<scalar_t>::value,
+                           bool> = true>
+inline scalar_t sqrt(const scalar_t &a) {
+    return Vc::sqrt(a);
+}
+#endif
+/// @}
+
+}  // namespace detail::soa
+
+/// @brief Free track parameters of a bundle of tracks in SoA layout.
+///
+/// Every lane of the algebra's scalar type holds one track. For a plain
+/// (non-SIMD) algebra, the bundle degenerates to a single track.
+template <typename algebra_t>
+struct track_bundle {
+
+    using scalar_type = dscalar<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+
+    /// @returns the number of tracks in the bundle
+    static constexpr std::size_t size() {
+        return detail::soa::n_lanes<scalar_type>();
+    }
+
+    point3_type pos{scalar_type(0.f), scalar_type(0.f), scalar_type(0.f)};
+    vector3_type dir{scalar_type(0.f), scalar_type(0.f), scalar_type(1.f)};
+    scalar_type qop{-1.f};
+
+    /// Load the free parameters @param trk into lane @param i
+    template <typename track_t>
+    DETRAY_HOST void set(const std::size_t i, const track_t &trk) {
+        const auto p = trk.pos();
+        const auto d = trk.dir();
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            detail::soa::set_lane(pos[j], i, p[j]);
+            detail::soa::set_lane(dir[j], i, d[j]);
+        }
+        detail::soa::set_lane(qop, i, trk.qop());
+    }
+
+    /// Write the free parameters of lane @param i to @param trk
+    template <typename track_t>
+    DETRAY_HOST void get(const std::size_t i, track_t &trk) const {
+        auto p = trk.pos();
+        auto d = trk.dir();
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            p[j] = detail::soa::get_lane(pos[j], i);
+            d[j] = detail::soa::get_lane(dir[j], i);
+        }
+        trk.set_pos(p);
+        trk.set_dir(d);
+        trk.set_qop(detail::soa::get_lane(qop, i));
+    }
+};
+
+/// Runge-Kutta-Nystrom 4th order stepper for a bundle of tracks.
+///
+/// Advances all tracks of a @c track_bundle together, with the track
+/// parameters and the free transport jacobian held in SoA layout, so that one
+/// SIMD instruction serves all lanes. Every lane has its own adaptive step
+/// size. Lanes that are terminated (e.g. because the track left the
+/// detector or diverged into a different volume than its neighbours) are
+/// masked and keep their parameters until they are reloaded.
+///
+/// @note The stepper integrates in vacuum and does not evaluate the field
+/// gradient. Material effects and the navigation remain with the scalar
+/// propagation. As in the scalar @c rk_stepper, the time is not transported:
+/// the time row of the jacobian stays a unit row and, without energy loss,
+/// the particle mass does not enter (the q/p row is a unit row as well).
+///
+/// @tparam magnetic_field_t the type of magnetic field (scalar lookup)
+/// @tparam algebra_t the SoA algebra (e.g. @c vc_soa<float> )
+template <typename magnetic_field_t, typename algebra_t>
+class rk_bundle_stepper {
+
+    public:
+    using algebra_type = algebra_t;
+    using scalar_type = dscalar<algebra_t>;
+    using bool_type = dbool<algebra_t>;
+    using point3_type = dpoint3D<algebra_t>;
+    using vector3_type = dvector3D<algebra_t>;
+    using magnetic_field_type = magnetic_field_t;
+    using bundle_type = track_bundle<algebra_t>;
+    /// Free transport jacobian (row major), one matrix per lane
+    using jacobian_type = std::array<scalar_type, e_free_size * e_free_size>;
+
+    /// @returns the number of tracks that are stepped together
+    static constexpr std::size_t size() { return bundle_type::size(); }
+
+    struct state {
+
+        /// Construct an empty bundle (all lanes inactive)
+        DETRAY_HOST
+        explicit state(const magnetic_field_t &mag_field)
+            : _magnetic_field(mag_field) {
+            for (std::size_t i = 0u; i < size(); ++i) {
+                reset_jacobian(i);
+            }
+        }
+
+        /// Construct from up to @c size() tracks, starting at @param tracks
+        template <typename track_t>
+        DETRAY_HOST state(const track_t *tracks, const std::size_t n_tracks,
+                          const magnetic_field_t &mag_field)
+            : state(mag_field) {
+            for (std::size_t i = 0u; i < std::min(n_tracks, size()); ++i) {
+                load(i, tracks[i]);
+            }
+        }
+
+        /// Track parameters of all lanes
+        bundle_type _bundle{};
+        /// Which lanes are still being propagated
+        bool_type _active{false};
+        /// Current and previous step sizes
+        scalar_type _step_size{0.f};
+        scalar_type _prev_step_size{0.f};
+        /// Signed and absolute path length
+        scalar_type _path_length{0.f};
+        scalar_type _abs_path_length{0.f};
+        /// Free transport jacobian of every lane
+        jacobian_type _jac_transport{};
+
+        /// Stepping data required for RKN4
+        struct {
+            vector3_type b_first, b_middle, b_last;
+            std::array<vector3_type, 4u> t;
+            std::array<vector3_type, 4u> dtds;
+        } _step_data;
+
+        /// Magnetic field view
+        const magnetic_field_t _magnetic_field;
+
+        /// Load track @param trk into lane @param i and activate the lane
+        template <typename track_t>
+        DETRAY_HOST void load(const std::size_t i, const track_t &trk) {
+            _bundle.set(i, trk);
+            detail::soa::set_lane(_step_size, i, 0.f);
+            detail::soa::set_lane(_prev_step_size, i, 0.f);
+            detail::soa::set_lane(_path_length, i, 0.f);
+            detail::soa::set_lane(_abs_path_length, i, 0.f);
+            reset_jacobian(i);
+            set_active(i, true);
+        }
+
+        /// Write the track parameters of lane @param i to @param trk
+        template <typename track_t>
+        DETRAY_HOST void store(const std::size_t i, track_t &trk) const {
+            _bundle.get(i, trk);
+        }
+
+        /// @returns the transport jacobian element (@param row, @param col)
+        /// of lane @param i
+        DETRAY_HOST auto jacobian(const std::size_t i, const std::size_t row,
+                                  const std::size_t col) const {
+            return detail::soa::get_lane(
+                _jac_transport[row * e_free_size + col], i);
+        }
+
+        /// Set the transport jacobian of lane @param i to identity
+        DETRAY_HOST void reset_jacobian(const std::size_t i) {
+            for (std::size_t r = 0u; r < e_free_size; ++r) {
+                for (std::size_t c = 0u; c < e_free_size; ++c) {
+                    detail::soa::set_lane(_jac_transport[r * e_free_size + c],
+                                          i, r == c ? 1.f : 0.f);
+                }
+            }
+        }
+
+        /// Mark lane @param i as (in)active
+        DETRAY_HOST void set_active(const std::size_t i, const bool b) {
+            if constexpr (std::is_same_v<bool_type, bool>) {
+                _active = b;
+            } else {
+                _active[i] = b;
+            }
+        }
+
+        /// @returns whether lane @param i is active
+        DETRAY_HOST bool is_active(const std::size_t i) const {
+            if constexpr (std::is_same_v<bool_type, bool>) {
+                return _active;
+            } else {
+                return _active[i];
+            }
+        }
+
+        /// Stop the propagation of all lanes in @param mask
+        DETRAY_HOST void terminate(const bool_type &mask) {
+            _active = _active && !mask;
+        }
+
+        /// @returns true if any lane is still being propagated
+        DETRAY_HOST bool is_alive() const {
+            return detail::any_of(_active);
+        }
+
+        /// Look up the magnetic field for all active lanes at @param pos
+        DETRAY_HOST vector3_type field(const point3_type &pos) const {
+            vector3_type b{scalar_type(0.f), scalar_type(0.f),
+                           scalar_type(0.f)};
+            for (std::size_t i = 0u; i < size(); ++i) {
+                if (!is_active(i)) {
+                    continue;
+                }
+                const auto bvec = _magnetic_field.at(
+                    detail::soa::get_lane(pos[0], i),
+                    detail::soa::get_lane(pos[1], i),
+                    detail::soa::get_lane(pos[2], i));
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    detail::soa::set_lane(b[j], i, bvec[j]);
+                }
+            }
+            return b;
+        }
+    };
+
+    /// Take one adaptive step for all active lanes.
+    ///
+    /// @param stepping the bundle state
+    /// @param max_step signed step limit per lane, e.g. the distance to the
+    ///                 next surface found by the navigation
+    /// @param cfg stepping configuration
+    ///
+    /// @returns true if any lane is still active after the step
+    DETRAY_HOST bool step(state &stepping, const scalar_type &max_step,
+                          const stepping::config &cfg = {}) const;
+
+    private:
+    /// @returns the component-wise selection of @param a and @param b
+    DETRAY_HOST static vector3_type select(const bool_type &mask,
+                                           const vector3_type &a,
+                                           const vector3_type &b) {
+        return {detail::soa::select(mask, a[0], b[0]),
+                detail::soa::select(mask, a[1], b[1]),
+                detail::soa::select(mask, a[2], b[2])};
+    }
+
+    /// Evaluate the RKN stages for step size @param h and return the local
+    /// error estimate per lane
+    DETRAY_HOST static scalar_type evaluate_stages(state &stepping,
+                                                   const scalar_type &h);
+
+    /// Update the transport jacobian of all lanes in @param mask
+    DETRAY_HOST static void advance_jacobian(state &stepping,
+                                             const bool_type &mask);
+};
+
+template <typename magnetic_field_t, typename algebra_t>
+DETRAY_HOST auto
+rk_bundle_stepper<magnetic_field_t, algebra_t>::evaluate_stages(
+    state &stepping, const scalar_type &h) -> scalar_type {
+
+    auto &sd = stepping._step_data;
+    const auto &pos = stepping._bundle.pos;
+    const auto &qop = stepping._bundle.qop;
+
+    const scalar_type h2{h * h};
+    const scalar_type half_h{h * 0.5f};
+
+    // Second Runge-Kutta point
+    // Reference: Eq (84) of https://doi.org/10.1016/0029-554X(81)90063-X
+    const point3_type pos1 =
+        pos + half_h * sd.t[0u] + h2 * 0.125f * sd.dtds[0u];
+    sd.b_middle = stepping.field(pos1);
+
+    sd.t[1u] = sd.t[0u] + half_h * sd.dtds[0u];
+    sd.dtds[1u] = qop * vector::cross(sd.t[1u], sd.b_middle);
+
+    // Third Runge-Kutta point
+    sd.t[2u] = sd.t[0u] + half_h * sd.dtds[1u];
+    sd.dtds[2u] = qop * vector::cross(sd.t[2u], sd.b_middle);
+
+    // Last Runge-Kutta point
+    const point3_type pos2 = pos + h * sd.t[0u] + h2 * 0.5f * sd.dtds[2u];
+    sd.b_last = stepping.field(pos2);
+
+    sd.t[3u] = sd.t[0u] + h * sd.dtds[2u];
+    sd.dtds[3u] = qop * vector::cross(sd.t[3u], sd.b_last);
+
+    // Local integration error estimate
+    const scalar_type one_sixth{static_cast<scalar_type>(1.f / 6.f)};
+    const vector3_type err_vec =
+        one_sixth * h2 *
+        (sd.dtds[0u] - sd.dtds[1u] - sd.dtds[2u] + sd.dtds[3u]);
+
+    return detail::soa::max(getter::norm(err_vec), scalar_type(1e-20f));
+}
+
+template <typename magnetic_field_t, typename algebra_t>
+DETRAY_HOST void
+rk_bundle_stepper<magnetic_field_t, algebra_t>::advance_jacobian(
+    state &stepping, const bool_type &mask) {
+
+    // Same derivation as in the scalar @c rk_stepper (ATL-SOFT-PUB-2009-002),
+    // restricted to vacuum and a field without gradient. The 3x3 blocks are
+    // stored column-wise, so that the column-wise cross product is a plain
+    // cross product on every column.
+    using block_type = std::array<vector3_type, 3u>;
+
+    const auto &sd = stepping._step_data;
+    const scalar_type h{stepping._step_size};
+    const scalar_type &qop = stepping._bundle.qop;
+    const scalar_type half_h{h * 0.5f};
+    const scalar_type h_6{h * static_cast<scalar_type>(1.f / 6.f)};
+
+    const scalar_type zero{0.f};
+    const scalar_type one{1.f};
+    const scalar_type two{2.f};
+    const block_type I33{vector3_type{one, zero, zero},
+                         vector3_type{zero, one, zero},
+                         vector3_type{zero, zero, one}};
+
+    // dk_n/dt1
+    std::array<block_type, 4u> dkndt;
+    for (unsigned int c = 0u; c < 3u; ++c) {
+        dkndt[0u][c] = qop * vector::cross(I33[c], sd.b_first);
+        dkndt[1u][c] =
+            qop * vector::cross(I33[c] + half_h * dkndt[0u][c], sd.b_middle);
+        dkndt[2u][c] =
+            qop * vector::cross(I33[c] + half_h * dkndt[1u][c], sd.b_middle);
+        dkndt[3u][c] =
+            qop * vector::cross(I33[c] + h * dkndt[2u][c], sd.b_last);
+    }
+
+    // dk_n/dqop1
+    std::array<vector3_type, 4u> dkndqop;
+    dkndqop[0u] = vector::cross(sd.t[0u], sd.b_first);
+    dkndqop[1u] = vector::cross(sd.t[1u], sd.b_middle) +
+                  qop * half_h * vector::cross(dkndqop[0u], sd.b_middle);
+    dkndqop[2u] = vector::cross(sd.t[2u], sd.b_middle) +
+                  qop * half_h * vector::cross(dkndqop[1u], sd.b_middle);
+    dkndqop[3u] = vector::cross(sd.t[3u], sd.b_last) +
+                  qop * h * vector::cross(dkndqop[2u], sd.b_last);
+
+    // dF/dt1, dG/dt1 (columns)
+    block_type dFdt;
+    block_type dGdt;
+    for (unsigned int c = 0u; c < 3u; ++c) {
+        dFdt[c] = h * (I33[c] + h_6 * (dkndt[0u][c] + dkndt[1u][c] +
+                                       dkndt[2u][c]));
+        dGdt[c] = I33[c] + h_6 * (dkndt[0u][c] +
+                                  two * (dkndt[1u][c] + dkndt[2u][c]) +
+                                  dkndt[3u][c]);
+    }
+
+    // dF/dqop1, dG/dqop1
+    const vector3_type dFdqop =
+        h * h_6 * (dkndqop[0u] + dkndqop[1u] + dkndqop[2u]);
+    const vector3_type dGdqop =
+        h_6 * (dkndqop[0u] + two * (dkndqop[1u] + dkndqop[2u]) + dkndqop[3u]);
+
+    // J = D * J, where D differs from identity only in the rows of the
+    // position and direction. The time and q/p rows remain untouched.
+    auto &J = stepping._jac_transport;
+    const auto elem = [&J](std::size_t r, std::size_t c) -> scalar_type & {
+        return J[r * e_free_size + c];
+    };
+
+    for (std::size_t c = 0u; c < e_free_size; ++c) {
+        const scalar_type j_dir0{elem(e_free_dir0, c)};
+        const scalar_type j_dir1{elem(e_free_dir1, c)};
+        const scalar_type j_dir2{elem(e_free_dir2, c)};
+        const scalar_type j_qop{elem(e_free_qoverp, c)};
+
+        for (unsigned int r = 0u; r < 3u; ++r) {
+            const scalar_type pos_rc =
+                elem(e_free_pos0 + r, c) + dFdt[0u][r] * j_dir0 +
+                dFdt[1u][r] * j_dir1 + dFdt[2u][r] * j_dir2 +
+                dFdqop[r] * j_qop;
+            const scalar_type dir_rc = dGdt[0u][r] * j_dir0 +
+                                       dGdt[1u][r] * j_dir1 +
+                                       dGdt[2u][r] * j_dir2 + dGdqop[r] * j_qop;
+
+            elem(e_free_pos0 + r, c) =
+                detail::soa::select(mask, pos_rc, elem(e_free_pos0 + r, c));
+            elem(e_free_dir0 + r, c) =
+                detail::soa::select(mask, dir_rc, elem(e_free_dir0 + r, c));
+        }
+    }
+}
+
+template <typename magnetic_field_t, typename algebra_t>
+DETRAY_HOST bool rk_bundle_stepper<magnetic_field_t, algebra_t>::step(
+    state &stepping, const scalar_type &max_step,
+    const stepping::config &cfg) const {
+
+    if (!stepping.is_alive()) {
+        return false;
+    }
+
+    auto &sd = stepping._step_data;
+    auto &bundle = stepping._bundle;
+    const bool_type active{stepping._active};
+
+    // Start with the minimal step size for fresh lanes and never step past
+    // the limit (signed)
+    scalar_type &h = stepping._step_size;
+    h = detail::soa::select(h == scalar_type(0.f),
+                            scalar_type(cfg.min_stepsize), h);
+    h = detail::soa::select(h > scalar_type(0.f), detail::soa::min(h, max_step),
+                            detail::soa::max(h, max_step));
+
+    // First Runge-Kutta point
+    sd.b_first = stepping.field(bundle.pos);
+    sd.t[0u] = bundle.dir;
+    sd.dtds[0u] = bundle.qop * vector::cross(sd.t[0u], sd.b_first);
+
+    // Shrink the step size of the lanes whose error is too large, until all
+    // lanes converge
+    const scalar_type tol{cfg.rk_error_tol};
+    scalar_type error = evaluate_stages(stepping, h);
+    bool_type failed = active && (error > tol);
+
+    for (unsigned int i_t = 0u;
+         i_t < cfg.max_rk_updates && detail::any_of(failed); ++i_t) {
+        const scalar_type scaling{detail::soa::sqrt(
+            detail::soa::sqrt(tol / error))};
+        h = detail::soa::select(failed, h * scaling, h);
+
+        error = evaluate_stages(stepping, h);
+        failed = active && (error > tol);
+    }
+
+    // Lanes that did not converge are aborted
+    stepping.terminate(failed);
+    const bool_type do_step = stepping._active;
+
+    // Advance the track parameters
+    // Reference: Eq (82) of https://doi.org/10.1016/0029-554X(81)90063-X
+    const scalar_type h_6{h * static_cast<scalar_type>(1.f / 6.f)};
+    const scalar_type two{2.f};
+
+    const point3_type new_pos =
+        bundle.pos +
+        h * (sd.t[0u] + h_6 * (sd.dtds[0u] + sd.dtds[1u] + sd.dtds[2u]));
+    const vector3_type new_dir = vector::normalize(
+        bundle.dir +
+        h_6 * (sd.dtds[0u] + two * (sd.dtds[1u] + sd.dtds[2u]) + sd.dtds[3u]));
+
+    if (cfg.do_covariance_transport) {
+        advance_jacobian(stepping, do_step);
+    }
+
+    bundle.pos = select(do_step, new_pos, bundle.pos);
+    bundle.dir = select(do_step, new_dir, bundle.dir);
+
+    const scalar_type zero{0.f};
+    stepping._path_length += detail::soa::select(do_step, h, zero);
+    stepping._abs_path_length +=
+        detail::soa::select(do_step, detail::soa::max(h, -h), zero);
+    stepping._prev_step_size = detail::soa::select(do_step, h, zero);
+
+    // Step size for the next step
+    const scalar_type scaling{detail::soa::min(
+        detail::soa::max(detail::soa::sqrt(detail::soa::sqrt(tol / error)),
+                         scalar_type(0.25f)),
+        scalar_type(4.f))};
+    h = detail::soa::select(do_step, h * scaling, h);
+
+    return stepping.is_alive();
+}
+
+}  // namespace detray
@@ -0,0 +1,177 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Pool of reusable propagation states for the host.
+///
+/// The navigation candidate buffers are sized once for the detector
+/// (@c detector::n_max_candidates) and handed from track to track, so that
+/// setting up the propagation of a new track does not allocate memory. The
+/// pool is not thread-safe: Use one pool per thread, e.g. @c local().
+///
+/// @tparam propagator_t the propagator type the states are created for
+template <typename propagator_t>
+class state_pool {
+
+    using detector_type = typename propagator_t::detector_type;
+    using intersection_type = typename propagator_t::intersection_type;
+    using candidates_type =
+        typename propagator_t::template vector_type<intersection_type>;
+
+    public:
+    using state_type = typename propagator_t::state;
+
+    /// @brief Owns a propagation state that was created by the pool.
+    ///
+    /// Returns the candidate buffer to the pool when it goes out of scope.
+    class handle {
+
+        public:
+        handle() = delete;
+        handle(const handle &) = delete;
+        handle &operator=(const handle &) = delete;
+
+        DETRAY_HOST
+        handle(handle &&other) noexcept
+            : m_pool{other.m_pool}, m_state{std::move(other.m_state)} {
+            other.m_state.reset();
+        }
+
+        DETRAY_HOST
+        ~handle() { release(); }
+
+        /// Access the propagation state
+        /// @{
+        DETRAY_HOST
+        state_type &operator*() { return *m_state; }
+        DETRAY_HOST
+        state_type *operator->() { return &(*m_state); }
+        DETRAY_HOST
+        const state_type &operator*() const { return *m_state; }
+        DETRAY_HOST
+        const state_type *operator->() const { return &(*m_state); }
+        /// @}
+
+        /// Give the candidate buffer back to the pool and destroy the state
+        DETRAY_HOST
+        void release() {
+            if (m_state.has_value()) {
+                m_pool->recycle(m_state->_navigation.release_candidates());
+                m_state.reset();
+            }
+        }
+
+        private:
+        friend class state_pool;
+
+        /// Construct the state in place from @param args
+        template <typename... Args>
+        DETRAY_HOST explicit handle(state_pool &pool, Args &&...args)
+            : m_pool{&pool} {
+            m_state.emplace(std::forward<Args>(args)..., pool.acquire());
+        }
+
+        state_pool *m_pool;
+        std::optional<state_type> m_state{};
+    };
+
+    /// Construct a pool for the detector @param det with @param n_buffers
+    /// pre-allocated candidate buffers
+    DETRAY_HOST
+    explicit state_pool(const detector_type &det, std::size_t n_buffers = 1u)
+        : m_detector{&det}, m_n_max_candidates{det.n_max_candidates()} {
+        m_buffers.reserve(n_buffers);
+        for (std::size_t i = 0u; i < n_buffers; ++i) {
+            m_buffers.push_back(make_buffer());
+        }
+    }
+
+    /// Not copyable: handles keep a pointer to the pool
+    state_pool(const state_pool &) = delete;
+    state_pool &operator=(const state_pool &) = delete;
+
+    /// @returns the pool of the calling thread for the detector @param det
+    ///
+    /// @note the pool is replaced when it is requested for a different
+    /// detector, so no handles of the previous pool may be alive then
+    DETRAY_HOST
+    static state_pool &local(const detector_type &det) {
+        thread_local std::optional<state_pool> pool{};
+        if (!pool.has_value() || pool->m_detector != &det) {
+            pool.emplace(det);
+        }
+        return *pool;
+    }
+
+    /// @returns the detector the buffers are sized for
+    DETRAY_HOST
+    const detector_type &detector() const { return *m_detector; }
+
+    /// @returns the number of free candidate buffers
+    DETRAY_HOST
+    std::size_t n_free() const { return m_buffers.size(); }
+
+    /// @returns the capacity every candidate buffer is sized to
+    DETRAY_HOST
+    std::size_t buffer_capacity() const { return m_n_max_candidates; }
+
+    /// Create a propagation state for the @param track (and magnetic field)
+    ///
+    /// @param args the track parameters and optionally the magnetic field
+    template <typename... Args>
+    DETRAY_HOST handle make_state(Args &&...args) {
+        return handle{*this, std::forward<Args>(args)..., *m_detector};
+    }
+
+    /// @returns a cleared candidate buffer with sufficient capacity
+    DETRAY_HOST
+    candidates_type acquire() {
+        if (m_buffers.empty()) {
+            return make_buffer();
+        }
+        candidates_type buffer{std::move(m_buffers.back())};
+        m_buffers.pop_back();
+        return buffer;
+    }
+
+    /// Put the candidate @param buffer back into the pool
+    DETRAY_HOST
+    void recycle(candidates_type &&buffer) {
+        buffer.clear();
+        m_buffers.push_back(std::move(buffer));
+    }
+
+    private:
+    /// @returns a new candidate buffer sized for the detector
+    DETRAY_HOST
+    candidates_type make_buffer() const {
+        candidates_type buffer{};
+        buffer.reserve(m_n_max_candidates);
+        return buffer;
+    }
+
+    /// The detector the states are created for
+    const detector_type *m_detector;
+    /// Maximal number of candidates of any volume in the detector
+    std::size_t m_n_max_candidates;
+    /// Free candidate buffers
+    std::vector<candidates_type> m_buffers{};
+};
+
+}  // namespace detray
@@ -12,6 +12,7 @@
 #include "detray/definitions/units.hpp"
 
 // System include(s).
+#include <cstdint>
 #include <limits>
 #include <ostream>
 
@@ -22,6 +23,16 @@ enum class id {
     e_linear = 0,
     // True for charged tracks
     e_rk = 1,
+    // Charged tracks in a homogeneous field
+    e_helix = 2,
+};
+
+/// Integration scheme of the Runge-Kutta stepper
+enum class rk_scheme : std::uint_least8_t {
+    /// Runge-Kutta-Nystrom 4th order
+    e_rkn4 = 0,
+    /// Dormand-Prince 5(4) with embedded error estimate
+    e_dormand_prince = 1,
 };
 
 struct config {
@@ -35,9 +46,17 @@ struct config {
     float path_limit{5.f * unit<float>::m};
     /// Maximum number of Runge-Kutta step trials
     std::size_t max_rk_updates{10000u};
+    /// Runge-Kutta integration scheme
+    rk_scheme scheme{rk_scheme::e_rkn4};
+    /// Reuse the field of the last stage of the previous step for the first
+    /// stage of the next step (first-same-as-last). Only the Dormand-Prince
+    /// scheme evaluates its last stage at the end point of the step
+    bool use_field_cache{true};
     /// Use mean energy loss (Bethe)
     /// if false, most probable energy loss (Landau) will be used
     bool use_mean_loss{true};
+    /// Use the tabulated energy loss of the volume material, if available
+    bool use_interaction_table{false};
     /// Use eloss gradient in error propagation
     bool use_eloss_gradient{false};
     /// Use b field gradient in error propagation
@@ -55,12 +74,17 @@ inline std::ostream& operator<<(std::ostream& out,
         << "  Runge-Kutta tolerance : "
         << cfg.rk_error_tol / detray::unit<float>::mm << " [mm]\n"
         << "  Max. step updates     : " << cfg.max_rk_updates << "\n"
+        << "  Runge-Kutta scheme    : "
+        << (cfg.scheme == rk_scheme::e_rkn4 ? "RKN4" : "Dormand-Prince")
+        << "\n"
         << "  Stepsize  constraint  : "
         << cfg.step_constraint / detray::unit<float>::mm << " [mm]\n"
         << "  Path limit            : "
         << cfg.path_limit / detray::unit<float>::m << " [m]\n"
-        << std::boolalpha << "  Use Bethe energy loss : " << cfg.use_mean_loss
+        << std::boolalpha << "  Use field cache       : " << cfg.use_field_cache
         << "\n"
+        << "  Use Bethe energy loss : " << cfg.use_mean_loss << "\n"
+        << "  Use eloss table       : " << cfg.use_interaction_table << "\n"
         << "  Do cov. transport     : " << cfg.do_covariance_transport << "\n";
 
     if (cfg.do_covariance_transport) {
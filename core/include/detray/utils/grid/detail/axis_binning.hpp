@@ -11,12 +11,14 @@
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/algorithms.hpp"
 #include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/grid_axis.hpp"
 
 // System include(s).
 #include <cstddef>
 #include <iterator>
+#include <vector>
 
 namespace detray::axis {
 
@@ -304,4 +306,143 @@ struct irregular {
     }
 };
 
+/// @brief An irregular binning scheme with constant time bin lookup.
+///
+/// In addition to the bin edges, an index table is kept, which divides the
+/// span of the axis into uniform coarse bins and maps every coarse bin to the
+/// first irregular bin it overlaps with. The bin lookup then consists of a
+/// division and a short linear search, instead of a binary search over all
+/// bin edges.
+///
+/// The index table is stored behind the bin edges in the bin edges container:
+/// [lower bin edges..., upper edge of last bin, index table...]. It can be
+/// generated with @c make_index_table .
+template <typename dcontainers = host_container_types,
+          typename scalar_t = scalar>
+struct irregular_lut : public irregular<dcontainers, scalar_t> {
+
+    using base_type = irregular<dcontainers, scalar_t>;
+    using scalar_type = typename base_type::scalar_type;
+    template <typename T>
+    using vector_type = typename base_type::template vector_type<T>;
+    template <typename T, std::size_t N>
+    using array_type = typename base_type::template array_type<T, N>;
+
+    /// Number of coarse bins in the index table per irregular bin
+    static constexpr dindex lut_size_factor{4u};
+
+    /// Default constructor (no concrete memory access)
+    irregular_lut() = default;
+
+    /// Constructor from an index range and bin edges - non-owning
+    ///
+    /// @param range range of bin boundary entries in an external storage
+    /// @param edges lower edges for all bins in an external storage, followed
+    ///              by the index table
+    DETRAY_HOST_DEVICE
+    irregular_lut(const dindex_range &range,
+                  const vector_type<scalar_type> *edges)
+        : base_type(range, edges) {}
+
+    /// @returns the number of entries in the index table
+    DETRAY_HOST_DEVICE
+    dindex lut_size() const { return lut_size_factor * this->m_n_bins; }
+
+    /// Access function to a single bin from a value v
+    ///
+    /// @param v is the value for the bin search
+    ///
+    /// @returns the corresponding bin index
+    DETRAY_HOST_DEVICE
+    int bin(const scalar_type v) const {
+        const vector_type<scalar_type> &edges = *(this->m_bin_edges);
+        const dindex offset{this->m_offset};
+        const dindex n_bins{this->m_n_bins};
+        const dindex n_lut{lut_size()};
+
+        // Find the coarse bin in the index table
+        const scalar_type min{edges[offset]};
+        const scalar_type max{edges[offset + n_bins]};
+        const scalar_type c{(v - min) / (max - min) *
+                            static_cast<scalar_type>(n_lut)};
+        const dindex ic{
+            c > 0.f ? static_cast<dindex>(math::min(
+                          c, static_cast<scalar_type>(n_lut - 1u)))
+                    : 0u};
+
+        // Number of lower bin edges below the value (same as lower_bound)
+        auto k{static_cast<dindex>(edges[offset + n_bins + 1u + ic])};
+        while (k < n_bins && edges[offset + k] < v) {
+            ++k;
+        }
+        // Guard against rounding in the coarse bin calculation
+        while (k > 0u && !(edges[offset + k - 1u] < v)) {
+            --k;
+        }
+
+        return static_cast<int>(k) - 1;
+    }
+
+    /// Access function to a range with binned neighborhood
+    ///
+    /// @note This is an inclusive range
+    ///
+    /// @param v is the value for the bin search
+    /// @param nhood is the neighborhood range (# neighboring bins)
+    ///
+    /// @returns the corresponding range of bin indices
+    DETRAY_HOST_DEVICE
+    bin_range range(const scalar_type v,
+                    const array_type<dindex, 2> &nhood) const {
+        const int ibin{bin(v)};
+        const int ibinmin{ibin - static_cast<int>(nhood[0])};
+        const int ibinmax{ibin + static_cast<int>(nhood[1])};
+
+        return {ibinmin, ibinmax};
+    }
+
+    /// Access function to a range with scalar neighborhood
+    ///
+    /// @param v is the value for the bin search
+    /// @param nhood is the neighborhood range (range on axis values)
+    ///
+    /// @returns the corresponding range of bin indices
+    DETRAY_HOST_DEVICE
+    bin_range range(const scalar_type v,
+                    const array_type<scalar_type, 2> &nhood) const {
+        return {bin(v - nhood[0]), bin(v + nhood[1])};
+    }
+
+    /// Generate the index table for the bin edges @param edges
+    ///
+    /// @param edges lower edges for all bins plus the upper edge of the last
+    ///              bin
+    ///
+    /// @returns the index table (to be appended to the bin edges)
+    template <typename edges_t>
+    DETRAY_HOST static auto make_index_table(const edges_t &edges) {
+        const std::size_t n_bins{edges.size() - 1u};
+        const std::size_t n_lut{lut_size_factor * n_bins};
+
+        const scalar_type min{edges.front()};
+        const scalar_type width{(edges.back() - min) /
+                                static_cast<scalar_type>(n_lut)};
+
+        std::vector<scalar_type> table{};
+        table.reserve(n_lut);
+
+        std::size_t k{0u};
+        for (std::size_t i = 0u; i < n_lut; ++i) {
+            // Lower boundary of the coarse bin
+            const scalar_type x{min + static_cast<scalar_type>(i) * width};
+            while (k < n_bins && edges[k] < x) {
+                ++k;
+            }
+            table.push_back(static_cast<scalar_type>(k));
+        }
+
+        return table;
+    }
+};
+
 }  // namespace detray::axis
@@ -0,0 +1,556 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/utils/grid/detail/axis.hpp"
+#include "detray/utils/grid/detail/axis_bounds.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace detray::axis::detail {
+
+/// @brief Sequence of the global indices of the grid bins that are visited by
+/// a grid search.
+///
+/// Either holds the local bin index ranges of a search window, from which the
+/// bins are generated on the fly, or a list of at most @tparam N bins, e.g.
+/// the bins that are crossed by a ray.
+template <typename grid_t, std::size_t N = 64u>
+class bin_sequence {
+
+    static constexpr unsigned int dim{grid_t::dim};
+
+    public:
+    using loc_bin_index = typename grid_t::loc_bin_index;
+
+    /// Default constructor: empty sequence
+    constexpr bin_sequence() = default;
+
+    /// Empty list of bins of the @param grid
+    DETRAY_HOST_DEVICE
+    explicit constexpr bin_sequence(const grid_t &grid) : m_grid{&grid} {}
+
+    /// All bins of the @param grid in the @param search_window
+    DETRAY_HOST_DEVICE
+    constexpr bin_sequence(const grid_t &grid,
+                           const multi_bin_range<dim> &search_window)
+        : m_grid{&grid}, m_window{search_window}, m_is_window{true} {
+        m_size = 1u;
+        for (unsigned int i = 0u; i < dim; ++i) {
+            const auto &r = m_window[i];
+            m_size *= (r[1] > r[0]) ? static_cast<dindex>(r[1] - r[0]) : 0u;
+        }
+    }
+
+    /// @returns the maximal number of bins in a list
+    DETRAY_HOST_DEVICE
+    static constexpr dindex capacity() { return static_cast<dindex>(N); }
+
+    /// @returns the number of bins in the sequence
+    DETRAY_HOST_DEVICE
+    constexpr dindex size() const { return m_size; }
+
+    /// @returns true if no more bins can be added to the list
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return m_is_window || m_size == N; }
+
+    /// @returns the global index of the @param i -th bin in the sequence
+    DETRAY_HOST_DEVICE
+    constexpr dindex operator[](dindex i) const {
+        if (!m_is_window) {
+            return m_bins[i];
+        }
+
+        // Local bin index in the window (the last axis varies fastest)
+        loc_bin_index lbin{};
+        for (int d = static_cast<int>(dim) - 1; d >= 0; --d) {
+            const auto &r = m_window[static_cast<unsigned int>(d)];
+            const auto n{static_cast<dindex>(r[1] - r[0])};
+            lbin[static_cast<unsigned int>(d)] =
+                static_cast<dindex>(r[0] + static_cast<int>(i % n));
+            i /= n;
+        }
+        wrap(lbin, std::make_index_sequence<dim>{});
+
+        return m_grid->serialize(lbin);
+    }
+
+    /// @returns true if the global bin @param gbin is in the sequence
+    DETRAY_HOST_DEVICE
+    constexpr bool contains(const dindex gbin) const {
+        for (dindex i = 0u; i < m_size; ++i) {
+            if ((*this)[i] == gbin) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Add the global bin @param gbin to the list, if it is not contained yet
+    ///
+    /// @returns false if the list is full
+    DETRAY_HOST_DEVICE
+    constexpr bool insert(const dindex gbin) {
+        if (contains(gbin)) {
+            return true;
+        }
+        if (full()) {
+            return false;
+        }
+        m_bins[m_size++] = gbin;
+        return true;
+    }
+
+    /// Add all bins in the box that is spanned by the local bins @param from
+    /// and @param to (the shorter way around on circular axes)
+    ///
+    /// @returns false if the list is full
+    DETRAY_HOST_DEVICE
+    constexpr bool insert(const loc_bin_index &from, const loc_bin_index &to) {
+        const auto n_bins = m_grid->axes().nbins_per_axis();
+        darray<bool, dim> is_circular{};
+        get_circular(is_circular, std::make_index_sequence<dim>{});
+
+        darray<int, dim> lower{};
+        darray<dindex, dim> n{};
+        dindex n_total{1u};
+        for (unsigned int d = 0u; d < dim; ++d) {
+            const int nb{static_cast<int>(n_bins[d])};
+            int delta{static_cast<int>(to[d]) - static_cast<int>(from[d])};
+            if (is_circular[d]) {
+                delta = (delta > nb / 2) ? delta - nb : delta;
+                delta = (delta < -nb / 2) ? delta + nb : delta;
+            }
+            lower[d] = math::min(static_cast<int>(from[d]),
+                                 static_cast<int>(from[d]) + delta);
+            n[d] = static_cast<dindex>(math::abs(delta) + 1);
+            n_total *= n[d];
+        }
+
+        for (dindex i = 0u; i < n_total; ++i) {
+            loc_bin_index lbin{};
+            dindex j{i};
+            for (unsigned int d = 0u; d < dim; ++d) {
+                lbin[d] = static_cast<dindex>(lower[d] +
+                                              static_cast<int>(j % n[d]));
+                j /= n[d];
+            }
+            wrap(lbin, std::make_index_sequence<dim>{});
+
+            if (!insert(m_grid->serialize(lbin))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    private:
+    /// Map local bin indices on circular axes into the axis range
+    template <std::size_t... I>
+    DETRAY_HOST_DEVICE constexpr void wrap(loc_bin_index &lbin,
+                                           std::index_sequence<I...>) const {
+        (wrap(m_grid->template get_axis<I>(), lbin), ...);
+    }
+
+    /// Map local bin index on the axis @param ax into the axis range
+    template <typename axis_t>
+    DETRAY_HOST_DEVICE constexpr void wrap(const axis_t &ax,
+                                           loc_bin_index &lbin) const {
+        if constexpr (axis_t::bounds_type::type == axis::bounds::e_circular) {
+            constexpr auto loc_idx{
+                static_cast<std::size_t>(axis_t::bounds_type::label)};
+            // Signed index, in case it was calculated below zero
+            const auto idx{static_cast<int>(lbin[loc_idx])};
+            lbin[loc_idx] =
+                static_cast<dindex>(axis::circular<>{}.wrap(idx, ax.nbins()));
+        }
+    }
+
+    /// Flag the circular axes
+    template <std::size_t... I>
+    DETRAY_HOST_DEVICE constexpr void get_circular(
+        darray<bool, dim> &is_circular, std::index_sequence<I...>) const {
+        ((is_circular[static_cast<std::size_t>(
+              std::decay_t<decltype(m_grid->template get_axis<I>())>::
+                  bounds_type::label)] =
+              (std::decay_t<decltype(m_grid->template get_axis<I>())>::
+                   bounds_type::type == axis::bounds::e_circular)),
+         ...);
+    }
+
+    /// The grid
+    const grid_t *m_grid{nullptr};
+    /// The bin list
+    darray<dindex, N> m_bins{};
+    /// The search window
+    multi_bin_range<dim> m_window{};
+    /// Number of bins in the sequence
+    dindex m_size{0u};
+    /// Whether the bins are generated from the search window
+    bool m_is_window{false};
+};
+
+/// @returns the key by which the grid entry @param e is deduplicated: Either
+/// the entry itself or the barcode of a surface descriptor
+template <typename entry_t>
+DETRAY_HOST_DEVICE constexpr auto dedup_key(const entry_t &e) {
+    if constexpr (std::is_arithmetic_v<entry_t>) {
+        return e;
+    } else {
+        return e.barcode().value();
+    }
+}
+
+/// @brief Range over the entries of all bins in a bin sequence.
+///
+/// If @c unique is set, an entry is skipped if it was already contained in a
+/// previous bin of the sequence, so that every entry is visited once.
+template <typename grid_t, std::size_t N = 64u>
+class bin_sequence_view
+    : public detray::ranges::view_interface<bin_sequence_view<grid_t, N>> {
+
+    using sequence_type = bin_sequence<grid_t, N>;
+
+    public:
+    using value_t = typename grid_t::value_type;
+    using key_t = decltype(dedup_key(std::declval<value_t>()));
+
+    /// Number of unique entries that are tracked without a scan of the
+    /// previous bins
+    static constexpr dindex n_scratch{32u};
+
+    /// Iterate through the entries of the bins
+    class iterator {
+
+        public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = value_t;
+        using pointer = value_type *;
+        using reference = value_type &;
+        using iterator_category = detray::ranges::forward_iterator_tag;
+
+        /// Default constructor required by LegacyIterator trait
+        constexpr iterator() = default;
+
+        /// Construct at the bin with index @param i in the sequence
+        DETRAY_HOST_DEVICE
+        constexpr iterator(const bin_sequence_view &view, const dindex i)
+            : m_view{&view}, m_bin{i} {
+            find_valid();
+        }
+
+        /// @returns true if both iterators point to the same entry
+        DETRAY_HOST_DEVICE
+        constexpr bool operator==(const iterator &rhs) const {
+            return (m_bin == rhs.m_bin) && (m_entry == rhs.m_entry);
+        }
+
+        /// @returns false if both iterators point to the same entry
+        DETRAY_HOST_DEVICE
+        constexpr bool operator!=(const iterator &rhs) const {
+            return !(*this == rhs);
+        }
+
+        /// Increment to the next (unique) entry
+        DETRAY_HOST_DEVICE
+        constexpr auto operator++() -> iterator & {
+            ++m_entry;
+            find_valid();
+            return *this;
+        }
+
+        /// @returns the current entry
+        DETRAY_HOST_DEVICE
+        constexpr value_type operator*() const {
+            return m_view->grid().bin(m_view->sequence()[m_bin])[m_entry];
+        }
+
+        private:
+        /// Move to the next entry that should be visited
+        DETRAY_HOST_DEVICE
+        constexpr void find_valid() {
+            const auto &seq = m_view->sequence();
+            const auto &grid = m_view->grid();
+
+            for (; m_bin < seq.size(); ++m_bin, m_entry = 0u) {
+                const auto bin = grid.bin(seq[m_bin]);
+                for (; m_entry < bin.size(); ++m_entry) {
+                    if (!m_view->is_unique() || is_first(bin[m_entry])) {
+                        return;
+                    }
+                }
+            }
+            // End position
+            m_entry = 0u;
+        }
+
+        /// @returns true if the entry @param e was not visited before
+        ///
+        /// The keys of the visited entries are kept in a small sorted array.
+        /// Only once it is full, the previous bins have to be scanned.
+        DETRAY_HOST_DEVICE
+        constexpr bool is_first(const value_type &e) {
+            const key_t key{dedup_key(e)};
+
+            // Binary search for the first key that is not smaller
+            dindex lo{0u};
+            dindex hi{m_n_seen};
+            while (lo < hi) {
+                const dindex mid{(lo + hi) / 2u};
+                if (m_seen[mid] < key) {
+                    lo = mid + 1u;
+                } else {
+                    hi = mid;
+                }
+            }
+            if (lo < m_n_seen && m_seen[lo] == key) {
+                return false;
+            }
+
+            if (m_n_seen < n_scratch) {
+                for (dindex i = m_n_seen; i > lo; --i) {
+                    m_seen[i] = m_seen[i - 1u];
+                }
+                m_seen[lo] = key;
+                ++m_n_seen;
+                return true;
+            }
+
+            return is_first_in_sequence(e);
+        }
+
+        /// @returns true if the entry @param e is not contained in one of the
+        /// previous bins of the sequence
+        DETRAY_HOST_DEVICE
+        constexpr bool is_first_in_sequence(const value_type &e) const {
+            const auto &seq = m_view->sequence();
+            for (dindex i = 0u; i < m_bin; ++i) {
+                for (const auto &other : m_view->grid().bin(seq[i])) {
+                    if (other == e) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /// The range
+        const bin_sequence_view *m_view{nullptr};
+        /// Current bin in the sequence and entry in that bin
+        dindex m_bin{0u};
+        dindex m_entry{0u};
+        /// Sorted keys of the visited entries
+        darray<key_t, n_scratch> m_seen{};
+        dindex m_n_seen{0u};
+    };
+
+    /// Default constructor
+    constexpr bin_sequence_view() = default;
+
+    /// Construct from the @param grid and the @param sequence of bins
+    DETRAY_HOST_DEVICE
+    constexpr bin_sequence_view(const grid_t &grid,
+                                const sequence_type &sequence,
+                                const bool unique = false)
+        : m_grid{&grid}, m_sequence{sequence}, m_unique{unique} {}
+
+    /// @returns start position: first entry in the first bin
+    DETRAY_HOST_DEVICE
+    constexpr auto begin() const -> iterator { return {*this, 0u}; }
+
+    /// @returns sentinel of the range
+    DETRAY_HOST_DEVICE
+    constexpr auto end() const -> iterator {
+        return {*this, m_sequence.size()};
+    }
+
+    /// @returns the grid
+    DETRAY_HOST_DEVICE
+    constexpr auto grid() const -> const grid_t & { return *m_grid; }
+
+    /// @returns the bin sequence
+    DETRAY_HOST_DEVICE
+    constexpr auto sequence() const -> const sequence_type & {
+        return m_sequence;
+    }
+
+    /// @returns whether every entry is visited only once
+    DETRAY_HOST_DEVICE
+    constexpr bool is_unique() const { return m_unique; }
+
+    private:
+    const grid_t *m_grid{nullptr};
+    sequence_type m_sequence{};
+    bool m_unique{false};
+};
+
+/// Get the average bin width and the period (circular axes only) of a grid
+/// axis @param ax
+template <typename axis_t, typename scalar_t, std::size_t DIM>
+DETRAY_HOST_DEVICE constexpr void get_march_params(
+    const axis_t &ax, darray<scalar_t, DIM> &width,
+    darray<scalar_t, DIM> &period) {
+
+    constexpr auto loc_idx{
+        static_cast<std::size_t>(axis_t::bounds_type::label)};
+    // Over- and underflow bins do not cover the axis span
+    constexpr dindex n_extra{
+        axis_t::bounds_type::type == axis::bounds::e_open ? 2u : 0u};
+
+    const scalar_t span{ax.max() - ax.min()};
+    width[loc_idx] = span / static_cast<scalar_t>(ax.nbins() - n_extra);
+    period[loc_idx] = (axis_t::bounds_type::type == axis::bounds::e_circular)
+                          ? span
+                          : scalar_t{0};
+}
+
+/// Get the average bin widths and periods of all axes of a @param grid
+template <typename grid_t, typename scalar_t, std::size_t DIM,
+          std::size_t... I>
+DETRAY_HOST_DEVICE constexpr void get_march_params(
+    const grid_t &grid, darray<scalar_t, DIM> &width,
+    darray<scalar_t, DIM> &period, std::index_sequence<I...>) {
+    (get_march_params(grid.template get_axis<I>(), width, period), ...);
+}
+
+/// Fill the @param sequence with the bins of the @param grid that are crossed
+/// by the straight line through @param pos in direction @param dir, up to the
+/// path length @param max_dist
+///
+/// The line is projected into the grid frame piecewise: The step length is
+/// estimated so that the projection moves by half a bin at most. All bins in
+/// the box between two consecutive bins are added, in order not to miss any
+/// bin when the line crosses bins diagonally.
+///
+/// If the bins do not fit into the list (or the line is not followed up to
+/// @param max_dist within the maximal number of steps), the sequence falls
+/// back to the search window that spans all bins that the line reaches, so
+/// that no bin is missed.
+///
+/// @returns false if the sequence fell back to the search window
+template <typename grid_t, std::size_t N, typename transform_t,
+          typename point3_t, typename vector3_t>
+DETRAY_HOST_DEVICE inline bool march(
+    const grid_t &grid, const transform_t &trf, const point3_t &pos,
+    const vector3_t &dir, const typename grid_t::scalar_type max_dist,
+    bin_sequence<grid_t, N> &sequence) {
+
+    using scalar_t = typename grid_t::scalar_type;
+    using point_t = typename grid_t::point_type;
+    constexpr unsigned int dim{grid_t::dim};
+
+    // Path length for the estimate of the direction in the grid frame
+    constexpr scalar_t h{0.1f * unit<scalar_t>::mm};
+    // Limit the number of steps
+    constexpr dindex max_steps{4u * static_cast<dindex>(N)};
+
+    darray<scalar_t, dim> width{};
+    darray<scalar_t, dim> period{};
+    get_march_params(grid, width, period, std::make_index_sequence<dim>{});
+    const auto n_bins = grid.axes().nbins_per_axis();
+
+    point_t loc = grid.project(trf, pos, dir);
+    auto lbin = grid.axes().bins(loc);
+    bool is_complete{sequence.insert(grid.serialize(lbin))};
+
+    // Box of all bins reached so far (unwrapped on circular axes)
+    darray<int, dim> cur{};
+    darray<int, dim> lower{};
+    darray<int, dim> upper{};
+    for (unsigned int d = 0u; d < dim; ++d) {
+        cur[d] = static_cast<int>(lbin[d]);
+        lower[d] = cur[d];
+        upper[d] = cur[d];
+    }
+
+    // Extend the box by the bin @param next (the shorter way around)
+    const auto extend = [&](const auto &next) {
+        for (unsigned int d = 0u; d < dim; ++d) {
+            int delta{static_cast<int>(next[d]) - static_cast<int>(lbin[d])};
+            if (period[d] > 0.f) {
+                const int nb{static_cast<int>(n_bins[d])};
+                delta = (delta > nb / 2) ? delta - nb : delta;
+                delta = (delta < -nb / 2) ? delta + nb : delta;
+            }
+            cur[d] += delta;
+            lower[d] = math::min(lower[d], cur[d]);
+            upper[d] = math::max(upper[d], cur[d]);
+        }
+    };
+
+    scalar_t s{0.f};
+    for (dindex n = 0u; s < max_dist && n < max_steps; ++n) {
+
+        // Step length that moves the projection by half a bin at most
+        const point_t probe = grid.project(trf, pos + (s + h) * dir, dir);
+        scalar_t ds{max_dist - s};
+        for (unsigned int d = 0u; d < dim; ++d) {
+            scalar_t du{probe[d] - loc[d]};
+            if (period[d] > 0.f) {
+                du = (du > 0.5f * period[d]) ? du - period[d] : du;
+                du = (du < -0.5f * period[d]) ? du + period[d] : du;
+            }
+            const scalar_t v{math::fabs(du) / h};
+            if (v > 0.f) {
+                ds = math::min(ds, 0.5f * width[d] / v);
+            }
+        }
+        s = math::min(s + math::max(ds, h), max_dist);
+
+        loc = grid.project(trf, pos + s * dir, dir);
+        const auto next_lbin = grid.axes().bins(loc);
+
+        bool is_same{true};
+        for (unsigned int d = 0u; d < dim; ++d) {
+            is_same &= (next_lbin[d] == lbin[d]);
+        }
+        if (!is_same) {
+            // Keep following the line if the list is full to find the box
+            is_complete = is_complete && sequence.insert(lbin, next_lbin);
+            extend(next_lbin);
+            lbin = next_lbin;
+        }
+    }
+
+    // Ran out of steps: At least cover the end point of the line
+    if (s < max_dist) {
+        is_complete = false;
+        extend(grid.axes().bins(grid.project(trf, pos + max_dist * dir, dir)));
+    }
+
+    if (is_complete) {
+        return true;
+    }
+
+    // Fall back to the window of all bins that were reached
+    multi_bin_range<dim> window{};
+    for (unsigned int d = 0u; d < dim; ++d) {
+        const int nb{static_cast<int>(n_bins[d])};
+        if (upper[d] - lower[d] + 1 >= nb) {
+            window[d] = {0, nb};
+        } else {
+            window[d] = {lower[d], upper[d] + 1};
+        }
+    }
+    sequence = bin_sequence<grid_t, N>{grid, window};
+
+    return false;
+}
+
+}  // namespace detray::axis::detail
@@ -412,4 +412,293 @@ class bin_storage<is_owning, detray::bins::dynamic_array<entry_t>, containers>
     entry_range_t m_entry_data{};
 };
 
+/// Facade/wrapper for the data containers of the compact bin storage to fit
+/// in the grid collection
+///
+/// The bins are stored in CSR format: The entries of all bins are stored back
+/// to back and the entries of bin i are found in the range
+/// [offsets[i], offsets[i + 1]). The offsets container therefore holds one
+/// more element than there are bins.
+template <typename index_t, typename containers>
+struct compact_bin_container {
+
+    template <typename T>
+    using vector_t = typename containers::template vector_type<T>;
+
+    vector_t<dindex> offsets{};
+    vector_t<index_t> entries{};
+
+    // Vecmem based view type
+    using view_type =
+        dmulti_view<dvector_view<dindex>, dvector_view<index_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const dindex>, dvector_view<const index_t>>;
+
+    // Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<dindex>, dvector_buffer<index_t>>;
+
+    constexpr compact_bin_container() = default;
+    DETRAY_HOST
+    compact_bin_container(vecmem::memory_resource* resource)
+        : offsets{resource}, entries{resource} {}
+    compact_bin_container(const compact_bin_container& other) = default;
+    compact_bin_container(compact_bin_container&& other) = default;
+
+    compact_bin_container& operator=(const compact_bin_container&) = default;
+    compact_bin_container& operator=(compact_bin_container&&) = default;
+
+    /// Device-side construction from a vecmem based view type
+    template <typename view_t,
+              typename std::enable_if_t<detail::is_device_view_v<view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE compact_bin_container(view_t& view)
+        : offsets(detail::get<0>(view.m_view)),
+          entries(detail::get<1>(view.m_view)) {}
+
+    /// Insert bin data at the end
+    template <typename grid_bin_range_t>
+    DETRAY_HOST void append(const grid_bin_range_t& grid_bins) {
+
+        const auto& g_offsets = grid_bins.bin_data();
+        const auto& g_entries = grid_bins.entry_data();
+
+        // The closing offset of the previous grid is the opening offset of
+        // the new grid
+        const auto shift{static_cast<dindex>(entries.size())};
+        if (offsets.empty()) {
+            offsets.push_back(0u);
+        }
+        for (std::size_t i = 1u; i < g_offsets.size(); ++i) {
+            offsets.push_back(g_offsets[i] + shift);
+        }
+
+        entries.insert(entries.end(), g_entries.begin(), g_entries.end());
+    }
+
+    /// @returns a vecmem view on the bin data - non-const
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(offsets), detray::get_data(entries)};
+    }
+
+    /// @returns a vecmem view on the bin data - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(offsets),
+                               detray::get_data(entries)};
+    }
+
+    /// @returns the number of bins
+    DETRAY_HOST_DEVICE
+    std::size_t size() const {
+        return offsets.empty() ? 0u : offsets.size() - 1u;
+    }
+
+    /// Clear out all data
+    DETRAY_HOST
+    void clear() {
+        offsets.clear();
+        entries.clear();
+    }
+};
+
+/// @brief bin data state of a grid with compact, read-only bins
+///
+/// Can be data-owning or not. Does not contain the data of the axes,
+/// as that is managed by the multi-axis type directly.
+template <bool is_owning, typename index_t, typename containers>
+class bin_storage<is_owning, detray::bins::compact_array<index_t>, containers>
+    : public detray::ranges::view_interface<bin_storage<
+          is_owning, detray::bins::compact_array<index_t>, containers>> {
+
+    template <typename T>
+    using vector_t = typename containers::template vector_type<T>;
+    using bin_t = detray::bins::compact_array<index_t>;
+    using offset_range_t =
+        std::conditional_t<is_owning, vector_t<dindex>,
+                           detray::ranges::subrange<vector_t<dindex>>>;
+    using offset_iterator_t =
+        typename detray::ranges::const_iterator_t<offset_range_t>;
+
+    using entry_range_t =
+        std::conditional_t<is_owning, vector_t<index_t>,
+                           detray::ranges::subrange<vector_t<index_t>>>;
+
+    /// Iterator adapter that makes sure the bin storage returns a correctly
+    /// initialized bin instance
+    struct iterator_adapter {
+        using difference_type =
+            typename std::iterator_traits<offset_iterator_t>::difference_type;
+        using value_type = bin_t;
+        using pointer = bin_t*;
+        using reference = bin_t&;
+        using iterator_category =
+            typename std::iterator_traits<offset_iterator_t>::iterator_category;
+
+        DETRAY_HOST_DEVICE
+        iterator_adapter(offset_iterator_t&& itr, const index_t* entry_data)
+            : m_entry_data{entry_data}, m_itr{std::move(itr)} {}
+
+        /// Wrap iterator functionality
+        /// @{
+        DETRAY_HOST_DEVICE bool operator==(
+            const iterator_adapter& other) const {
+            return m_itr == other.m_itr;
+        }
+        DETRAY_HOST_DEVICE bool operator!=(
+            const iterator_adapter& other) const {
+            return m_itr != other.m_itr;
+        }
+        DETRAY_HOST_DEVICE iterator_adapter& operator++() {
+            ++m_itr;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE iterator_adapter& operator--() {
+            --m_itr;
+            return *this;
+        }
+        DETRAY_HOST_DEVICE
+        difference_type operator-(const iterator_adapter& other) {
+            return m_itr - other.m_itr;
+        }
+        DETRAY_HOST_DEVICE
+        iterator_adapter operator-(difference_type i) {
+            return {m_itr - i, m_entry_data};
+        }
+        DETRAY_HOST_DEVICE
+        iterator_adapter operator+(difference_type i) {
+            return {m_itr + i, m_entry_data};
+        }
+        DETRAY_HOST_DEVICE
+        constexpr decltype(auto) operator[](const difference_type i) const {
+            return *(*this + i);
+        }
+        DETRAY_HOST_DEVICE
+        constexpr decltype(auto) operator[](const difference_type i) {
+            return *(*this + i);
+        }
+        /// @}
+
+        /// Construct and @returns a bin on the fly from two consecutive
+        /// offsets
+        DETRAY_HOST_DEVICE
+        constexpr auto operator*() const {
+            return bin_t{m_entry_data + *m_itr, m_entry_data + *(m_itr + 1)};
+        }
+
+        private:
+        /// Access to the bin content
+        const index_t* m_entry_data;
+        /// Iterator over the bin offsets
+        offset_iterator_t m_itr;
+    };
+
+    public:
+    /// Bin type: compact_array
+    using bin_type = bin_t;
+    /// Backend storage type for the grid
+    using bin_container_type = compact_bin_container<index_t, containers>;
+
+    // Vecmem based view type
+    using view_type = dmulti_view<dvector_view<dindex>, dvector_view<index_t>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const dindex>, dvector_view<const index_t>>;
+
+    // Vecmem based buffer type
+    using buffer_type =
+        dmulti_buffer<dvector_buffer<dindex>, dvector_buffer<index_t>>;
+
+    /// Default constructor
+    bin_storage() = default;
+    /// Copy constructor
+    bin_storage(const bin_storage&) = default;
+    /// Move constructor
+    bin_storage(bin_storage&&) = default;
+
+    /// Construct containers using a memory resources
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST bin_storage(vecmem::memory_resource& resource)
+        : m_offsets(&resource), m_entry_data(&resource) {}
+
+    /// Construct grid data from containers - move
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(bin_container_type&& bin_data)
+        : m_offsets(std::move(bin_data.offsets)),
+          m_entry_data(std::move(bin_data.entries)) {}
+
+    /// Construct the non-owning type from the @param offset into the global
+    /// containers @param bin_data and the number of bins @param size
+    template <bool owner = is_owning, std::enable_if_t<!owner, bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(bin_container_type& bin_data, dindex offset,
+                                   dindex size)
+        : m_offsets(bin_data.offsets,
+                    dindex_range{offset, offset + size + 1u}),
+          m_entry_data(
+              bin_data.entries,
+              dindex_range{0u, static_cast<dindex>(bin_data.entries.size())}) {}
+
+    /// Construct bin storage from its vecmem view
+    template <typename view_t,
+              typename std::enable_if_t<detail::is_device_view_v<view_t>,
+                                        bool> = true>
+    DETRAY_HOST_DEVICE bin_storage(const view_t& view)
+        : m_offsets(detray::detail::get<0>(view.m_view)),
+          m_entry_data(detray::detail::get<1>(view.m_view)) {}
+
+    /// Copy assignment
+    bin_storage& operator=(const bin_storage&) = default;
+    /// Move assignment
+    bin_storage& operator=(bin_storage&&) = default;
+
+    const offset_range_t& bin_data() const { return m_offsets; }
+    const entry_range_t& entry_data() const { return m_entry_data; }
+
+    /// begin and end of the bin range (the bins are read-only)
+    /// @{
+    DETRAY_HOST_DEVICE
+    auto begin() const {
+        return iterator_adapter{detray::ranges::cbegin(m_offsets),
+                                m_entry_data.data()};
+    }
+    DETRAY_HOST_DEVICE
+    auto end() const {
+        // The last offset only closes the last bin
+        return iterator_adapter{
+            detray::ranges::cbegin(m_offsets) +
+                static_cast<typename iterator_adapter::difference_type>(
+                    n_bins()),
+            m_entry_data.data()};
+    }
+    /// @}
+
+    /// @returns the vecmem view of the bin storage
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST auto get_data() -> view_type {
+        return view_type{detray::get_data(m_offsets),
+                         detray::get_data(m_entry_data)};
+    }
+
+    /// @returns the vecmem view of the bin storage - const
+    template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return const_view_type{detray::get_data(m_offsets),
+                               detray::get_data(m_entry_data)};
+    }
+
+    private:
+    /// @returns the number of bins
+    DETRAY_HOST_DEVICE
+    dindex n_bins() const {
+        const auto n_offsets{static_cast<dindex>(m_offsets.size())};
+        return n_offsets == 0u ? 0u : n_offsets - 1u;
+    }
+
+    /// Bin offsets into the entry container when owning or a view into an
+    /// externally owned container
+    offset_range_t m_offsets{};
+    /// Container that holds all bin entries when owning or a view into an
+    /// externally owned container
+    entry_range_t m_entry_data{};
+};
+
 }  // namespace detray::detail
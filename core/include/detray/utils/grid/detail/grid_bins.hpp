@@ -325,4 +325,52 @@ dynamic_array(const entry_t* bin_storage, const data_t& bin_data)
     -> dynamic_array<entry_t>;
 /// @}
 
+/// @brief Read-only bin that views a contiguous range of narrow entry indices
+///
+/// Used by the compact bin storage, where the bin contents are stored back to
+/// back (CSR layout) and the bin range is given by two consecutive offsets.
+/// The entries are indices into an external collection, e.g. the surface
+/// lookup of the detector, and are typically 16 or 32 bit wide.
+template <typename index_t>
+class compact_array
+    : public detray::ranges::view_interface<compact_array<index_t>> {
+
+    public:
+    using entry_type = index_t;
+    using entry_ptr_t = const entry_type*;
+
+    /// Default constructor: empty bin
+    constexpr compact_array() = default;
+
+    /// Construct from the range [@param first, @param last) in an externally
+    /// owned container of bin content
+    DETRAY_HOST_DEVICE
+    constexpr compact_array(entry_ptr_t first, entry_ptr_t last)
+        : m_begin{first}, m_end{last} {}
+
+    /// @returns iterator over bin content in start or end position
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr entry_ptr_t begin() const { return m_begin; }
+    DETRAY_HOST_DEVICE
+    constexpr entry_ptr_t end() const { return m_end; }
+    /// @}
+
+    /// @returns the number of entries in this bin
+    DETRAY_HOST_DEVICE
+    constexpr dindex size() const {
+        return static_cast<dindex>(m_end - m_begin);
+    }
+
+    /// The storage capacity of this bin (bin cannot be filled further)
+    DETRAY_HOST_DEVICE
+    constexpr dindex capacity() const noexcept { return size(); }
+
+    private:
+    /// First entry of the bin in the global storage
+    entry_ptr_t m_begin{nullptr};
+    /// Entry after the last entry of the bin in the global storage
+    entry_ptr_t m_end{nullptr};
+};
+
 }  // namespace detray::bins
@@ -0,0 +1,235 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/grid_axis.hpp"
+
+// System include(s).
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Serializer that lays out the grid bins in Z-order (Morton order)
+///
+/// Neighboring bins along every axis end up close to each other in memory,
+/// so that a neighborhood lookup (e.g. 3x3 bins in a phi-z cylinder grid)
+/// touches fewer cache lines than with the row-major @c simple_serializer.
+///
+/// The bins are grouped into tiles of 2^TILE_BITS bins per axis, which are
+/// laid out in Z-order internally. The tiles are ordered row-major (first
+/// axis varies fastest), and tiles at the upper axis boundaries that are not
+/// completely covered by the grid are laid out row-major as well. This way,
+/// the serialization stays dense for an arbitrary number of bins per axis and
+/// the grid needs no more storage than with the @c simple_serializer.
+///
+/// Bin indices on circular axes are folded (0, n-1, 1, n-2, ...) before
+/// the serialization, so that the bins across the wrap-around remain
+/// neighbors in memory as well.
+///
+/// @note the bin indices are expected to start at zero.
+template <std::size_t kDIM>
+struct morton_serializer {
+
+    /// Number of bits of the local bin index per tile and axis
+    static constexpr dindex tile_bits{kDIM >= 3u ? 2u : 3u};
+    /// Number of bins per axis in a tile
+    static constexpr dindex tile_size{1u << tile_bits};
+
+    /// @brief Create a serial bin from a multi-bin
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(
+        multi_axis_t &axes, typename multi_axis_t::loc_bin_index mbin) const
+        -> dindex {
+
+        const auto n_bins = axes.nbins_per_axis();
+        const auto is_circular = circular_axes<multi_axis_t>(
+            std::make_index_sequence<kDIM>{});
+
+        darray<dindex, kDIM> tile{};
+        darray<dindex, kDIM> local{};
+        darray<dindex, kDIM> extent{};
+        for (dindex d = 0u; d < kDIM; ++d) {
+            const dindex b{is_circular[d] ? fold(mbin[d], n_bins[d])
+                                          : mbin[d]};
+            tile[d] = b >> tile_bits;
+            local[d] = b & (tile_size - 1u);
+            extent[d] = tile_extent(tile[d], n_bins[d]);
+        }
+
+        // Number of bins in the preceding tiles
+        dindex gbin{0u};
+        for (dindex d = kDIM; d-- > 0u;) {
+            gbin += tile[d] * tile_stride(d, n_bins, extent);
+        }
+
+        return gbin + local_index(local, extent);
+    }
+
+    /// @brief Create a multi-bin from a serialized bin
+    ///
+    /// @tparam multi_axis_t is the type of multi-dimensional axis
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a kDIM-dimensional multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const ->
+        typename multi_axis_t::loc_bin_index {
+
+        const auto n_bins = axes.nbins_per_axis();
+        const auto is_circular = circular_axes<multi_axis_t>(
+            std::make_index_sequence<kDIM>{});
+
+        // Find the tile, starting with the slowest varying axis
+        darray<dindex, kDIM> tile{};
+        darray<dindex, kDIM> extent{};
+        for (dindex d = kDIM; d-- > 0u;) {
+            const dindex stride{tile_stride(d, n_bins, extent)};
+            tile[d] = gbin / stride;
+            gbin -= tile[d] * stride;
+            extent[d] = tile_extent(tile[d], n_bins[d]);
+        }
+
+        const darray<dindex, kDIM> local = local_bin(gbin, extent);
+
+        typename multi_axis_t::loc_bin_index mbin{};
+        for (dindex d = 0u; d < kDIM; ++d) {
+            const dindex b{tile[d] * tile_size + local[d]};
+            mbin[d] = is_circular[d] ? unfold(b, n_bins[d]) : b;
+        }
+
+        return mbin;
+    }
+
+    private:
+    /// @returns the number of bins of the tile @param t on an axis with
+    /// @param n bins
+    DETRAY_HOST_DEVICE
+    static constexpr dindex tile_extent(const dindex t, const dindex n) {
+        const dindex remaining{n - t * tile_size};
+        return remaining < tile_size ? remaining : tile_size;
+    }
+
+    /// @returns the number of bins that preceed a tile with index one along
+    /// the axis @param d, given the extents of the current tile along the
+    /// slower varying axes
+    template <typename loc_bin_t>
+    DETRAY_HOST_DEVICE static constexpr dindex tile_stride(
+        const dindex d, const loc_bin_t &n_bins,
+        const darray<dindex, kDIM> &extent) {
+        dindex stride{tile_size};
+        for (dindex k = 0u; k < d; ++k) {
+            stride *= n_bins[k];
+        }
+        for (dindex k = d + 1u; k < kDIM; ++k) {
+            stride *= extent[k];
+        }
+        return stride;
+    }
+
+    /// @returns true if the tile with extents @param extent is complete
+    DETRAY_HOST_DEVICE
+    static constexpr bool is_full(const darray<dindex, kDIM> &extent) {
+        bool full{true};
+        for (dindex d = 0u; d < kDIM; ++d) {
+            full &= (extent[d] == tile_size);
+        }
+        return full;
+    }
+
+    /// @returns the index of the bin @param local inside of a tile
+    DETRAY_HOST_DEVICE
+    static constexpr dindex local_index(const darray<dindex, kDIM> &local,
+                                        const darray<dindex, kDIM> &extent) {
+        dindex idx{0u};
+        if (is_full(extent)) {
+            // Interleave the bits of the local bin indices
+            for (dindex b = 0u; b < tile_bits; ++b) {
+                for (dindex d = 0u; d < kDIM; ++d) {
+                    idx |= ((local[d] >> b) & 1u) << (b * kDIM + d);
+                }
+            }
+        } else {
+            // Row-major in incomplete tiles
+            dindex stride{1u};
+            for (dindex d = 0u; d < kDIM; ++d) {
+                idx += local[d] * stride;
+                stride *= extent[d];
+            }
+        }
+        return idx;
+    }
+
+    /// @returns the local bin inside a tile from its index @param idx
+    DETRAY_HOST_DEVICE
+    static constexpr darray<dindex, kDIM> local_bin(
+        dindex idx, const darray<dindex, kDIM> &extent) {
+        darray<dindex, kDIM> local{};
+        if (is_full(extent)) {
+            for (dindex b = 0u; b < tile_bits; ++b) {
+                for (dindex d = 0u; d < kDIM; ++d) {
+                    local[d] |= ((idx >> (b * kDIM + d)) & 1u) << b;
+                }
+            }
+        } else {
+            for (dindex d = 0u; d < kDIM; ++d) {
+                local[d] = idx % extent[d];
+                idx /= extent[d];
+            }
+        }
+        return local;
+    }
+
+    /// Interleave the bin indices from both ends of a circular axis with
+    /// @param n bins: 0 -> 0, n-1 -> 1, 1 -> 2, n-2 -> 3 ...
+    DETRAY_HOST_DEVICE
+    static constexpr dindex fold(const dindex b, const dindex n) {
+        return (2u * b < n) ? 2u * b : 2u * (n - 1u - b) + 1u;
+    }
+
+    /// Inverse of @c fold
+    DETRAY_HOST_DEVICE
+    static constexpr dindex unfold(const dindex f, const dindex n) {
+        return (f % 2u == 0u) ? f / 2u : n - 1u - f / 2u;
+    }
+
+    /// @returns a flag for every axis (by label index), whether it is circular
+    template <typename multi_axis_t, std::size_t... I>
+    DETRAY_HOST_DEVICE static constexpr darray<bool, kDIM> circular_axes(
+        std::index_sequence<I...>) {
+        darray<bool, kDIM> is_circular{};
+        ((is_circular[static_cast<std::size_t>(
+              axis_bounds_t<multi_axis_t, I>::label)] =
+              (axis_bounds_t<multi_axis_t, I>::type ==
+               axis::bounds::e_circular)),
+         ...);
+        return is_circular;
+    }
+
+    /// Bounds type of the axis with index @tparam I
+    template <typename multi_axis_t, std::size_t I>
+    using axis_bounds_t = typename std::decay_t<
+        decltype(std::declval<const multi_axis_t &>()
+                     .template get_axis<I>())>::bounds_type;
+};
+
+}  // namespace detray
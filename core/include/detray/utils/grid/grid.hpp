@@ -9,9 +9,11 @@
 
 // Project include(s).
 #include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/detail/containers.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/grid/detail/axis.hpp"
 #include "detray/utils/grid/detail/axis_helpers.hpp"
+#include "detray/utils/grid/detail/bin_sequence.hpp"
 #include "detray/utils/grid/detail/bin_storage.hpp"
 #include "detray/utils/grid/detail/bin_view.hpp"
 #include "detray/utils/grid/populators.hpp"
@@ -23,11 +25,23 @@
 
 // System include(s).
 #include <array>
+#include <cassert>
 #include <cstddef>
 #include <type_traits>
 
 namespace detray {
 
+namespace detail {
+
+/// Placeholder for the baked search window of grids that cannot be baked
+struct no_baked_window {
+    constexpr no_baked_window() = default;
+    DETRAY_HOST_DEVICE
+    constexpr explicit no_baked_window(const darray<dindex, 2> &) {}
+};
+
+}  // namespace detail
+
 /// @brief An N-dimensional grid for object storage.
 ///
 /// @tparam axes_t the types of grid axes
@@ -60,6 +74,13 @@ class grid_impl {
 
     static constexpr bool is_owning{axes_type::is_owning};
 
+    /// Only bins with a dynamic capacity can hold their baked neighborhood
+    static constexpr bool is_bakeable{
+        std::is_same_v<bin_type, bins::dynamic_array<value_type>>};
+    using baked_window_type =
+        std::conditional_t<is_bakeable, darray<dindex, 2>,
+                           detail::no_baked_window>;
+
     /// How to define a neighborhood for this grid
     template <typename neighbor_t>
     using neighborhood_type = std::array<neighbor_t, dim>;
@@ -85,6 +106,10 @@ class grid_impl {
     using type =
         grid_impl<typename axes_t::template type<owning>, bin_t, serializer_t>;
 
+    /// Find the corresponding grid type with a different bin type
+    template <typename new_bin_t>
+    using rebind_bins = grid_impl<axes_t, new_bin_t, serializer_t>;
+
     /// Make grid default constructible: Empty grid with empty axis
     grid_impl() = default;
 
@@ -114,10 +139,12 @@ class grid_impl {
     // TODO: const correctnes
     DETRAY_HOST_DEVICE
     grid_impl(const bin_container_type *bin_data_ptr, axes_type &&axes,
-              const dindex offset = 0)
+              const dindex offset = 0,
+              const darray<dindex, 2> &baked_window = {0u, 0u})
         : m_bins(*(const_cast<bin_container_type *>(bin_data_ptr)), offset,
                  axes.nbins()),
-          m_axes(axes) {}
+          m_axes(axes),
+          m_baked_window(baked_window) {}
 
     /// Create grid from container pointers - non-owning (both grid and axes)
     DETRAY_HOST_DEVICE
@@ -159,6 +186,51 @@ class grid_impl {
         return m_axes.template get_axis<axis_t>();
     }
 
+    /// @returns the search window the bin content was baked with: Every bin
+    /// holds the unique entries of its neighborhood in this window.
+    DETRAY_HOST_DEVICE
+    constexpr auto baked_window() const -> darray<dindex, 2> {
+        if constexpr (is_bakeable) {
+            return m_baked_window;
+        } else {
+            return {0u, 0u};
+        }
+    }
+
+    /// @returns whether the bins contain their baked neighborhood
+    DETRAY_HOST_DEVICE
+    constexpr bool is_baked() const {
+        const darray<dindex, 2> win{baked_window()};
+        return win[0] > 0u || win[1] > 0u;
+    }
+
+    /// Mark the bin content as baked with the search window @param win
+    DETRAY_HOST
+    constexpr void set_baked_window(
+        [[maybe_unused]] const darray<dindex, 2> &win) {
+        if constexpr (is_bakeable) {
+            m_baked_window = win;
+        } else {
+            assert(win[0] == 0u && win[1] == 0u &&
+                   "The bins of this grid cannot be baked");
+        }
+    }
+
+    /// @returns the search window of the navigation config @param cfg for
+    /// a lookup in this grid: A baked bin already contains its (unique)
+    /// neighborhood, which was collected with a fixed search window
+    template <typename config_t>
+    DETRAY_HOST_DEVICE constexpr auto navigation_window(
+        const config_t &cfg) const -> darray<dindex, 2> {
+        if (is_baked()) {
+            assert(cfg.search_window[0] == baked_window()[0] &&
+                   cfg.search_window[1] == baked_window()[1] &&
+                   "Search window differs from the baked window of the grid");
+            return {0u, 0u};
+        }
+        return {cfg.search_window[0], cfg.search_window[1]};
+    }
+
     /// @returns the total number of bins in the grid
     DETRAY_HOST_DEVICE inline constexpr auto nbins() const -> dindex {
         return m_axes.nbins();
@@ -269,7 +341,8 @@ class grid_impl {
         return local_frame().global_to_local(trf, p, d);
     }
 
-    /// Interface for the navigator
+    /// Interface for the navigator: Lookup in the search window around the
+    /// track position
     template <typename detector_t, typename track_t, typename config_t>
     DETRAY_HOST_DEVICE auto search(
         const detector_t &det, const typename detector_t::volume_type &volume,
@@ -279,8 +352,58 @@ class grid_impl {
         const auto &trf = det.transform_store()[volume.transform()];
         const auto loc_pos = project(trf, track.pos(), track.dir());
 
-        // Grid lookup
-        return search(loc_pos, cfg.search_window);
+        return search(loc_pos, navigation_window(cfg));
+    }
+
+    /// Interface for the navigator: Lookup in the search window around the
+    /// track position, where every entry is returned only once
+    template <typename detector_t, typename track_t, typename config_t>
+    DETRAY_HOST_DEVICE auto search_unique(
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        const track_t &track, const config_t &cfg) const {
+
+        const auto &trf = det.transform_store()[volume.transform()];
+        const auto loc_pos = project(trf, track.pos(), track.dir());
+
+        // The entries of a baked bin are unique already
+        return axis::detail::bin_sequence_view<grid_impl>(
+            *this,
+            axis::detail::bin_sequence<grid_impl>{
+                *this, axes().bin_ranges(loc_pos, navigation_window(cfg))},
+            !is_baked());
+    }
+
+    /// Interface for the navigator: Lookup of the bins that are crossed by
+    /// the track up to the path length @param max_dist
+    template <typename detector_t, typename track_t>
+    DETRAY_HOST_DEVICE auto search_along(
+        const detector_t &det, const typename detector_t::volume_type &volume,
+        const track_t &track, const scalar_type max_dist) const {
+
+        const auto &trf = det.transform_store()[volume.transform()];
+
+        return search(trf, track.pos(), track.dir(), max_dist);
+    }
+
+    /// Find the values of all bins that are crossed by a straight line
+    ///
+    /// Every value is contained in the resulting range only once, even if it
+    /// was filled into multiple bins.
+    ///
+    /// @param trf the placement transform of the grid
+    /// @param p   the start point of the line in global coordinates
+    /// @param d   the direction of the line
+    /// @param max_dist the path length up to which the line is followed
+    ///
+    /// @return the iterable view of the bin contents
+    template <typename transform_t, typename point3_t, typename vector3_t>
+    DETRAY_HOST_DEVICE auto search(const transform_t &trf, const point3_t &p,
+                                   const vector3_t &d,
+                                   const scalar_type max_dist) const {
+        axis::detail::bin_sequence<grid_impl> bins{*this};
+        axis::detail::march(*this, trf, p, d, max_dist, bins);
+
+        return axis::detail::bin_sequence_view<grid_impl>(*this, bins, true);
     }
 
     /// Find the value of a single bin - const
@@ -321,6 +444,26 @@ class grid_impl {
         return detray::views::join(std::move(search_area));
     }
 
+    /// @brief Return a neighborhood of unique values from the grid
+    ///
+    /// The lookup is done with a search window around the bin. Values that
+    /// were filled into multiple bins of the window are returned only once.
+    ///
+    /// @param p is point in the local frame
+    /// @param win_size size of the binned/scalar search window
+    ///
+    /// @return the sequence of values
+    template <typename neighbor_t>
+    DETRAY_HOST_DEVICE auto search_unique(
+        const point_type &p, const std::array<neighbor_t, 2> &win_size) const {
+
+        return axis::detail::bin_sequence_view<grid_impl>(
+            *this,
+            axis::detail::bin_sequence<grid_impl>{
+                *this, axes().bin_ranges(p, win_size)},
+            true);
+    }
+
     /// Poupulate a bin with a single one of its corresponding values @param v
     /// @{
     /// @param mbin the multi bin index to be populated
@@ -372,6 +515,8 @@ class grid_impl {
     bin_storage m_bins{};
     /// The axes of the grid
     axes_type m_axes{};
+    /// Search window that was used to bake the bin content (zero: not baked)
+    [[no_unique_address]] baked_window_type m_baked_window{};
 };
 
 /// Type alias for easier construction
@@ -381,7 +526,7 @@ template <typename axes_t, typename bin_t,
           typename algebra_t = ALGEBRA_PLUGIN<detray::scalar>>
 using grid =
     grid_impl<coordinate_axes<axes_t, ownership, containers, algebra_t>, bin_t,
-              simple_serializer>;
+              serializer_t>;
 
 namespace detail {
 
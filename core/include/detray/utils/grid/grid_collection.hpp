@@ -8,6 +8,8 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/utils/grid/grid.hpp"
 
@@ -20,6 +22,21 @@
 
 namespace detray {
 
+namespace detail {
+
+/// Placeholder for the baked search windows of a collection of grids that
+/// cannot be baked
+struct no_baked_windows {
+    constexpr no_baked_windows() = default;
+    DETRAY_HOST explicit no_baked_windows(vecmem::memory_resource *) {}
+
+    DETRAY_HOST_DEVICE
+    constexpr void clear() noexcept { /*Nothing to clear*/
+    }
+};
+
+}  // namespace detail
+
 /// @brief A collection of grids that can be moved to device.
 ///
 /// @tparam grid_t The type of grid in this collection. Must be non-owning, so
@@ -55,6 +72,13 @@ class grid_collection<
     using edges_container_type = typename multi_axis_t::edges_container_type;
     template <typename T>
     using vector_type = typename multi_axis_t::template vector_type<T>;
+    using baked_window_container_type = vector_type<darray<dindex, 2>>;
+
+    /// Only keep the baked search windows for grids that can be baked
+    static constexpr bool is_bakeable{grid_type::is_bakeable};
+    using baked_window_storage =
+        std::conditional_t<is_bakeable, baked_window_container_type,
+                           detail::no_baked_windows>;
 
     private:
     /// @brief Iterator for the grid collection: Generates grids on the fly.
@@ -118,25 +142,43 @@ class grid_collection<
 
     public:
     /// Vecmem based grid collection view type
-    using view_type =
+    using view_type = std::conditional_t<
+        is_bakeable,
         dmulti_view<dvector_view<size_type>,
                     detail::get_view_t<bin_container_type>,
                     detail::get_view_t<edge_offset_container_type>,
-                    detail::get_view_t<edges_container_type>>;
+                    detail::get_view_t<edges_container_type>,
+                    detail::get_view_t<baked_window_container_type>>,
+        dmulti_view<dvector_view<size_type>,
+                    detail::get_view_t<bin_container_type>,
+                    detail::get_view_t<edge_offset_container_type>,
+                    detail::get_view_t<edges_container_type>>>;
 
     /// Vecmem based grid collection view type
-    using const_view_type =
+    using const_view_type = std::conditional_t<
+        is_bakeable,
         dmulti_view<dvector_view<const size_type>,
                     detail::get_view_t<const bin_container_type>,
                     detail::get_view_t<const edge_offset_container_type>,
-                    detail::get_view_t<const edges_container_type>>;
+                    detail::get_view_t<const edges_container_type>,
+                    detail::get_view_t<const baked_window_container_type>>,
+        dmulti_view<dvector_view<const size_type>,
+                    detail::get_view_t<const bin_container_type>,
+                    detail::get_view_t<const edge_offset_container_type>,
+                    detail::get_view_t<const edges_container_type>>>;
 
     /// Vecmem based buffer type
-    using buffer_type =
+    using buffer_type = std::conditional_t<
+        is_bakeable,
+        dmulti_buffer<dvector_buffer<size_type>,
+                      detail::get_buffer_t<bin_container_type>,
+                      detail::get_buffer_t<edge_offset_container_type>,
+                      detail::get_buffer_t<edges_container_type>,
+                      detail::get_buffer_t<baked_window_container_type>>,
         dmulti_buffer<dvector_buffer<size_type>,
                       detail::get_buffer_t<bin_container_type>,
                       detail::get_buffer_t<edge_offset_container_type>,
-                      detail::get_buffer_t<edges_container_type>>;
+                      detail::get_buffer_t<edges_container_type>>>;
 
     /// Make grid collection default constructible: Empty
     grid_collection() = default;
@@ -147,17 +189,20 @@ class grid_collection<
         : m_bin_offsets(resource),
           m_bins(resource),
           m_bin_edge_offsets(resource),
-          m_bin_edges(resource) {}
+          m_bin_edges(resource),
+          m_baked_windows(resource) {}
 
     /// Create grid colection from existing data - move
     DETRAY_HOST_DEVICE
     grid_collection(vector_type<size_type> &&offs, bin_container_type &&bins,
                     edge_offset_container_type &&edge_offs,
-                    edges_container_type &&edges)
+                    edges_container_type &&edges,
+                    baked_window_storage &&baked_windows = {})
         : m_bin_offsets(std::move(offs)),
           m_bins(std::move(bins)),
           m_bin_edge_offsets(std::move(edge_offs)),
-          m_bin_edges(std::move(edges)) {}
+          m_bin_edges(std::move(edges)),
+          m_baked_windows(std::move(baked_windows)) {}
 
     /// Device-side construction from a vecmem based view type
     template <typename coll_view_t,
@@ -167,14 +212,16 @@ class grid_collection<
         : m_bin_offsets(detail::get<0>(view.m_view)),
           m_bins(detail::get<1>(view.m_view)),
           m_bin_edge_offsets(detail::get<2>(view.m_view)),
-          m_bin_edges(detail::get<3>(view.m_view)) {}
+          m_bin_edges(detail::get<3>(view.m_view)),
+          m_baked_windows(baked_windows_from(view)) {}
 
     /// Move constructor
     DETRAY_HOST_DEVICE grid_collection(grid_collection &&other) noexcept
         : m_bin_offsets(std::move(other.m_bin_offsets)),
           m_bins(std::move(other.m_bins)),
           m_bin_edge_offsets(std::move(other.m_bin_edge_offsets)),
-          m_bin_edges(std::move(other.m_bin_edges)) {}
+          m_bin_edges(std::move(other.m_bin_edges)),
+          m_baked_windows(std::move(other.m_baked_windows)) {}
 
     /// Move assignment
     DETRAY_HOST_DEVICE grid_collection &operator=(
@@ -184,6 +231,7 @@ class grid_collection<
             m_bins = std::move(other.m_bins);
             m_bin_edge_offsets = std::move(other.m_bin_edge_offsets);
             m_bin_edges = std::move(other.m_bin_edges);
+            m_baked_windows = std::move(other.m_baked_windows);
         }
         return *this;
     }
@@ -227,6 +275,7 @@ class grid_collection<
         m_bins.clear();
         m_bin_edge_offsets.clear();
         m_bin_edges.clear();
+        m_baked_windows.clear();
     }
 
     /// Insert a number of grids
@@ -264,26 +313,50 @@ class grid_collection<
     DETRAY_HOST_DEVICE
     auto operator[](const size_type i) const -> grid_type {
         const size_type axes_offset{grid_type::dim * i};
-        return grid_type(
-            &m_bins, multi_axis_t(m_bin_edge_offsets, m_bin_edges, axes_offset),
-            m_bin_offsets[i]);
+        multi_axis_t axes(m_bin_edge_offsets, m_bin_edges, axes_offset);
+
+        if constexpr (is_bakeable) {
+            // Collections that were assembled without the baking information
+            return grid_type(&m_bins, std::move(axes), m_bin_offsets[i],
+                             i < m_baked_windows.size()
+                                 ? m_baked_windows[i]
+                                 : darray<dindex, 2>{0u, 0u});
+        } else {
+            return grid_type(&m_bins, std::move(axes), m_bin_offsets[i]);
+        }
     }
 
     /// @returns a vecmem view on the grid collection data - non-const
     DETRAY_HOST auto get_data() -> view_type {
-        return view_type{detray::get_data(m_bin_offsets),
-                         detray::get_data(m_bins),
-                         detray::get_data(m_bin_edge_offsets),
-                         detray::get_data(m_bin_edges)};
+        if constexpr (is_bakeable) {
+            return view_type{detray::get_data(m_bin_offsets),
+                             detray::get_data(m_bins),
+                             detray::get_data(m_bin_edge_offsets),
+                             detray::get_data(m_bin_edges),
+                             detray::get_data(m_baked_windows)};
+        } else {
+            return view_type{detray::get_data(m_bin_offsets),
+                             detray::get_data(m_bins),
+                             detray::get_data(m_bin_edge_offsets),
+                             detray::get_data(m_bin_edges)};
+        }
     }
 
     /// @returns a vecmem view on the grid collection data - const
     DETRAY_HOST
     auto get_data() const -> const_view_type {
-        return const_view_type{detray::get_data(m_bin_offsets),
-                               detray::get_data(m_bins),
-                               detray::get_data(m_bin_edge_offsets),
-                               detray::get_data(m_bin_edges)};
+        if constexpr (is_bakeable) {
+            return const_view_type{detray::get_data(m_bin_offsets),
+                                   detray::get_data(m_bins),
+                                   detray::get_data(m_bin_edge_offsets),
+                                   detray::get_data(m_bin_edges),
+                                   detray::get_data(m_baked_windows)};
+        } else {
+            return const_view_type{detray::get_data(m_bin_offsets),
+                                   detray::get_data(m_bins),
+                                   detray::get_data(m_bin_edge_offsets),
+                                   detray::get_data(m_bin_edges)};
+        }
     }
 
     /// Add a new grid @param gr to the collection.
@@ -318,9 +391,24 @@ class grid_collection<
         const auto &bin_edges = gr.axes().bin_edges();
         m_bin_edges.insert(m_bin_edges.end(), bin_edges.begin(),
                            bin_edges.end());
+
+        if constexpr (is_bakeable) {
+            m_baked_windows.push_back(gr.baked_window());
+        }
     }
 
     private:
+    /// @returns the baked search windows from the collection @param view
+    template <typename coll_view_t>
+    DETRAY_HOST_DEVICE static auto baked_windows_from(coll_view_t &view)
+        -> baked_window_storage {
+        if constexpr (is_bakeable) {
+            return baked_window_storage(detail::get<4>(view.m_view));
+        } else {
+            return {};
+        }
+    }
+
     /// Insert data into a vector of bins
     template <typename grid_bin_range_t>
     DETRAY_HOST void insert_bin_data(
@@ -338,6 +426,15 @@ class grid_collection<
         bin_data.append(grid_bins);
     }
 
+    /// Insert data into the backend containers of a grid with compact bins
+    template <typename index_t, typename container_t,
+              typename grid_bin_range_t>
+    DETRAY_HOST void insert_bin_data(
+        detray::detail::compact_bin_container<index_t, container_t> &bin_data,
+        const grid_bin_range_t &grid_bins) {
+        bin_data.append(grid_bins);
+    }
+
     /// Offsets for the respective grids into the bin storage
     vector_type<size_type> m_bin_offsets{};
     /// Contains the bin content for all grids
@@ -346,6 +443,9 @@ class grid_collection<
     edge_offset_container_type m_bin_edge_offsets{};
     /// Contains the bin edges for all grids
     edges_container_type m_bin_edges{};
+    /// Search window that was used to bake the bins of every grid (only for
+    /// grids that can be baked)
+    [[no_unique_address]] baked_window_storage m_baked_windows{};
 };
 
 }  // namespace detray
@@ -8,4 +8,36 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/utils/grid/detail/morton_serializer.hpp"
 #include "detray/utils/grid/detail/simple_serializer.hpp"
+
+// System include(s).
+#include <cstddef>
+
+namespace detray {
+
+namespace detail {
+
+/// Get the bin layout id of a serializer type (e.g. for the IO)
+template <typename serializer_t>
+struct bin_layout_of;
+
+template <std::size_t DIM>
+struct bin_layout_of<simple_serializer<DIM>> {
+    static constexpr axis::bin_layout value{axis::bin_layout::e_simple};
+};
+
+template <std::size_t DIM>
+struct bin_layout_of<morton_serializer<DIM>> {
+    static constexpr axis::bin_layout value{axis::bin_layout::e_morton};
+};
+
+}  // namespace detail
+
+/// @returns the bin layout id of the serializer type @tparam serializer_t
+template <typename serializer_t>
+inline constexpr axis::bin_layout bin_layout_v{
+    detail::bin_layout_of<serializer_t>::value};
+
+}  // namespace detray
@@ -13,8 +13,8 @@
 #endif
 
 // Project include(s)
-#include "detray/geometry/tracking_surface.hpp"
 #include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection/navigation_candidate.hpp"
 #include "detray/navigation/navigation_config.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/base_actor.hpp"
@@ -206,10 +206,9 @@ struct print_inspector {
 
         using geo_ctx_t = typename state_type::detector_type::geometry_context;
         for (const auto &sf_cand : state.candidates()) {
-            const auto &local = sf_cand.local;
-            const auto pos =
-                tracking_surface{*state.detector(), sf_cand.sf_desc}
-                    .local_to_global(geo_ctx_t{}, local, track_dir);
+            const auto pos = detray::detail::candidate_position(
+                *state.detector(), geo_ctx_t{}, sf_cand, track_pos,
+                track_dir);
 
             debug_stream << sf_cand;
             debug_stream << ", glob: [r:" << getter::perp(pos)
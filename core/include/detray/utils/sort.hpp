@@ -60,4 +60,48 @@ DETRAY_HOST_DEVICE inline void selection_sort(vector_t<TYPE> &vec) {
     selection_sort(vec.begin(), vec.end());
 }
 
+/// Insertion sort by shifting the elements, which runs in linear time on
+/// (almost) sorted ranges and does not need any std algorithms
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void shift_insertion_sort(RandomIt first,
+                                                    RandomIt last,
+                                                    Comp &&comp = Comp()) {
+    if (first == last) {
+        return;
+    }
+    for (RandomIt i = first + 1; i < last; ++i) {
+        auto t = *i;
+        RandomIt j = i;
+        for (; j > first && comp(t, *(j - 1)); --j) {
+            *j = *(j - 1);
+        }
+        *j = t;
+    }
+}
+
+/// Partial selection sort: Moves the smallest (middle - first) elements of
+/// the range in sorted order to the front. The order of the remaining
+/// elements is unspecified.
+template <class RandomIt, class Comp = std::less<void>>
+DETRAY_HOST_DEVICE inline void partial_selection_sort(RandomIt first,
+                                                      RandomIt middle,
+                                                      RandomIt last,
+                                                      Comp &&comp = Comp()) {
+    for (RandomIt i = first; i < middle && i < (last - 1); ++i) {
+        RandomIt k = i;
+
+        for (RandomIt j = i + 1; j < last; ++j) {
+            if (comp(*j, *k)) {
+                k = j;
+            }
+        }
+
+        if (k != i) {
+            auto t = *i;
+            *i = *k;
+            *k = t;
+        }
+    }
+}
+
 }  // namespace detray
@@ -0,0 +1,248 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace detray {
+
+/// @brief Persistent host thread pool with work stealing.
+///
+/// The items of a @c parallel_for call are grouped into chunks, which are
+/// distributed evenly over the worker queues up front. Every worker drains
+/// its own queue from the front and, once it runs dry, steals chunks from the
+/// back of the other queues. This keeps the load balanced when the cost per
+/// item varies strongly (e.g. tracks that leave the detector early).
+///
+/// The calling thread participates as worker zero, so a pool of size one
+/// does not spawn any threads.
+class thread_pool {
+
+    public:
+    /// Construct a pool of @param n_threads workers (zero selects the number
+    /// of hardware threads)
+    DETRAY_HOST
+    explicit thread_pool(std::size_t n_threads = 0u)
+        : m_n_workers{n_threads == 0u
+                          ? std::max(std::size_t{1u},
+                                     static_cast<std::size_t>(
+                                         std::thread::hardware_concurrency()))
+                          : n_threads},
+          m_queues{std::make_unique<work_queue[]>(m_n_workers)} {
+
+        m_threads.reserve(m_n_workers - 1u);
+        for (std::size_t i = 1u; i < m_n_workers; ++i) {
+            m_threads.emplace_back([this, i]() { worker_loop(i); });
+        }
+    }
+
+    /// No copies or moves: the workers hold a pointer to the pool
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    /// Stop and join all worker threads
+    DETRAY_HOST
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start_cv.notify_all();
+        for (auto &t : m_threads) {
+            t.join();
+        }
+    }
+
+    /// @returns the number of workers, including the calling thread
+    DETRAY_HOST
+    std::size_t size() const { return m_n_workers; }
+
+    /// Call @param f for every item index in [0, n_items) and block until
+    /// all items are processed.
+    ///
+    /// @param n_items number of work items
+    /// @param chunk_size number of consecutive items a worker takes at once
+    /// @param f callable with signature f(worker_index, item_index)
+    ///
+    /// @note the first exception thrown by @param f stops the distribution of
+    /// further chunks and is rethrown in the calling thread.
+    template <typename func_t>
+    DETRAY_HOST void parallel_for(const std::size_t n_items,
+                                  const std::size_t chunk_size, func_t &&f) {
+        if (n_items == 0u) {
+            return;
+        }
+
+        m_n_items = n_items;
+        m_chunk_size = std::max(std::size_t{1u}, chunk_size);
+        m_job = std::ref(f);
+        m_abort.store(false);
+        m_error = nullptr;
+
+        // Distribute the chunks evenly over the worker queues
+        const std::size_t n_chunks{(n_items + m_chunk_size - 1u) /
+                                   m_chunk_size};
+        const std::size_t per_worker{n_chunks / m_n_workers};
+        const std::size_t remainder{n_chunks % m_n_workers};
+
+        std::size_t first{0u};
+        for (std::size_t w = 0u; w < m_n_workers; ++w) {
+            const std::size_t n{per_worker + (w < remainder ? 1u : 0u)};
+            std::lock_guard<std::mutex> lock(m_queues[w].mutex);
+            m_queues[w].begin = first;
+            m_queues[w].end = first + n;
+            first += n;
+        }
+
+        // Wake up the workers
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_n_busy = m_n_workers - 1u;
+            ++m_generation;
+        }
+        m_start_cv.notify_all();
+
+        // The calling thread is worker zero
+        run_worker(0u);
+
+        // Wait for the other workers to finish
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done_cv.wait(lock, [this]() { return m_n_busy == 0u; });
+        }
+
+        m_job = nullptr;
+
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+    private:
+    /// Range of chunk indices that is owned by a worker
+    struct alignas(64) work_queue {
+        std::mutex mutex;
+        std::size_t begin{0u};
+        std::size_t end{0u};
+    };
+
+    /// Wait for work until the pool is destroyed
+    DETRAY_HOST
+    void worker_loop(const std::size_t worker_idx) {
+        std::size_t seen_generation{0u};
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start_cv.wait(lock, [this, seen_generation]() {
+                    return m_stop or m_generation != seen_generation;
+                });
+                if (m_stop) {
+                    return;
+                }
+                seen_generation = m_generation;
+            }
+
+            run_worker(worker_idx);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_n_busy == 0u) {
+                    m_done_cv.notify_one();
+                }
+            }
+        }
+    }
+
+    /// Process chunks until no queue has any work left
+    DETRAY_HOST
+    void run_worker(const std::size_t worker_idx) {
+        std::size_t chunk{0u};
+        while (not m_abort.load(std::memory_order_relaxed) and
+               (pop(worker_idx, chunk) or steal(worker_idx, chunk))) {
+
+            const std::size_t first{chunk * m_chunk_size};
+            const std::size_t last{std::min(first + m_chunk_size, m_n_items)};
+
+            try {
+                for (std::size_t i = first; i < last; ++i) {
+                    m_job(worker_idx, i);
+                }
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (not m_error) {
+                    m_error = std::current_exception();
+                }
+                m_abort.store(true);
+            }
+        }
+    }
+
+    /// Take the next chunk from the front of the own queue
+    DETRAY_HOST
+    bool pop(const std::size_t worker_idx, std::size_t &chunk) {
+        work_queue &q = m_queues[worker_idx];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.begin == q.end) {
+            return false;
+        }
+        chunk = q.begin++;
+        return true;
+    }
+
+    /// Take a chunk from the back of another worker's queue
+    DETRAY_HOST
+    bool steal(const std::size_t worker_idx, std::size_t &chunk) {
+        for (std::size_t i = 1u; i < m_n_workers; ++i) {
+            work_queue &q = m_queues[(worker_idx + i) % m_n_workers];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.begin != q.end) {
+                chunk = --q.end;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Number of workers, including the calling thread
+    std::size_t m_n_workers;
+    /// One queue of chunk indices per worker
+    std::unique_ptr<work_queue[]> m_queues;
+    /// Background workers
+    std::vector<std::thread> m_threads{};
+
+    /// Current job
+    std::function<void(std::size_t, std::size_t)> m_job{};
+    std::size_t m_n_items{0u};
+    std::size_t m_chunk_size{1u};
+    std::atomic<bool> m_abort{false};
+    std::exception_ptr m_error{nullptr};
+
+    /// Synchronization of job dispatch and completion
+    std::mutex m_mutex;
+    std::condition_variable m_start_cv;
+    std::condition_variable m_done_cv;
+    std::size_t m_generation{0u};
+    std::size_t m_n_busy{0u};
+    bool m_stop{false};
+};
+
+}  // namespace detray
@@ -12,6 +12,7 @@
 
 // System include(s)
 #include <type_traits>
+#include <utility>
 
 namespace detray::detail {
 
@@ -154,6 +155,13 @@ struct is_material_map : public std::false_type {};
 template <typename T>
 inline constexpr bool is_material_map_v = is_material_map<T>::value;
 
+template <class material_t, typename = void>
+struct is_indexed_material_map : public std::false_type {};
+
+template <typename T>
+inline constexpr bool is_indexed_material_map_v =
+    is_indexed_material_map<T>::value;
+
 template <class material_t, typename = void>
 struct is_volume_material : public std::false_type {};
 
@@ -166,4 +174,64 @@ struct is_surface_material : public std::false_type {};
 template <typename T>
 inline constexpr bool is_surface_material_v = is_surface_material<T>::value;
 
+/// Helper trait that checks if a magnetic field type provides the field
+/// gradient at a position (x, y, z) as 'gradient(x, y, z)'
+/// @{
+template <typename field_t, typename scalar_t, typename = void>
+struct has_field_gradient : public std::false_type {};
+
+template <typename field_t, typename scalar_t>
+struct has_field_gradient<
+    field_t, scalar_t,
+    std::void_t<decltype(std::declval<const field_t &>().gradient(
+        std::declval<scalar_t>(), std::declval<scalar_t>(),
+        std::declval<scalar_t>()))>> : public std::true_type {};
+
+template <typename field_t, typename scalar_t>
+inline constexpr bool has_field_gradient_v =
+    has_field_gradient<field_t, scalar_t>::value;
+/// @}
+
+/// Helper trait that checks if a navigation configuration provides the
+/// maximal mask tolerance as 'max_mask_tolerance'
+/// @{
+template <typename config_t, typename = void>
+struct has_max_mask_tolerance : public std::false_type {};
+
+template <typename config_t>
+struct has_max_mask_tolerance<
+    config_t, std::void_t<decltype(std::declval<const config_t &>()
+                                       .max_mask_tolerance)>>
+    : public std::true_type {};
+
+template <typename config_t>
+inline constexpr bool has_max_mask_tolerance_v =
+    has_max_mask_tolerance<config_t>::value;
+/// @}
+
+/// Helper trait that checks if a navigation configuration can request the
+/// deduplicated grid search via 'unique_grid_search'
+/// @{
+template <typename config_t, typename = void>
+struct has_unique_grid_search : public std::false_type {};
+
+template <typename config_t>
+struct has_unique_grid_search<
+    config_t, std::void_t<decltype(std::declval<const config_t &>()
+                                       .unique_grid_search)>>
+    : public std::true_type {};
+
+template <typename config_t>
+inline constexpr bool has_unique_grid_search_v =
+    has_unique_grid_search<config_t>::value;
+/// @}
+
+/// Helper trait that checks if a magnetic field type is constant over the
+/// detector (specialized together with the field types)
+template <typename field_t, typename = void>
+struct is_const_field : public std::false_type {};
+
+template <typename field_t>
+inline constexpr bool is_const_field_v = is_const_field<field_t>::value;
+
 }  // namespace detray::detail
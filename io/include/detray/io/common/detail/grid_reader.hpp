@@ -34,14 +34,12 @@ namespace detray::io::detail {
 /// @tparam CAP the storage capacity of a single bin
 /// @tparam DIM the dimension of the grid
 /// @tparam bin_filler_t helper to fill all bins of a grid
-/// @tparam serializer_t memory layout of the grid
 template <typename value_t,
           template <typename, typename, typename, typename>
           class grid_builder_t,
           typename CAP = std::integral_constant<std::size_t, 0>,
           typename DIM = std::integral_constant<std::size_t, 2>,
-          typename bin_filler_t = fill_by_pos,
-          template <std::size_t> class serializer_t = simple_serializer>
+          typename bin_filler_t = fill_by_pos>
 class grid_reader {
 
     /// IO accelerator ids do not need to coincide with the detector ids,
@@ -280,12 +278,48 @@ class grid_reader {
         }
     }
 
-    /// @brief End of recursion: build the grid from the @param grid_data
+    /// @brief recursively build the grid: find the memory layout of the bins
+    ///
+    /// @param grid_idx_and_data grid IO payload (read from file)
+    /// @param det_builder gather the grid data and build the final volume
     template <typename detector_t, typename local_frame_t, typename content_t,
               typename... bounds_ts, typename... binning_ts,
               std::enable_if_t<sizeof...(bounds_ts) == dim and
                                    sizeof...(binning_ts) == dim,
                                bool> = true>
+    static void convert(
+        const std::pair<dindex, grid_payload<content_t>> &grid_idx_and_data,
+        detector_builder<typename detector_t::metadata, volume_builder>
+            &det_builder,
+        types::list<bounds_ts...> bounds, types::list<binning_ts...> binnings) {
+
+        switch (grid_idx_and_data.second.layout) {
+            case axis::bin_layout::e_simple: {
+                return convert<detector_t, local_frame_t, simple_serializer>(
+                    grid_idx_and_data, det_builder, bounds, binnings);
+            }
+            case axis::bin_layout::e_morton: {
+                return convert<detector_t, local_frame_t, morton_serializer>(
+                    grid_idx_and_data, det_builder, bounds, binnings);
+            }
+            default: {
+                throw std::invalid_argument(
+                    "Given type id could not be matched to a grid bin "
+                    "layout: " +
+                    std::to_string(static_cast<std::int64_t>(
+                        grid_idx_and_data.second.layout)));
+                break;
+            }
+        };
+    }
+
+    /// @brief End of recursion: build the grid from the @param grid_data
+    template <typename detector_t, typename local_frame_t,
+              template <std::size_t> class serializer_t, typename content_t,
+              typename... bounds_ts, typename... binning_ts,
+              std::enable_if_t<sizeof...(bounds_ts) == dim and
+                                   sizeof...(binning_ts) == dim,
+                               bool> = true>
     static void convert(
         const std::pair<dindex, grid_payload<content_t>> &grid_idx_and_data,
         detector_builder<typename detector_t::metadata, volume_builder>
@@ -406,6 +440,11 @@ class grid_reader {
                     vgr_builder->get().template populate<attach<>>(mbin, entry);
                 }
             }
+
+            // The bins already contain their neighborhood
+            vgr_builder->get().set_baked_window(
+                {static_cast<dindex>(grid_data.baked_window[0]),
+                 static_cast<dindex>(grid_data.baked_window[1])});
         } else {
             types::print<types::list<grid_t>>();
             err_stream
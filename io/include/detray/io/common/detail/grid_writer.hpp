@@ -65,6 +65,9 @@ class grid_writer {
 
         grid_data.owner_link = detail::basic_converter::convert(owner_index);
         grid_data.grid_link = detail::basic_converter::convert(type, idx);
+        grid_data.layout = bin_layout_v<
+            typename grid_t::template serializer_type<grid_t::dim>>;
+        grid_data.baked_window = {gr.baked_window()[0], gr.baked_window()[1]};
 
         // Convert the multi-axis into single axis payloads
         const std::array<axis_payload, grid_t::dim> axes_data =
@@ -185,9 +188,22 @@ class grid_writer {
 
                 using value_t = typename coll_value_t::value_type;
 
-                auto gr_pyload = convert<content_t, value_t>(
-                    owner_link, io::detail::get_id<coll_value_t>(), index,
-                    coll[index], converter);
+                grid_payload<content_t, grid_id_t> gr_pyload{};
+                if constexpr (detray::detail::is_indexed_material_map_v<
+                                  coll_value_t>) {
+                    // Write the full material slabs from the material table
+                    auto slab_converter = [&coll,
+                                           &converter](const value_t& entry) {
+                        return converter(coll.slab(entry).to_slab());
+                    };
+                    gr_pyload = convert<content_t, value_t>(
+                        owner_link, io::detail::get_id<coll_value_t>(), index,
+                        coll[index], slab_converter);
+                } else {
+                    gr_pyload = convert<content_t, value_t>(
+                        owner_link, io::detail::get_id<coll_value_t>(), index,
+                        coll[index], converter);
+                }
 
                 auto& grids_map = grids_data.grids;
                 auto search = grids_map.find(vol_link);
@@ -13,6 +13,7 @@
 #include "detray/geometry/shapes.hpp"
 #include "detray/io/frontend/definitions.hpp"
 #include "detray/io/frontend/payloads.hpp"
+#include "detray/materials/indexed_material_map.hpp"
 #include "detray/materials/material_map.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
@@ -250,6 +251,15 @@ struct mask_info<io::shape_id::trapezoid2, detector_t,
 };
 /// @}
 
+/// Check whether the detector holds material maps of shape @tparam shape_t,
+/// with either full material slabs or indexed material in the bins
+template <typename shape_t, typename detector_t>
+inline constexpr bool has_material_map_v =
+    detector_t::materials::template is_defined<
+        material_map<shape_t, typename detector_t::scalar_type>>() ||
+    detector_t::materials::template is_defined<
+        indexed_material_map<shape_t, typename detector_t::scalar_type>>();
+
 /// Determine the type and id of a material map without triggering a compiler
 /// error (sfinae) if the detector does not know the type / enum entry
 /// @{
@@ -266,9 +276,7 @@ struct mat_map_info {
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::ring2_map, detector_t,
-    std::enable_if_t<detector_t::materials::template is_defined<material_map<
-                         ring2D, typename detector_t::scalar_type>>(),
-                     void>> {
+    std::enable_if_t<has_material_map_v<ring2D, detector_t>, void>> {
     using type = material_map<ring2D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
         detector_t::materials::id::e_disc2_map};
@@ -278,9 +286,7 @@ struct mat_map_info<
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::rectangle2_map, detector_t,
-    std::enable_if_t<detector_t::materials::template is_defined<material_map<
-                         rectangle2D, typename detector_t::scalar_type>>(),
-                     void>> {
+    std::enable_if_t<has_material_map_v<rectangle2D, detector_t>, void>> {
     using type = material_map<rectangle2D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
         detector_t::materials::id::e_rectangle2_map};
@@ -290,9 +296,7 @@ struct mat_map_info<
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::cuboid3_map, detector_t,
-    std::enable_if_t<detector_t::materials::template is_defined<material_map<
-                         cuboid3D, typename detector_t::scalar_type>>(),
-                     void>> {
+    std::enable_if_t<has_material_map_v<cuboid3D, detector_t>, void>> {
     using type = material_map<cuboid3D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
         detector_t::materials::id::e_cuboid3_map};
@@ -302,9 +306,7 @@ struct mat_map_info<
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::cylinder2_map, detector_t,
-    std::enable_if_t<detector_t::materials::template is_defined<material_map<
-                         cylinder2D, typename detector_t::scalar_type>>(),
-                     void>> {
+    std::enable_if_t<has_material_map_v<cylinder2D, detector_t>, void>> {
     using type = material_map<cylinder2D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
         detector_t::materials::id::e_cylinder2_map};
@@ -314,10 +316,8 @@ struct mat_map_info<
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::concentric_cylinder2_map, detector_t,
-    std::enable_if_t<
-        detector_t::materials::template is_defined<material_map<
-            concentric_cylinder2D, typename detector_t::scalar_type>>(),
-        void>> {
+    std::enable_if_t<has_material_map_v<concentric_cylinder2D, detector_t>,
+                     void>> {
     using type =
         material_map<concentric_cylinder2D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
@@ -328,9 +328,7 @@ struct mat_map_info<
 template <typename detector_t>
 struct mat_map_info<
     io::material_id::cylinder3_map, detector_t,
-    std::enable_if_t<detector_t::materials::template is_defined<material_map<
-                         cylinder3D, typename detector_t::scalar_type>>(),
-                     void>> {
+    std::enable_if_t<has_material_map_v<cylinder3D, detector_t>, void>> {
     using type = material_map<cylinder3D, typename detector_t::scalar_type>;
     static constexpr typename detector_t::materials::id value{
         detector_t::materials::id::e_cylinder3_map};
@@ -0,0 +1,118 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/utils/create_path.hpp"
+
+// DFE include(s).
+#include <dfe/dfe_io_dsv.hpp>
+#include <dfe/dfe_namedtuple.hpp>
+
+// System include(s).
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace detray::io::csv {
+
+/// Type to read the data of a simulated hit on a sensitive surface
+struct hit {
+
+    unsigned int event_id = 0u;
+    unsigned int track_id = 0u;
+    std::uint64_t geometry_id = 0ul;
+    double l0 = 0.;
+    double l1 = 0.;
+    double phi = 0.;
+    double theta = 0.;
+    double qop = 0.;
+    double t = 0.;
+
+    DFE_NAMEDTUPLE(hit, event_id, track_id, geometry_id, l0, l1, phi, theta,
+                   qop, t);
+};
+
+/// @brief Writes simulated hits to a csv file, one batch at a time.
+///
+/// The file is kept open, so that the hits can be streamed out while the
+/// simulation is running (e.g. as the sink of the @c fast_simulator).
+class hit_writer {
+
+    public:
+    /// Open the file @param file_name. Don't write over existing data, if
+    /// @param replace is false
+    explicit hit_writer(const std::string &file_name, const bool replace = true)
+        : m_writer{make_file_name(file_name, replace)} {}
+
+    /// Append a batch of @param hits to the file
+    template <typename hit_coll_t>
+    void operator()(const hit_coll_t &hits) {
+        for (const auto &h : hits) {
+            io::csv::hit hit_data{};
+
+            hit_data.event_id = h.event_id;
+            hit_data.track_id = h.track_id;
+            hit_data.geometry_id = h.surface.value();
+            hit_data.l0 = h.loc0;
+            hit_data.l1 = h.loc1;
+            hit_data.phi = h.phi;
+            hit_data.theta = h.theta;
+            hit_data.qop = h.qop;
+            hit_data.t = h.time;
+
+            m_writer.append(hit_data);
+        }
+        m_n_hits += hits.size();
+    }
+
+    /// @returns the number of hits that were written so far
+    std::size_t n_hits() const { return m_n_hits; }
+
+    private:
+    /// @returns the file name to write to and create the output directories
+    static std::string make_file_name(const std::string &file_name,
+                                      const bool replace) {
+        if (!replace && io::file_exists(file_name)) {
+            return io::alt_file_name(file_name);
+        }
+        // Make sure the output directories exit
+        io::create_path(std::filesystem::path{file_name}.parent_path());
+
+        return file_name;
+    }
+
+    dfe::NamedTupleCsvWriter<io::csv::hit> m_writer;
+    std::size_t m_n_hits{0u};
+};
+
+/// Read simulated hits from csv file
+/// @returns vector of hits in the order of the file
+inline auto read_hits(const std::string &file_name) {
+
+    dfe::NamedTupleCsvReader<io::csv::hit> hit_reader(file_name);
+
+    io::csv::hit hit_data{};
+    std::vector<io::csv::hit> hits;
+
+    while (hit_reader.read(hit_data)) {
+        hits.push_back(hit_data);
+    }
+
+    // Check the result
+    if (hits.empty()) {
+        throw std::invalid_argument(
+            "ERROR: csv reader: Failed to read hit data");
+    }
+
+    return hits;
+}
+
+}  // namespace detray::io::csv
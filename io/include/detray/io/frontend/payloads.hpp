@@ -201,6 +201,10 @@ struct grid_payload {
     std::vector<axis_payload> axes{};
     std::vector<grid_bin_payload<bin_content_t>> bins{};
     std::optional<transform_payload> transform;
+    // Memory layout of the bins (serializer)
+    axis::bin_layout layout{axis::bin_layout::e_simple};
+    // Search window that was baked into the bins (zero if not baked)
+    std::array<std::size_t, 2> baked_window{0u, 0u};
 };
 
 /// @brief A payload for the grid collections of a detector
@@ -91,6 +91,16 @@ inline void to_json(nlohmann::ordered_json& j,
     if (g.transform.has_value()) {
         j["transform"] = g.transform.value();
     }
+
+    // Only write the bin layout, if it is not the default
+    if (g.layout != axis::bin_layout::e_simple) {
+        j["layout"] = static_cast<unsigned int>(g.layout);
+    }
+
+    // Only write the baked search window, if the bins were baked
+    if (g.baked_window[0] > 0u || g.baked_window[1] > 0u) {
+        j["baked_window"] = g.baked_window;
+    }
 }
 
 template <typename content_t, typename grid_id_t>
@@ -115,6 +125,14 @@ inline void from_json(const nlohmann::ordered_json& j,
         g.transform.emplace();
         g.transform = j["transform"];
     }
+
+    if (j.find("layout") != j.end()) {
+        g.layout = static_cast<axis::bin_layout>(j["layout"]);
+    }
+
+    if (j.find("baked_window") != j.end()) {
+        g.baked_window = j["baked_window"].get<std::array<std::size_t, 2>>();
+    }
 }
 
 template <typename content_t, typename grid_id_t>
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2023 CERN for the benefit of the ACTS project
+ * (c) 2021-2024 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,9 @@
 // Project include(s).
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/test/common/types.hpp"
+#include "detray/utils/grid/detail/axis.hpp"
+#include "detray/utils/grid/detail/axis_binning.hpp"
+#include "detray/utils/grid/detail/axis_bounds.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -17,6 +20,9 @@
 
 // System include(s).
 #include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
 
 // Use the detray:: namespace implicitly.
 using namespace detray;
@@ -24,10 +30,6 @@ using namespace detray;
 // Benchmarks the cost of searching a volume by position
 void BM_FIND_VOLUMES(benchmark::State &state) {
 
-    // This test is broken at the moment, don't run it.
-    state.SkipWithError("Benchmark disabled for the toy geometry");
-    return;
-
     // Detector configuration
     vecmem::host_memory_resource host_mr;
     toy_det_config toy_cfg{};
@@ -56,11 +58,11 @@ void BM_FIND_VOLUMES(benchmark::State &state) {
             for (unsigned int i0 = 0u; i0 < itest; ++i0) {
                 test::vector3 rz{static_cast<scalar>(i0) * step0, 0.f,
                                  static_cast<scalar>(i1) * step1};
-                const auto &v = d.volume(rz);
+                const dindex vol_idx{d.volume_index(rz)};
 
                 benchmark::DoNotOptimize(successful);
                 benchmark::DoNotOptimize(unsuccessful);
-                if (v.index() == dindex_invalid) {
+                if (vol_idx == dindex_invalid) {
                     ++unsuccessful;
                 } else {
                     ++successful;
@@ -81,3 +83,74 @@ BENCHMARK(BM_FIND_VOLUMES)
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
 #endif
     ->Unit(benchmark::kMillisecond);
+
+namespace {
+
+/// Irregular bin edges that resemble the radial layer boundaries of a
+/// volume grid: fine bins close to the beamline, coarse bins further out
+vecmem::vector<scalar> make_rz_edges(const std::size_t n_bins) {
+    vecmem::vector<scalar> edges{};
+    edges.reserve(n_bins + 1u);
+
+    scalar edge{0.f};
+    for (std::size_t i = 0u; i <= n_bins; ++i) {
+        edges.push_back(edge);
+        edge += 2.f + 0.5f * static_cast<scalar>(i % 7u) *
+                          static_cast<scalar>(1u + i / 10u);
+    }
+
+    return edges;
+}
+
+}  // anonymous namespace
+
+// Benchmarks the cost of a bin lookup on an irregular volume grid axis
+template <typename binning_t>
+void BM_FIND_VOLUME_BIN(benchmark::State &state) {
+
+    using axis_t = axis::single_axis<axis::open<axis::label::e_r>, binning_t>;
+
+    const auto n_bins{static_cast<std::size_t>(state.range(0))};
+    const vecmem::vector<scalar> edges = make_rz_edges(n_bins);
+
+    // Append the index table, if the binning needs it
+    vecmem::vector<scalar> bin_edges = edges;
+    if constexpr (std::is_same_v<binning_t, axis::irregular_lut<>>) {
+        const auto index_table = binning_t::make_index_table(edges);
+        bin_edges.insert(bin_edges.end(), index_table.begin(),
+                         index_table.end());
+    }
+
+    const axis_t ax{dindex_range{0u, static_cast<dindex>(n_bins)},
+                    &bin_edges};
+
+    // Random positions on the axis span
+    constexpr std::size_t n_points{10000u};
+    std::mt19937_64 gen{42u};
+    std::uniform_real_distribution<scalar> dist(edges.front(), edges.back());
+    std::vector<scalar> points(n_points);
+    for (scalar &p : points) {
+        p = dist(gen);
+    }
+
+    for (auto _ : state) {
+        for (const scalar p : points) {
+            benchmark::DoNotOptimize(ax.bin(p));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<benchmark::IterationCount>(n_points));
+}
+
+BENCHMARK_TEMPLATE(BM_FIND_VOLUME_BIN, axis::irregular<>)
+    ->Name("BM_FIND_VOLUME_BIN_IRREGULAR")
+    ->RangeMultiplier(4)
+    ->Range(8, 512)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_FIND_VOLUME_BIN, axis::irregular_lut<>)
+    ->Name("BM_FIND_VOLUME_BIN_IRREGULAR_LUT")
+    ->RangeMultiplier(4)
+    ->Range(8, 512)
+    ->Unit(benchmark::kMicrosecond);
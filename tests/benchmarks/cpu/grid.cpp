@@ -52,11 +52,12 @@ auto make_random_points() {
 }
 
 /// Make a regular grid for the tests.
-template <typename bin_t>
+template <typename bin_t,
+          template <std::size_t> class serializer_t = simple_serializer>
 auto make_regular_grid(vecmem::memory_resource &mr) {
 
     // Data-owning grids with bin capacity 1
-    auto gr_factory = grid_factory<bin_t, simple_serializer>{mr};
+    auto gr_factory = grid_factory<bin_t, serializer_t>{mr};
 
     // Spans of the axes
     std::vector<scalar> spans = {0.f, 25.f, 0.f, 60.f};
@@ -107,6 +108,24 @@ void populate_grid(grid_t &grid) {
     }
 }
 
+/// Fill a grid with entries that span 2 x 2 bins, so that neighboring bins
+/// contain the same entries.
+template <typename grid_t>
+void populate_overlapping(grid_t &grid) {
+
+    const dindex n_y{grid.template get_axis<axis::label::e_y>().nbins()};
+    for (dindex gbin = 0u; gbin < grid.nbins(); ++gbin) {
+        const dindex i{gbin / n_y};
+        const dindex j{gbin % n_y};
+        for (dindex a = 0u; a <= 1u && a <= i; ++a) {
+            for (dindex b = 0u; b <= 1u && b <= j; ++b) {
+                grid.template populate<attach<>>(gbin,
+                                                 (i - a) * n_y + (j - b));
+            }
+        }
+    }
+}
+
 }  // namespace
 
 // This runs a reference test with a regular grid structure
@@ -281,6 +300,128 @@ void BM_GRID_REGULAR_NEIGHBOR_CAP4(benchmark::State &state) {
 #endif  // DETRAY_BENCHMARK_PRINTOUTS
 }
 
+// Neighborhood lookup, in which the entries are found in multiple bins
+void BM_GRID_REGULAR_NEIGHBOR_CAP4_OVERLAP(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_overlapping(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    const auto w{static_cast<dindex>(state.range(0))};
+    const darray<dindex, 2> window = {w, w};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+}
+
+// Same neighborhood lookup, but every entry is visited only once
+void BM_GRID_REGULAR_NEIGHBOR_CAP4_UNIQUE(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>>(host_mr);
+    populate_overlapping(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    const auto w{static_cast<dindex>(state.range(0))};
+    const darray<dindex, 2> window = {w, w};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search_unique(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP4_UNIQUE:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search_unique(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+// Neighborhood lookup with the bins in Z-order
+void BM_GRID_REGULAR_NEIGHBOR_CAP1_MORTON(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r =
+        make_regular_grid<bins::single<dindex>, morton_serializer>(host_mr);
+    populate_grid<replace<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP1_MORTON:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+// Neighborhood lookup with the bins in Z-order
+void BM_GRID_REGULAR_NEIGHBOR_CAP4_MORTON(benchmark::State &state) {
+
+    // Set up the tested grid object.
+    vecmem::host_memory_resource host_mr;
+    auto g2r = make_regular_grid<bins::static_array<dindex, 4>,
+                                 morton_serializer>(host_mr);
+    populate_grid<complete<>>(g2r);
+
+    auto points = make_random_points();
+
+    // Search window size.
+    static const darray<dindex, 2> window = {2u, 2u};
+
+    for (auto _ : state) {
+        for (const auto &p : points) {
+            for (const dindex entry : g2r.search(p, window)) {
+                benchmark::DoNotOptimize(entry);
+            }
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "BM_GRID_REGULAR_NEIGHBOR_CAP4_MORTON:" << std::endl;
+    std::size_t count{0u};
+    for (const dindex entry : g2r.search(tp, window)) {
+        std::cout << entry << ", ";
+        ++count;
+    }
+    std::cout << "\n=> Neighbors: " << count << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
 // This runs a reference test with a irregular grid structure
 void BM_GRID_IRREGULAR_BIN_CAP1(benchmark::State &state) {
 
@@ -376,6 +517,36 @@ BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4)
     ->MeasureProcessCPUTime()
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4_OVERLAP)
+    ->DenseRange(1, 3)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4_UNIQUE)
+    ->DenseRange(1, 3)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP1_MORTON)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_GRID_REGULAR_NEIGHBOR_CAP4_MORTON)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->MeasureProcessCPUTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_GRID_IRREGULAR_BIN_CAP1)
 #ifdef DETRAY_BENCHMARK_MULTITHREAD
     ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
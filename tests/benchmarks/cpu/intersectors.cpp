@@ -16,6 +16,7 @@
 #include "detray/geometry/shapes.hpp"
 #include "detray/navigation/detail/ray.hpp"
 #include "detray/navigation/intersection/ray_intersector.hpp"
+#include "detray/navigation/soa_intersection_kernel.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
 
 // Detray test include(s).
@@ -229,6 +230,81 @@ BENCHMARK(BM_INTERSECT_PLANES_SOA)
 #endif
     ->Unit(benchmark::kMillisecond);
 
+/// This benchmark runs the batched intersection of AoS planes with the SoA
+/// intersector, as done in the navigation
+void BM_INTERSECT_PLANES_BATCH(benchmark::State& state) {
+
+    using transform3_t = dtransform3D<algebra_s>;
+    using mask_t = mask<rectangle2D, std::uint_least16_t, algebra_s>;
+    using surface_t = surface_desc_t<dindex>;
+    using intersection_t = intersection2D<surface_t, algebra_s>;
+
+    auto dists = get_dists<algebra_s>(n_surfaces);
+    auto planes = test::planes_along_direction<algebra_s>(
+        dists, test::vector3{1.f, 1.f, 1.f});
+
+    constexpr mask_t rect{0u, 100.f, 200.f};
+    std::vector<mask_t> masks(dists.size(), rect);
+
+    // The surfaces link to their transforms and masks
+    std::vector<transform3_t> transforms;
+    std::vector<surface_t> surfaces;
+    for (std::size_t i = 0u; i < planes.size(); ++i) {
+        transforms.push_back(planes[i].transform());
+
+        const auto idx{static_cast<dindex>(i)};
+        surfaces.emplace_back(idx, mask_link_t{mask_ids::e_rectangle2, idx},
+                              material_link_t{material_ids::e_slab, 0u}, 0u,
+                              surface_id::e_sensitive);
+    }
+
+    const auto rays = generate_rays();
+    const auto batch_kernel = soa_intersection_initialize_batch<algebra_v>{};
+
+    dvector<intersection_t> intersections;
+    intersections.reserve(surfaces.size());
+
+    const std::array<test::scalar, 2u> mask_tol{0.f, 0.f};
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::size_t hit{0u};
+#endif
+
+    for (auto _ : state) {
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+        hit = 0u;
+#endif
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto& ray : rays) {
+            intersections.clear();
+
+            batch_kernel(masks, surfaces.data(),
+                         static_cast<dindex>(surfaces.size()), intersections,
+                         ray, transforms, mask_tol);
+
+            benchmark::DoNotOptimize(intersections.data());
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+            hit += intersections.size();
+#endif
+        }
+    }
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << mask_t::shape::name << " batch: hit/miss ... " << hit
+              << " / " << rays.size() * masks.size() - hit
+              << " (total: " << rays.size() * masks.size() << ")"
+              << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK(BM_INTERSECT_PLANES_BATCH)
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Unit(benchmark::kMillisecond);
+
 /// This benchmark runs intersection with the cylinder intersector
 void BM_INTERSECT_CYLINDERS_AOS(benchmark::State& state) {
 
@@ -0,0 +1,213 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/propagator/detail/jacobian_engine.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/common/types.hpp"
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <random>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using algebra_t = test::algebra;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+using matrix_operator = test::matrix_operator;
+
+namespace {
+
+constexpr std::size_t n_tracks{10000u};
+
+/// Track states on arrival at the destination surface
+struct transport_data {
+    free_vector<algebra_t> free_vec;
+    vector3 dtds;
+    scalar dqopds;
+};
+
+/// Random track states with small path derivatives
+std::vector<transport_data> make_transport_data() {
+    std::mt19937_64 gen{42u};
+    std::uniform_real_distribution<scalar> pos_dist(-100.f, 100.f);
+    std::uniform_real_distribution<scalar> dir_dist(-1.f, 1.f);
+    std::uniform_real_distribution<scalar> small_dist(-0.01f, 0.01f);
+
+    std::vector<transport_data> data;
+    data.reserve(n_tracks);
+    for (std::size_t i = 0u; i < n_tracks; ++i) {
+        const point3 pos{pos_dist(gen), pos_dist(gen), pos_dist(gen)};
+        const vector3 mom{dir_dist(gen), dir_dist(gen), 0.5f + dir_dist(gen)};
+
+        const free_track_parameters<algebra_t> track(pos, 0.f, mom, -1.f);
+        data.push_back({track.vector(),
+                        vector3{small_dist(gen), small_dist(gen),
+                                small_dist(gen)},
+                        small_dist(gen)});
+    }
+    return data;
+}
+
+/// Transport jacobian without zero entries
+free_matrix<algebra_t> make_transport_jacobian() {
+    free_matrix<algebra_t> jac =
+        matrix_operator().template identity<e_free_size, e_free_size>();
+
+    for (unsigned int i = 0u; i < e_free_size; ++i) {
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            matrix_operator().element(jac, i, j) +=
+                0.01f * static_cast<scalar>((3u * i + 7u * j) % 11u);
+        }
+    }
+    return jac;
+}
+
+/// Bound to free jacobian on a rectangular departure surface
+bound_to_free_matrix<algebra_t> make_bound_to_free_jacobian() {
+    using jac_engine = detail::jacobian_engine<cartesian2D<algebra_t>>;
+
+    const mask<rectangle2D> rect{0u, 50.f, 50.f};
+    const transform3 trf(point3{0.f, 0.f, 0.f},
+                         vector::normalize(vector3{0.f, 0.2f, 1.f}),
+                         vector::normalize(vector3{1.f, 0.f, 0.f}));
+
+    const free_track_parameters<algebra_t> track(
+        point3{1.f, 2.f, 0.f}, 0.f, vector3{0.3f, 0.2f, 1.f}, -1.f);
+    const auto bound_vec = detail::free_to_bound_vector<cartesian2D<algebra_t>>(
+        trf, track.vector());
+
+    return jac_engine::bound_to_free_jacobian(trf, rect, bound_vec);
+}
+
+/// Symmetric covariance on the departure surface
+bound_matrix<algebra_t> make_covariance() {
+    bound_matrix<algebra_t> cov =
+        matrix_operator().template identity<e_bound_size, e_bound_size>();
+
+    for (unsigned int i = 0u; i < e_bound_size; ++i) {
+        for (unsigned int j = 0u; j < e_bound_size; ++j) {
+            matrix_operator().element(cov, i, j) +=
+                0.001f * static_cast<scalar>(i + j);
+        }
+    }
+    return cov;
+}
+
+/// Destination surface
+const transform3 dest_trf(point3{10.f, -20.f, 30.f},
+                          vector::normalize(vector3{0.2f, 0.1f, 1.f}),
+                          vector::normalize(vector3{1.f, 0.f, -0.2f}));
+
+}  // anonymous namespace
+
+// Benchmarks the bound-to-bound covariance transport with dense matrix
+// products
+template <typename frame_t>
+void BM_COV_TRANSPORT_DENSE(benchmark::State &state) {
+
+    using jac_engine = detail::jacobian_engine<frame_t>;
+
+    const std::vector<transport_data> data = make_transport_data();
+    const free_matrix<algebra_t> transport_jac = make_transport_jacobian();
+    const bound_to_free_matrix<algebra_t> bound_to_free_jac =
+        make_bound_to_free_jacobian();
+    const bound_matrix<algebra_t> cov = make_covariance();
+
+    for (auto _ : state) {
+        for (const transport_data &d : data) {
+            const free_vector<algebra_t> &free_vec = d.free_vec;
+
+            const free_to_bound_matrix<algebra_t> free_to_bound_jac =
+                jac_engine::free_to_bound_jacobian(dest_trf, free_vec);
+
+            const free_matrix<algebra_t> correction_term =
+                matrix_operator()
+                    .template identity<e_free_size, e_free_size>() +
+                jac_engine::path_correction(
+                    detail::track_helper<matrix_operator>().pos(free_vec),
+                    detail::track_helper<matrix_operator>().dir(free_vec),
+                    d.dtds, d.dqopds, dest_trf);
+
+            const bound_matrix<algebra_t> full_jac =
+                free_to_bound_jac * correction_term * transport_jac *
+                bound_to_free_jac;
+
+            const bound_matrix<algebra_t> new_cov =
+                full_jac * cov * matrix_operator().transpose(full_jac);
+
+            benchmark::DoNotOptimize(new_cov);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<benchmark::IterationCount>(n_tracks));
+}
+
+// Benchmarks the bound-to-bound covariance transport with the fused,
+// structure-aware kernels
+template <typename frame_t>
+void BM_COV_TRANSPORT_FUSED(benchmark::State &state) {
+
+    using jac_engine = detail::jacobian_engine<frame_t>;
+
+    const std::vector<transport_data> data = make_transport_data();
+    const free_matrix<algebra_t> transport_jac = make_transport_jacobian();
+    const bound_to_free_matrix<algebra_t> bound_to_free_jac =
+        make_bound_to_free_jacobian();
+    const bound_matrix<algebra_t> cov = make_covariance();
+
+    for (auto _ : state) {
+        for (const transport_data &d : data) {
+            const bound_matrix<algebra_t> full_jac =
+                jac_engine::bound_to_bound_transport_jacobian(
+                    dest_trf, d.free_vec, d.dtds, d.dqopds, transport_jac,
+                    bound_to_free_jac);
+
+            const bound_matrix<algebra_t> new_cov =
+                jac_engine::template transport_covariance<e_bound_size>(
+                    full_jac, cov);
+
+            benchmark::DoNotOptimize(new_cov);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<benchmark::IterationCount>(n_tracks));
+}
+
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_DENSE, cartesian2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_DENSE_CARTESIAN")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_FUSED, cartesian2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_FUSED_CARTESIAN")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_DENSE, cylindrical2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_DENSE_CYLINDRICAL")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_FUSED, cylindrical2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_FUSED_CYLINDRICAL")
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_DENSE, line2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_DENSE_LINE")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_COV_TRANSPORT_FUSED, line2D<algebra_t>)
+    ->Name("BM_COV_TRANSPORT_FUSED_LINE")
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,299 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_telescope_detector.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/detectors/create_wire_chamber.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+using algebra_t = test::algebra;
+using track_t = free_track_parameters<algebra_t>;
+
+namespace {
+
+/// The detectors that are benchmarked
+enum class geometry { e_toy, e_wire_chamber, e_telescope };
+
+/// Counts the navigator (re-)initializations
+struct init_counter {
+    std::size_t n_inits{0u};
+
+    template <typename state_t, typename point3_t, typename vector3_t>
+    void operator()(const state_t &, const navigation::config &,
+                    const point3_t &, const vector3_t &, const char *message) {
+        if (std::strncmp(message, "Init complete", 13u) == 0) {
+            ++n_inits;
+        }
+    }
+};
+
+/// Counts the accepted steps of the stepper
+struct step_counter {
+    std::size_t n_steps{0u};
+
+    template <typename state_t, typename... Args>
+    void operator()(const state_t &, const stepping::config &,
+                    const char *message, Args &&...) {
+        if (std::strncmp(message, "Step complete", 13u) == 0) {
+            ++n_steps;
+        }
+    }
+};
+
+/// Owns the actor states and selects the actor chain of a benchmark case
+template <bool do_cov_transport, bool do_material>
+struct actor_setup {
+
+    using transporter_t = parameter_transporter<algebra_t>;
+    using interactor_t = pointwise_material_interactor<algebra_t>;
+    using resetter_t = parameter_resetter<algebra_t>;
+
+    using chain_type = std::conditional_t<
+        do_material,
+        actor_chain<dtuple, transporter_t, interactor_t, resetter_t>,
+        std::conditional_t<do_cov_transport,
+                           actor_chain<dtuple, transporter_t, resetter_t>,
+                           actor_chain<>>>;
+
+    typename transporter_t::state transporter{};
+    typename interactor_t::state interactor{};
+    typename resetter_t::state resetter{};
+
+    actor_setup() { interactor.do_covariance_transport = do_cov_transport; }
+
+    /// @returns the actor states of the chain by reference
+    auto states() {
+        if constexpr (do_material) {
+            return std::tie(transporter, interactor, resetter);
+        } else if constexpr (do_cov_transport) {
+            return std::tie(transporter, resetter);
+        } else {
+            return typename actor_chain<>::state{};
+        }
+    }
+};
+
+/// Build the detector for a benchmark case
+template <geometry geo>
+auto build_detector(vecmem::memory_resource &mr) {
+    if constexpr (geo == geometry::e_toy) {
+        toy_det_config toy_cfg =
+            toy_det_config{}.n_brl_layers(4u).n_edc_layers(7u).do_check(false);
+        toy_cfg.use_material_maps(false);
+        return build_toy_detector(mr, toy_cfg);
+    } else if constexpr (geo == geometry::e_wire_chamber) {
+        wire_chamber_config wire_chamber_cfg{};
+        wire_chamber_cfg.half_z(500.f * unit<scalar>::mm);
+        return create_wire_chamber(mr, wire_chamber_cfg);
+    } else {
+        tel_det_config<rectangle2D> tel_cfg{20.f * unit<scalar>::mm,
+                                            20.f * unit<scalar>::mm};
+        tel_cfg.n_surfaces(10u)
+            .length(500.f * unit<scalar>::mm)
+            .envelope(500.f * unit<scalar>::um);
+        return build_telescope_detector(mr, tel_cfg);
+    }
+}
+
+/// Generate @param n_steps x @param n_steps tracks for a benchmark case
+template <geometry geo>
+std::vector<track_t> generate_tracks(const std::size_t n_steps) {
+
+    using generator_t = uniform_track_generator<track_t>;
+
+    generator_t::configuration trk_cfg{};
+    trk_cfg.phi_steps(n_steps).theta_steps(n_steps);
+    trk_cfg.p_tot(10.f * unit<scalar>::GeV);
+
+    if constexpr (geo == geometry::e_telescope) {
+        // The first surface is at z=0, so shift the track origin back
+        trk_cfg.origin({0.f, 0.f, -0.05f});
+        trk_cfg.theta_range(0.01f, 0.25f * constant<scalar>::pi_4);
+    }
+
+    std::vector<track_t> tracks;
+    tracks.reserve(n_steps * n_steps);
+    for (auto track : generator_t{trk_cfg}) {
+        tracks.push_back(track);
+    }
+
+    return tracks;
+}
+
+/// Make the magnetic field for a benchmark case
+template <typename bfield_t>
+bfield_t make_field() {
+    if constexpr (std::is_same_v<bfield_t, bfield::const_field_t>) {
+        return bfield::create_const_field(
+            test::vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+    } else {
+        return bfield::create_inhom_field();
+    }
+}
+
+}  // anonymous namespace
+
+/// Benchmark the full propagation loop (navigation, RKN stepping, actors)
+///
+/// @tparam geo the detector geometry
+/// @tparam bfield_t the covfie field type (constant or inhomogeneous)
+/// @tparam do_cov_transport run the covariance transport
+/// @tparam do_material run the material interaction
+template <geometry geo, typename bfield_t, bool do_cov_transport,
+          bool do_material>
+static void BM_PROPAGATION(benchmark::State &state) {
+
+    using actors_t = actor_setup<do_cov_transport, do_material>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_detector<geo>(host_mr);
+    using detector_t = std::remove_cv_t<decltype(det)>;
+
+    // The inhomogeneous field needs a covfie file (DETRAY_BFIELD_FILE)
+    std::optional<bfield_t> field;
+    try {
+        field.emplace(make_field<bfield_t>());
+    } catch (const std::exception &e) {
+        state.SkipWithError(e.what());
+        return;
+    }
+
+    const std::vector<track_t> tracks =
+        generate_tracks<geo>(static_cast<std::size_t>(state.range(0)));
+
+    propagation::config cfg{};
+    cfg.stepping.do_covariance_transport = do_cov_transport;
+
+    using stepper_t = rk_stepper<typename bfield_t::view_t, algebra_t>;
+    using navigator_t = navigator<detector_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator_t, typename actors_t::chain_type>;
+
+    propagator_t p{cfg};
+
+    std::size_t total_tracks{0u};
+
+    for (auto _ : state) {
+        for (const auto &track : tracks) {
+            actors_t actors{};
+            typename propagator_t::state p_state(track, *field, det);
+
+            benchmark::DoNotOptimize(p.propagate(p_state, actors.states()));
+        }
+        total_tracks += tracks.size();
+    }
+
+    // Gather the per track statistics in a separate (untimed) run with
+    // counting inspectors
+    using counting_stepper_t =
+        rk_stepper<typename bfield_t::view_t, algebra_t, unconstrained_step,
+                   stepper_rk_policy, step_counter>;
+    using counting_navigator_t = navigator<detector_t, init_counter>;
+    using counting_propagator_t =
+        propagator<counting_stepper_t, counting_navigator_t,
+                   typename actors_t::chain_type>;
+
+    counting_propagator_t counting_p{cfg};
+
+    std::size_t n_steps{0u};
+    std::size_t n_reinits{0u};
+    std::size_t n_success{0u};
+
+    for (const auto &track : tracks) {
+        actors_t actors{};
+        typename counting_propagator_t::state p_state(track, *field, det);
+
+        n_success += counting_p.propagate(p_state, actors.states()) ? 1u : 0u;
+
+        n_steps += p_state._stepping.inspector().n_steps;
+        // The first initialization is not a re-initialization
+        const std::size_t n_inits{p_state._navigation.inspector().n_inits};
+        n_reinits += n_inits > 0u ? n_inits - 1u : 0u;
+    }
+
+    const auto n_tracks{static_cast<double>(tracks.size())};
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+    state.counters["StepsPerTrack"] = static_cast<double>(n_steps) / n_tracks;
+    state.counters["ReInitsPerTrack"] =
+        static_cast<double>(n_reinits) / n_tracks;
+    state.counters["SuccessRate"] = static_cast<double>(n_success) / n_tracks;
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << names.at(0u) << ": " << tracks.size() << " tracks, "
+              << n_success << " successful" << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+// Register the benchmark cases: detector, field, cov. transport, material
+#define DETRAY_PROPAGATION_BENCHMARK(GEO, FIELD, COV, MAT, NAME)            \
+    BENCHMARK_TEMPLATE(BM_PROPAGATION, geometry::GEO, bfield::FIELD, COV, \
+                       MAT)                                               \
+        ->Name(NAME)                                                      \
+        ->RangeMultiplier(2)                                              \
+        ->Range(8, 32)                                                    \
+        ->Unit(benchmark::kMillisecond)
+
+// Toy detector
+DETRAY_PROPAGATION_BENCHMARK(e_toy, const_field_t, false, false,
+                             "TOY_CONST_BFIELD");
+DETRAY_PROPAGATION_BENCHMARK(e_toy, const_field_t, true, false,
+                             "TOY_CONST_BFIELD_COV");
+DETRAY_PROPAGATION_BENCHMARK(e_toy, const_field_t, true, true,
+                             "TOY_CONST_BFIELD_COV_MAT");
+DETRAY_PROPAGATION_BENCHMARK(e_toy, inhom_field_t, false, false,
+                             "TOY_INHOM_BFIELD");
+DETRAY_PROPAGATION_BENCHMARK(e_toy, inhom_field_t, true, true,
+                             "TOY_INHOM_BFIELD_COV_MAT");
+
+// Wire chamber
+DETRAY_PROPAGATION_BENCHMARK(e_wire_chamber, const_field_t, false, false,
+                             "WIRE_CHAMBER_CONST_BFIELD");
+DETRAY_PROPAGATION_BENCHMARK(e_wire_chamber, const_field_t, true, true,
+                             "WIRE_CHAMBER_CONST_BFIELD_COV_MAT");
+DETRAY_PROPAGATION_BENCHMARK(e_wire_chamber, inhom_field_t, true, true,
+                             "WIRE_CHAMBER_INHOM_BFIELD_COV_MAT");
+
+// Telescope detector
+DETRAY_PROPAGATION_BENCHMARK(e_telescope, const_field_t, false, false,
+                             "TELESCOPE_CONST_BFIELD");
+DETRAY_PROPAGATION_BENCHMARK(e_telescope, const_field_t, true, true,
+                             "TELESCOPE_CONST_BFIELD_COV_MAT");
+DETRAY_PROPAGATION_BENCHMARK(e_telescope, inhom_field_t, true, true,
+                             "TELESCOPE_INHOM_BFIELD_COV_MAT");
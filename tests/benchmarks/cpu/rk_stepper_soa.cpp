@@ -0,0 +1,260 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s).
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+
+// Detray core include(s).
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/soa/rk_stepper.hpp"
+#include "detray/propagator/stepping_config.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Detray test include(s).
+#include "detray/test/common/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google Benchmark include(s)
+#include <benchmark/benchmark.h>
+
+// System include(s)
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace detray;
+
+/// Linear algebra implementation using SoA memory layout
+using algebra_v = detray::vc_soa<test::scalar>;
+
+/// Linear algebra implementation using AoS memory layout
+using algebra_s = detray::cmath<test::scalar>;
+
+using track_t = free_track_parameters<algebra_s>;
+using field_t = bfield::const_field_t;
+
+namespace {
+
+constexpr unsigned int theta_steps{100u};
+constexpr unsigned int phi_steps{100u};
+constexpr test::scalar path_limit{1.f * unit<test::scalar>::m};
+
+/// Generate the test tracks
+std::vector<track_t> generate_tracks() {
+
+    using generator_t = uniform_track_generator<track_t>;
+
+    generator_t::configuration trk_cfg{};
+    trk_cfg.theta_steps(theta_steps).phi_steps(phi_steps);
+    trk_cfg.p_tot(1.f * unit<test::scalar>::GeV);
+
+    std::vector<track_t> tracks;
+    for (auto track : generator_t{trk_cfg}) {
+        tracks.push_back(track);
+    }
+
+    return tracks;
+}
+
+/// Navigation state of an empty volume without material, which only limits
+/// the step size to the remaining path
+struct nav_state {
+
+    explicit nav_state(vecmem::host_memory_resource &mr)
+        : m_det{std::make_unique<detray::detector<>>(mr)} {
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    test::scalar operator()() const { return m_remaining; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    test::scalar m_remaining{path_limit};
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+/// Propagation state of the scalar stepper
+template <typename stepping_t>
+struct prop_state {
+    stepping_t _stepping;
+    nav_state &_navigation;
+};
+
+/// Step every track on its own with the scalar RKN stepper until the path
+/// limit
+std::size_t run_tracks(const std::vector<track_t> &tracks,
+                       const field_t::view_t &field, nav_state &navigation,
+                       const stepping::config &cfg) {
+
+    using stepper_t = rk_stepper<field_t::view_t, algebra_s>;
+
+    const stepper_t stepper{};
+
+    std::size_t n_steps{0u};
+
+    for (const track_t &track : tracks) {
+        prop_state<stepper_t::state> propagation{
+            stepper_t::state{track, field}, navigation};
+        auto &stepping = propagation._stepping;
+
+        navigation.m_remaining = path_limit;
+        while (navigation.m_remaining > cfg.min_stepsize) {
+            stepper.step(propagation, cfg);
+            navigation.m_remaining = path_limit - stepping.path_length();
+            ++n_steps;
+        }
+        benchmark::DoNotOptimize(stepping());
+    }
+
+    return n_steps;
+}
+
+/// Step bundles of tracks until the path limit, refilling the lanes of
+/// finished tracks from the track collection
+template <typename algebra_t>
+std::size_t run_bundles(const std::vector<track_t> &tracks,
+                        const field_t::view_t &field,
+                        const stepping::config &cfg) {
+
+    using stepper_t = rk_bundle_stepper<field_t::view_t, algebra_t>;
+    using scalar_t = dscalar<algebra_t>;
+
+    const stepper_t stepper{};
+    typename stepper_t::state stepping(field);
+
+    std::size_t next{0u};
+    std::size_t n_steps{0u};
+    std::vector<track_t> results(stepper_t::size());
+
+    do {
+        // Refill the free lanes
+        for (std::size_t i = 0u; i < stepper_t::size(); ++i) {
+            if (!stepping.is_active(i) && next < tracks.size()) {
+                stepping.load(i, tracks[next++]);
+            }
+        }
+
+        const scalar_t max_step{scalar_t(path_limit) - stepping._path_length};
+        stepper.step(stepping, max_step, cfg);
+        ++n_steps;
+
+        // Lanes that reached the path limit are done
+        stepping.terminate(stepping._path_length >=
+                           scalar_t(path_limit - cfg.min_stepsize));
+
+        for (std::size_t i = 0u; i < stepper_t::size(); ++i) {
+            if (!stepping.is_active(i)) {
+                stepping.store(i, results[i]);
+            }
+        }
+        benchmark::DoNotOptimize(results);
+
+    } while (stepping.is_alive() || next < tracks.size());
+
+    return n_steps;
+}
+
+/// Benchmark the scalar RKN stepper as reference
+void BM_RK_STEPPER(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+    nav_state navigation{host_mr};
+
+    const auto tracks = generate_tracks();
+    const field_t field = bfield::create_const_field(
+        test::vector3{0.f, 0.f, 2.f * unit<test::scalar>::T});
+
+    stepping::config cfg{};
+    cfg.do_covariance_transport = (state.range(0) != 0);
+
+    std::size_t n_steps{0u};
+    std::size_t total_tracks{0u};
+
+    for (auto _ : state) {
+        n_steps = run_tracks(tracks, field, navigation, cfg);
+        total_tracks += tracks.size();
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+    state.counters["Steps"] = static_cast<double>(n_steps);
+}
+
+/// Benchmark the stepping of track bundles
+template <typename algebra_t>
+void BM_RK_BUNDLE_STEPPER(benchmark::State &state) {
+
+    const auto tracks = generate_tracks();
+    const field_t field = bfield::create_const_field(
+        test::vector3{0.f, 0.f, 2.f * unit<test::scalar>::T});
+
+    stepping::config cfg{};
+    cfg.do_covariance_transport = (state.range(0) != 0);
+
+    std::size_t n_steps{0u};
+    std::size_t total_tracks{0u};
+
+    for (auto _ : state) {
+        n_steps = run_bundles<algebra_t>(tracks, field, cfg);
+        total_tracks += tracks.size();
+    }
+
+    state.counters["TracksPropagated"] = benchmark::Counter(
+        static_cast<double>(total_tracks), benchmark::Counter::kIsRate);
+    state.counters["BundleSteps"] = static_cast<double>(n_steps);
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "Lanes: " << dscalar<algebra_v>::size()
+              << ", bundle steps: " << n_steps << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+}  // namespace
+
+BENCHMARK(BM_RK_STEPPER)
+    ->Name("RK_STEPPER_AOS")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+// Bundle stepper with a single lane: Overhead of the bundle bookkeeping
+BENCHMARK_TEMPLATE(BM_RK_BUNDLE_STEPPER, algebra_s)
+    ->Name("RK_BUNDLE_STEPPER_1LANE")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_RK_BUNDLE_STEPPER, algebra_v)
+    ->Name("RK_STEPPER_SOA")
+#ifdef DETRAY_BENCHMARK_MULTITHREAD
+    ->ThreadRange(1, benchmark::CPUInfo::Get().num_cpus)
+#endif
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
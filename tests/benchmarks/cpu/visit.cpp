@@ -0,0 +1,141 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray core include(s).
+#include "detray/core/detail/tuple_container.hpp"
+#include "detray/definitions/detail/containers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Google benchmark include(s).
+#include <benchmark/benchmark.h>
+
+// System include(s).
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Use the detray:: namespace implicitly.
+using namespace detray;
+
+namespace {
+
+// Number of distinct collection types (e.g. mask shapes) in the store
+constexpr std::size_t n_types{20u};
+// Number of elements per collection
+constexpr std::size_t n_elements{16u};
+// Number of type ids that are visited per iteration
+constexpr std::size_t n_visits{10000u};
+
+/// Collection element that is distinct for every tuple index
+template <std::size_t I>
+struct payload {
+    float value{static_cast<float>(I)};
+};
+
+/// Read an element from the visited collection (like a mask visitor)
+struct read_value {
+    template <typename group_t>
+    float operator()(const group_t &group, const std::size_t index) const {
+        return group[index].value;
+    }
+};
+
+/// Distributions of the type ids: how often the store hits which collection
+enum class id_distribution : int {
+    e_uniform = 0,
+    e_skewed_first = 1,
+    e_skewed_last = 2,
+    e_single_last = 3,
+};
+
+template <std::size_t... I>
+auto make_store(vecmem::memory_resource &resource, std::index_sequence<I...>) {
+    return detail::tuple_container<std::tuple, dvector<payload<I>>...>(
+        resource, dvector<payload<I>>(n_elements, payload<I>{}, &resource)...);
+}
+
+/// Generate the sequence of (type id, element index) pairs to be visited
+std::vector<std::pair<std::size_t, std::size_t>> make_ids(
+    const id_distribution dist) {
+
+    std::mt19937_64 gen(42u);
+    std::uniform_int_distribution<std::size_t> uniform(0u, n_types - 1u);
+    std::geometric_distribution<std::size_t> geometric(0.3);
+    std::uniform_int_distribution<std::size_t> elem(0u, n_elements - 1u);
+
+    std::vector<std::pair<std::size_t, std::size_t>> ids;
+    ids.reserve(n_visits);
+
+    for (std::size_t i = 0u; i < n_visits; ++i) {
+        std::size_t id{0u};
+        switch (dist) {
+            case id_distribution::e_uniform:
+                id = uniform(gen);
+                break;
+            case id_distribution::e_skewed_first:
+                id = std::min(geometric(gen), n_types - 1u);
+                break;
+            case id_distribution::e_skewed_last:
+                id = n_types - 1u - std::min(geometric(gen), n_types - 1u);
+                break;
+            case id_distribution::e_single_last:
+                id = n_types - 1u;
+                break;
+        }
+        ids.emplace_back(id, elem(gen));
+    }
+
+    return ids;
+}
+
+}  // namespace
+
+// This runs a benchmark on the visitor dispatch of a tuple container
+template <detail::visit_dispatch dispatch>
+void BM_VISIT(benchmark::State &state) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto store =
+        make_store(host_mr, std::make_index_sequence<n_types>{});
+    const auto ids =
+        make_ids(static_cast<id_distribution>(state.range(0)));
+
+    float sum{0.f};
+
+    for (auto _ : state) {
+        for (const auto &[id, index] : ids) {
+            sum += store.template visit<read_value, dispatch>(id, index);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<benchmark::IterationCount>(n_visits));
+
+#ifdef DETRAY_BENCHMARK_PRINTOUTS
+    std::cout << "Sum of visited values: " << sum << std::endl;
+#endif  // DETRAY_BENCHMARK_PRINTOUTS
+}
+
+BENCHMARK_TEMPLATE(BM_VISIT, detail::visit_dispatch::e_linear)
+    ->Name("BM_VISIT_LINEAR")
+    ->ArgName("distribution")
+    ->DenseRange(0, 3)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_VISIT, detail::visit_dispatch::e_switch)
+    ->Name("BM_VISIT_SWITCH")
+    ->ArgName("distribution")
+    ->DenseRange(0, 3)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,41 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/builders/grid_compactor.hpp"
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/navigation/accelerators/brute_force_finder.hpp"
+#include "detray/utils/grid/grid_collection.hpp"
+
+namespace detray::test {
+
+/// Toy detector metadata, which stores the surface grids in their compact
+/// representation: The bins hold 16 bit indices into the surface lookup
+/// (same type ids as the toy detector)
+struct toy_compact_grid_metadata : public toy_metadata {
+
+    /// Compact surface grid that is filled from a toy surface grid
+    template <template <typename, typename> class grid_t,
+              typename container_t>
+    using compact_sf_grid = typename compact_grid_t<
+        grid_t<surface_type, container_t>>::template type<false>;
+
+    /// How to store the acceleration data structures
+    template <template <typename...> class tuple_t = dtuple,
+              typename container_t = host_container_types>
+    using accelerator_store = multi_store<
+        accel_ids, empty_context, tuple_t,
+        brute_force_collection<surface_type, container_t>,
+        grid_collection<compact_sf_grid<disc_sf_grid, container_t>>,
+        grid_collection<compact_sf_grid<cylinder_sf_grid, container_t>>>;
+};
+
+}  // namespace detray::test
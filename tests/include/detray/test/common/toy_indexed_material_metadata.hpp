@@ -0,0 +1,51 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/multi_store.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/detectors/toy_metadata.hpp"
+#include "detray/geometry/shapes/concentric_cylinder2D.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/geometry/shapes/ring2D.hpp"
+#include "detray/materials/indexed_material_map.hpp"
+
+namespace detray::test {
+
+/// Toy detector metadata, which stores the material maps as indexed material
+/// maps, i.e. the bins refer to a material table (same type ids and surface
+/// links as the toy detector)
+struct toy_indexed_material_metadata : public toy_metadata {
+
+    // Cylindrical material grid
+    template <typename container_t>
+    using cylinder_map_t =
+        indexed_material_map<concentric_cylinder2D, scalar, container_t>;
+
+    // Disc material grid
+    template <typename container_t>
+    using disc_map_t = indexed_material_map<ring2D, scalar, container_t>;
+
+    // Rectangular material grid
+    template <typename container_t>
+    using rectangular_map_t =
+        indexed_material_map<rectangle2D, scalar, container_t>;
+
+    /// How to store materials
+    template <template <typename...> class tuple_t = dtuple,
+              typename container_t = host_container_types>
+    using material_store = multi_store<
+        material_ids, empty_context, tuple_t,
+        indexed_material_collection<disc_map_t<container_t>>,
+        indexed_material_collection<cylinder_map_t<container_t>>,
+        indexed_material_collection<rectangular_map_t<container_t>>,
+        typename container_t::template vector_type<slab>>;
+};
+
+}  // namespace detray::test
@@ -14,7 +14,9 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/detectors/toy_metadata.hpp"
 #include "detray/geometry/mask.hpp"
+#include "detray/navigation/navigation_config.hpp"
 #include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
 #include "detray/utils/type_list.hpp"
 
 // Vecmem include(s)
@@ -24,7 +26,11 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -186,3 +192,128 @@ GTEST_TEST(detray_builders, decorator_grid_builder) {
         EXPECT_EQ(sf.transform(), trf_idx++);
     }
 }
+
+/// Integration test: grid builder that bakes the bin neighborhoods
+GTEST_TEST(detray_builders, decorator_grid_builder_baked) {
+
+    using default_detector_t = detector<default_metadata>;
+    using transform3 = typename default_detector_t::transform3_type;
+    using surface_t = typename default_detector_t::surface_type;
+    using rectangle_factory =
+        surface_factory<default_detector_t, rectangle2D>;
+    using acc_ids = typename default_detector_t::accel::id;
+
+    // cylinder grid with dynamic bin capacities
+    using cyl_grid_t = typename default_metadata::template cylinder2D_sf_grid<
+        surface_t, host_container_types>;
+    static_assert(cyl_grid_t::is_bakeable);
+
+    vecmem::host_memory_resource host_mr;
+    auto geo_ctx = typename default_detector_t::geometry_context{};
+
+    constexpr std::size_t n_phi_bins{5u};
+    constexpr std::size_t n_z_bins{4u};
+    const darray<dindex, 2> win{1u, 1u};
+
+    // Build a single volume with a ring of sensitive rectangles
+    auto build_detector = [&](const darray<dindex, 2>& baked_win) {
+        default_detector_t d(host_mr);
+
+        auto vbuilder = std::make_unique<volume_builder<default_detector_t>>(
+            volume_id::e_cylinder, 0u);
+        auto gbuilder =
+            grid_builder<default_detector_t, cyl_grid_t>{std::move(vbuilder)};
+        gbuilder.set_baked_window(baked_win);
+
+        // Enough capacity in every bin
+        std::vector<std::pair<typename cyl_grid_t::loc_bin_index, dindex>>
+            capacities;
+        for (unsigned int i = 0u; i < n_phi_bins; ++i) {
+            for (unsigned int j = 0u; j < n_z_bins; ++j) {
+                capacities.emplace_back(
+                    typename cyl_grid_t::loc_bin_index{i, j}, 8u);
+            }
+        }
+        const auto cyl_mask =
+            mask<concentric_cylinder2D>{0u, 10.f, -500.f, 500.f};
+        gbuilder.init_grid(cyl_mask, {n_phi_bins, n_z_bins}, capacities);
+
+        auto rect_factory = std::make_shared<rectangle_factory>();
+        typename rectangle_factory::sf_data_collection rect_sf_data;
+        for (unsigned int i = 0u; i < 10u; ++i) {
+            const scalar phi{-constant<scalar>::pi +
+                             (static_cast<scalar>(i) + 0.5f) *
+                                 constant<scalar>::pi / 5.f};
+            const scalar z{-375.f + 250.f * static_cast<scalar>(i % 4u)};
+            rect_sf_data.emplace_back(
+                surface_id::e_sensitive,
+                transform3(point3{10.f * math::cos(phi),
+                                  10.f * math::sin(phi), z}),
+                0u, std::vector<scalar>{10.f, 8.f});
+        }
+        rect_factory->push_back(std::move(rect_sf_data));
+        gbuilder.add_surfaces(rect_factory, geo_ctx);
+
+        gbuilder.build(d);
+
+        return d;
+    };
+
+    const default_detector_t d_ref = build_detector({0u, 0u});
+    const default_detector_t d_baked = build_detector(win);
+
+    const auto& ref_grid =
+        d_ref.accelerator_store().template get<acc_ids::e_cylinder2_grid>()[0];
+    const auto& baked_grid =
+        d_baked.accelerator_store()
+            .template get<acc_ids::e_cylinder2_grid>()[0];
+
+    EXPECT_FALSE(ref_grid.is_baked());
+    ASSERT_TRUE(baked_grid.is_baked());
+    EXPECT_EQ(baked_grid.baked_window(), win);
+    EXPECT_EQ(baked_grid.nbins(), ref_grid.nbins());
+
+    // The navigator searches the baked grid with the window it was baked with
+    navigation::config cfg{};
+    cfg.search_window = win;
+
+    for (unsigned int i = 0u; i < 2u * n_phi_bins; ++i) {
+        for (unsigned int j = 0u; j < n_z_bins; ++j) {
+            const scalar phi{-constant<scalar>::pi +
+                             static_cast<scalar>(i) * constant<scalar>::pi /
+                                 static_cast<scalar>(n_phi_bins)};
+            const scalar z{-450.f + 250.f * static_cast<scalar>(j)};
+            const free_track_parameters<test::algebra> track(
+                point3{10.f * math::cos(phi), 10.f * math::sin(phi), z}, 0.f,
+                vector3{math::cos(phi), math::sin(phi), 0.f}, -1.f);
+
+            std::vector<dindex> expected{};
+            for (const auto& sf : ref_grid.search(
+                     d_ref, d_ref.volumes()[0], track, cfg)) {
+                expected.push_back(sf.index());
+            }
+            std::sort(expected.begin(), expected.end());
+            expected.erase(std::unique(expected.begin(), expected.end()),
+                           expected.end());
+
+            std::vector<dindex> result{};
+            for (const auto& sf : baked_grid.search(
+                     d_baked, d_baked.volumes()[0], track, cfg)) {
+                result.push_back(sf.index());
+            }
+            std::sort(result.begin(), result.end());
+
+            EXPECT_EQ(result, expected);
+
+            // The unique search returns the baked bin as it is
+            result.clear();
+            for (const auto& sf : baked_grid.search_unique(
+                     d_baked, d_baked.volumes()[0], track, cfg)) {
+                result.push_back(sf.index());
+            }
+            std::sort(result.begin(), result.end());
+
+            EXPECT_EQ(result, expected);
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/propagator/batch_propagator.hpp"
+
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/state_pool.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/thread_pool.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <atomic>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using vector3 = test::vector3;
+
+namespace {
+
+constexpr scalar_t tol{1e-5f};
+
+}  // anonymous namespace
+
+/// Every item is processed exactly once, independent of the chunking
+GTEST_TEST(detray_utils, thread_pool) {
+
+    thread_pool pool{4u};
+    ASSERT_EQ(pool.size(), 4u);
+
+    constexpr std::size_t n_items{1001u};
+
+    for (std::size_t chunk_size : {1u, 7u, 64u, 2000u}) {
+        std::vector<std::atomic<unsigned int>> counts(n_items);
+
+        pool.parallel_for(n_items, chunk_size,
+                          [&counts](std::size_t thread_idx, std::size_t i) {
+                              ASSERT_LT(thread_idx, 4u);
+                              counts[i].fetch_add(1u);
+                          });
+
+        for (const auto &c : counts) {
+            EXPECT_EQ(c.load(), 1u);
+        }
+    }
+
+    // Exceptions are forwarded to the caller
+    EXPECT_THROW(pool.parallel_for(10u, 1u,
+                                   [](std::size_t, std::size_t i) {
+                                       if (i == 5u) {
+                                           throw std::runtime_error("");
+                                       }
+                                   }),
+                 std::runtime_error);
+
+    // The pool is still usable afterwards
+    std::atomic<std::size_t> sum{0u};
+    pool.parallel_for(10u, 3u,
+                      [&sum](std::size_t, std::size_t i) { sum += i; });
+    EXPECT_EQ(sum.load(), 45u);
+}
+
+/// The batch propagation must give the same results as a sequential
+/// propagation of the same tracks
+GTEST_TEST(detray_propagator, batch_propagator_const_bfield) {
+
+    using bfield_t = bfield::const_field_t;
+    using detector_t = detector<toy_metadata>;
+    using navigator_t = navigator<detector_t>;
+    using track_t = free_track_parameters<algebra_t>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, pathlimit_aborter, parameter_transporter<algebra_t>,
+                    pointwise_material_interactor<algebra_t>,
+                    parameter_resetter<algebra_t>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using generator_t = uniform_track_generator<track_t>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_toy_detector(
+        host_mr, toy_det_config{}.n_brl_layers(4u).n_edc_layers(7u));
+
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar_t>::T};
+    const bfield_t bfield = bfield::create_const_field(B);
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.p_tot(10.f * unit<scalar_t>::GeV);
+
+    std::vector<track_t> tracks;
+    for (auto track : generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+
+    // Fresh actor states for every track
+    auto make_actor_states = [](std::size_t) {
+        return std::make_tuple(
+            pathlimit_aborter::state{},
+            parameter_transporter<algebra_t>::state{},
+            pointwise_material_interactor<algebra_t>::state{},
+            parameter_resetter<algebra_t>::state{});
+    };
+
+    propagator_t p{};
+
+    batch_propagator<propagator_t> batch_prop{p, {4u, 3u}};
+    ASSERT_EQ(batch_prop.n_threads(), 4u);
+
+    const auto result =
+        batch_prop.propagate(det, bfield, tracks, make_actor_states);
+
+    ASSERT_EQ(result.tracks.size(), tracks.size());
+    EXPECT_EQ(result.stats.n_tracks, tracks.size());
+    EXPECT_EQ(result.stats.n_threads, 4u);
+    EXPECT_EQ(result.stats.n_success, tracks.size());
+
+    // Run the same tracks sequentially
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        auto actor_states = make_actor_states(i);
+        auto actor_state_refs = std::apply(
+            [](auto &...states) { return std::tie(states...); }, actor_states);
+
+        propagator_t::state state(tracks[i], bfield, det);
+        const bool success = p.propagate(state, actor_state_refs);
+
+        const auto &res = result.tracks[i];
+        EXPECT_EQ(res.success, success);
+        EXPECT_EQ(res.status, state._navigation.status());
+        EXPECT_EQ(res.volume, state._navigation.volume());
+        EXPECT_NEAR(res.path_length, state._stepping.path_length(), tol);
+        EXPECT_NEAR(res.abs_path_length, state._stepping._abs_path_length,
+                    tol);
+
+        const auto &ref_params = state._stepping();
+        for (unsigned int j = 0u; j < 3u; ++j) {
+            EXPECT_NEAR(res.params.pos()[j], ref_params.pos()[j], tol);
+            EXPECT_NEAR(res.params.dir()[j], ref_params.dir()[j], tol);
+        }
+    }
+
+    // Running the batch again reuses the candidate buffers
+    const auto second_result =
+        batch_prop.propagate(det, bfield, tracks, make_actor_states);
+    EXPECT_EQ(second_result.stats.n_success, result.stats.n_success);
+}
+
+/// The state pool recycles the candidate buffers from track to track
+GTEST_TEST(detray_propagator, state_pool) {
+
+    using bfield_t = bfield::const_field_t;
+    using detector_t = detector<toy_metadata>;
+    using track_t = free_track_parameters<algebra_t>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain<>>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    const bfield_t bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    state_pool<propagator_t> pool{det, 2u};
+    ASSERT_EQ(pool.n_free(), 2u);
+    ASSERT_EQ(pool.buffer_capacity(), det.n_max_candidates());
+
+    propagator_t p{};
+
+    for (auto track : uniform_track_generator<track_t>(10u, 10u)) {
+        auto state = pool.make_state(track, bfield);
+        EXPECT_EQ(pool.n_free(), 1u);
+        EXPECT_GE(state->_navigation.candidates().capacity(),
+                  det.n_max_candidates());
+
+        p.propagate(*state);
+
+        // The buffer did not have to grow
+        EXPECT_GE(state->_navigation.candidates().capacity(),
+                  det.n_max_candidates());
+    }
+    EXPECT_EQ(pool.n_free(), 2u);
+
+    // The buffer is returned early on request
+    auto state = pool.make_state(track_t{}, bfield);
+    state.release();
+    EXPECT_EQ(pool.n_free(), 2u);
+
+    // The pool of the thread is reused for the same detector
+    auto &local_pool = state_pool<propagator_t>::local(det);
+    EXPECT_EQ(&local_pool, &state_pool<propagator_t>::local(det));
+}
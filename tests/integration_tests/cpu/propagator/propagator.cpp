@@ -13,6 +13,7 @@
 #include "detray/detectors/build_toy_detector.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/navigation/detail/trajectories.hpp"
+#include "detray/navigation/intersection/navigation_candidate.hpp"
 #include "detray/navigation/navigator.hpp"
 #include "detray/propagator/actor_chain.hpp"
 #include "detray/propagator/actors/aborters.hpp"
@@ -23,6 +24,8 @@
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/rk_stepper.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/toy_compact_grid_metadata.hpp"
+#include "detray/test/common/toy_indexed_material_metadata.hpp"
 #include "detray/test/common/types.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/inspectors.hpp"
@@ -33,6 +36,13 @@
 // GTest include(s)
 #include <gtest/gtest.h>
 
+// System include(s)
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 using namespace detray;
 
 using algebra_t = test::algebra;
@@ -118,6 +128,122 @@ struct helix_inspector : actor {
     }
 };
 
+/// Record the surfaces that the navigator reaches
+struct surface_recorder : actor {
+
+    struct state {
+        /// barcode and local position for every surface
+        std::vector<std::pair<geometry::barcode, point3>> _surfaces;
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE void operator()(
+        state& recorder_state, const propagator_state_t& prop_state) const {
+
+        const auto& navigation = prop_state._navigation;
+
+        if (navigation.is_on_module() || navigation.is_on_portal()) {
+            recorder_state._surfaces.emplace_back(
+                navigation.barcode(),
+                navigation.local(prop_state._stepping()));
+        }
+    }
+};
+
+/// Track generator for the comparison of two propagations
+using generator_t = uniform_track_generator<free_track_parameters<algebra_t>>;
+
+/// Default constructible states of the actors in an actor list
+/// @{
+template <typename actor_list_t>
+struct actor_states;
+
+template <template <typename...> class tuple_t, typename... actors_t>
+struct actor_states<tuple_t<actors_t...>> {
+    using type = std::tuple<typename actors_t::state...>;
+};
+/// @}
+
+/// No additional checks on the final propagation states
+struct no_state_check {
+    template <typename ref_state_t, typename test_state_t>
+    void operator()(const ref_state_t&, const test_state_t&) const {}
+};
+
+/// Propagate the tracks of @param trk_gen_cfg through the detector
+/// @param ref_det with @param ref_cfg and through @param test_det with
+/// @param test_cfg and check that they reach the same surfaces. The actor
+/// chains have to contain the @c surface_recorder .
+///
+/// @tparam check_t additional check on the final propagation states
+/// @param field the magnetic field, if the stepper needs one
+template <typename ref_prop_t, typename test_prop_t,
+          typename check_t = no_state_check, typename ref_det_t,
+          typename test_det_t, typename... field_t>
+void expect_same_surfaces(const ref_det_t& ref_det,
+                          const propagation::config& ref_cfg,
+                          const test_det_t& test_det,
+                          const propagation::config& test_cfg,
+                          const generator_t::configuration& trk_gen_cfg,
+                          const field_t&... field) {
+
+    using ref_states_t = typename actor_states<
+        typename ref_prop_t::actor_chain_type::actor_list_type>::type;
+    using test_states_t = typename actor_states<
+        typename test_prop_t::actor_chain_type::actor_list_type>::type;
+
+    const auto tie_states = [](auto& states) {
+        return std::apply([](auto&... s) { return std::tie(s...); }, states);
+    };
+
+    ref_prop_t ref_p{ref_cfg};
+    test_prop_t test_p{test_cfg};
+
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        ref_states_t ref_actor_states{};
+        auto ref_actor_state_refs = tie_states(ref_actor_states);
+        typename ref_prop_t::state ref_state(track, field..., ref_det);
+
+        test_states_t test_actor_states{};
+        auto test_actor_state_refs = tie_states(test_actor_states);
+        typename test_prop_t::state test_state(track, field..., test_det);
+
+        ASSERT_TRUE(ref_p.propagate(ref_state, ref_actor_state_refs));
+        ASSERT_TRUE(test_p.propagate(test_state, test_actor_state_refs));
+
+        const auto& ref_sfs =
+            std::get<surface_recorder::state>(ref_actor_states)._surfaces;
+        const auto& test_sfs =
+            std::get<surface_recorder::state>(test_actor_states)._surfaces;
+
+        ASSERT_FALSE(ref_sfs.empty());
+        ASSERT_EQ(ref_sfs.size(), test_sfs.size());
+        for (std::size_t i = 0u; i < ref_sfs.size(); ++i) {
+            const auto& [ref_bcd, ref_loc] = ref_sfs[i];
+            const auto& [bcd, loc] = test_sfs[i];
+
+            EXPECT_EQ(bcd, ref_bcd);
+            EXPECT_NEAR(loc[0], ref_loc[0], tol);
+            EXPECT_NEAR(loc[1], ref_loc[1], tol);
+        }
+
+        check_t{}(ref_state, test_state);
+    }
+}
+
+/// The material interaction leads to the same final momentum and path length
+struct same_energy_loss {
+    template <typename ref_state_t, typename test_state_t>
+    void operator()(const ref_state_t& ref_state,
+                    const test_state_t& test_state) const {
+        EXPECT_FLOAT_EQ(ref_state._stepping().qop(),
+                        test_state._stepping().qop());
+        EXPECT_FLOAT_EQ(ref_state._stepping.path_length(),
+                        test_state._stepping.path_length());
+    }
+};
+
 }  // anonymous namespace
 
 /// Test basic functionality of the propagator using a straight line stepper
@@ -144,6 +270,251 @@ GTEST_TEST(detray_propagator, propagator_line_stepper) {
         << state._navigation.inspector().to_string() << std::endl;
 }
 
+/// Test that the navigation with slim candidates in the navigation cache
+/// finds the same surfaces as with full intersections
+GTEST_TEST(detray_propagator, propagator_slim_candidates) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using candidate_t =
+        navigation_candidate<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t>;
+    using slim_navigator_t =
+        navigator<detector_t, navigation::void_inspector, candidate_t>;
+    using stepper_t = line_stepper<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+    using slim_propagator_t =
+        propagator<stepper_t, slim_navigator_t, actor_chain_t>;
+
+    static_assert(sizeof(candidate_t) <
+                  sizeof(typename navigator_t::intersection_type));
+
+    // The candidates buffer holds the candidate type of the navigator
+    auto candidates_buffer =
+        create_candidates_buffer<detector_t, candidate_t>(d, 1u, host_mr);
+    static_assert(
+        std::is_same_v<decltype(candidates_buffer),
+                       vecmem::data::jagged_vector_buffer<candidate_t>>);
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+
+    expect_same_surfaces<propagator_t, slim_propagator_t>(
+        d, propagation::config{}, d, propagation::config{}, trk_gen_cfg);
+}
+
+/// Test that the navigation with the ray marching grid search finds the same
+/// surfaces as the search window around the track position
+GTEST_TEST(detray_propagator, propagator_ray_march_grid_search) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+
+    propagation::config march_cfg{};
+    march_cfg.navigation.grid_search_mode =
+        navigation::grid_search::e_ray_march;
+
+    expect_same_surfaces<propagator_t, propagator_t>(
+        d, propagation::config{}, d, march_cfg, trk_gen_cfg);
+}
+
+/// Test that the partial and the incremental sorting of the navigation
+/// candidates lead the navigation to the same surfaces as a full sort
+GTEST_TEST(detray_propagator, propagator_candidate_sorting) {
+
+    using bfield_t = bfield::const_field_t;
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    const bfield_t bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    // Reference: Full sort of the candidates on every update
+    propagation::config ref_cfg{};
+    ref_cfg.navigation.incremental_sort = false;
+    ref_cfg.navigation.n_sorted_candidates = 0u;
+
+    // Incremental repair of the candidate order on fair trust updates
+    propagation::config incr_cfg{};
+    incr_cfg.navigation.incremental_sort = true;
+    incr_cfg.navigation.n_sorted_candidates = 0u;
+
+    // Only the nearest candidates are sorted
+    propagation::config partial_cfg{};
+    partial_cfg.navigation.incremental_sort = false;
+    partial_cfg.navigation.n_sorted_candidates = 2u;
+
+    // Both
+    propagation::config partial_incr_cfg{};
+    partial_incr_cfg.navigation.incremental_sort = true;
+    partial_incr_cfg.navigation.n_sorted_candidates = 3u;
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    for (const auto& test_cfg : {incr_cfg, partial_cfg, partial_incr_cfg}) {
+        expect_same_surfaces<propagator_t, propagator_t>(
+            d, ref_cfg, d, test_cfg, trk_gen_cfg, bfield);
+    }
+}
+
+/// Test that the propagation of free tracks starts in the volume that
+/// contains the track position
+GTEST_TEST(detray_propagator, propagator_start_volume) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    // Start in the barrel, outside of the beampipe volume
+    const point3 ori{100.f, 0.f, 0.f};
+    const dindex start_volume{d.volume_index(ori)};
+    ASSERT_NE(start_volume, dindex_invalid);
+    ASSERT_NE(start_volume, 0u);
+    EXPECT_EQ(d.volume(ori).index(), start_volume);
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+    trk_gen_cfg.origin({ori[0], ori[1], ori[2]});
+
+    propagator_t p{};
+
+    for (auto track : generator_t{trk_gen_cfg}) {
+
+        surface_recorder::state recorder{};
+        auto actor_states = std::tie(recorder);
+        propagator_t::state state(track, d);
+
+        ASSERT_EQ(state._navigation.volume(), start_volume);
+
+        ASSERT_TRUE(p.propagate(state, actor_states));
+
+        // The first surface is reached in the start volume
+        ASSERT_FALSE(recorder._surfaces.empty());
+        EXPECT_EQ(recorder._surfaces.front().first.volume(), start_volume);
+    }
+}
+
+/// Test that the navigation through the compacted surface grids finds the
+/// same surfaces as through the regular surface grids
+GTEST_TEST(detray_propagator, propagator_compact_grids) {
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(false);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+    const auto [cmp_d, cmp_names] =
+        build_toy_detector<scalar_t, test::toy_compact_grid_metadata>(
+            host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using cmp_detector_t = std::remove_cv_t<decltype(cmp_d)>;
+    using stepper_t = line_stepper<algebra_t>;
+    using actor_chain_t = actor_chain<dtuple, surface_recorder>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+    using cmp_propagator_t =
+        propagator<stepper_t, navigator<cmp_detector_t>, actor_chain_t>;
+
+    // The builder compacted the grids when adding them to the detector
+    using accel_id = typename cmp_detector_t::accel::id;
+    using cyl_grid_t = typename cmp_detector_t::accelerator_container::
+        template get_type<accel_id::e_cylinder2_grid>;
+    static_assert(std::is_same_v<typename cyl_grid_t::value_type,
+                                 std::uint_least16_t>);
+
+    const auto& cyl_grids =
+        cmp_d.accelerator_store().get<accel_id::e_cylinder2_grid>();
+    EXPECT_EQ(cyl_grids.size(),
+              d.accelerator_store().get<accel_id::e_cylinder2_grid>().size());
+    EXPECT_EQ(cmp_d.surfaces().size(), d.surfaces().size());
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(20u).theta_steps(20u);
+
+    expect_same_surfaces<propagator_t, cmp_propagator_t>(
+        d, propagation::config{}, cmp_d, propagation::config{}, trk_gen_cfg);
+}
+
+/// Test that the material interaction with indexed material maps gives the
+/// same result as with material maps that store the full material slabs
+GTEST_TEST(detray_propagator, propagator_indexed_material_maps) {
+
+    using bfield_t = bfield::const_field_t;
+
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [d, names] = build_toy_detector(host_mr, toy_cfg);
+    const auto [idx_d, idx_names] =
+        build_toy_detector<scalar_t, test::toy_indexed_material_metadata>(
+            host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(d)>;
+    using idx_detector_t = std::remove_cv_t<decltype(idx_d)>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, parameter_transporter<algebra_t>,
+                    pointwise_material_interactor<algebra_t>,
+                    parameter_resetter<algebra_t>, surface_recorder>;
+    using propagator_t =
+        propagator<stepper_t, navigator<detector_t>, actor_chain_t>;
+    using idx_propagator_t =
+        propagator<stepper_t, navigator<idx_detector_t>, actor_chain_t>;
+
+    using mat_id = typename idx_detector_t::materials::id;
+    using disc_map_t = typename idx_detector_t::material_container::
+        template get_type<mat_id::e_disc2_map>;
+    static_assert(detail::is_indexed_material_map_v<disc_map_t>);
+
+    const bfield_t bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.phi_steps(10u).theta_steps(10u);
+    trk_gen_cfg.p_tot(1.f * unit<scalar_t>::GeV);
+
+    // Same surfaces and the same energy loss along the way
+    expect_same_surfaces<propagator_t, idx_propagator_t, same_energy_loss>(
+        d, propagation::config{}, idx_d, propagation::config{}, trk_gen_cfg,
+        bfield);
+}
+
 /// Fixture for Runge-Kutta Propagation
 class PropagatorWithRkStepper
     : public ::testing::TestWithParam<
@@ -0,0 +1,123 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/simulation/fast_simulator.hpp"
+
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/test/common/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+using vector3 = test::vector3;
+
+/// The simulated hits must not depend on the number of threads
+GTEST_TEST(detray_simulation, fast_simulator) {
+
+    using bfield_t = bfield::const_field_t;
+    using detector_t = detector<toy_metadata>;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using simulator_t = fast_simulator<stepper_t, navigator<detector_t>>;
+    using hit_collection_t = simulator_t::hit_collection;
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    const bfield_t bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar_t>::T});
+
+    simulator_t::config cfg{};
+    cfg.track_generator.n_tracks(200u).seed(42u).randomize_charge(true);
+    cfg.track_generator.mom_range(1.f * unit<scalar_t>::GeV,
+                                  10.f * unit<scalar_t>::GeV);
+    cfg.track_generator.eta_range(-3.f, 3.f);
+    cfg.batch_size = 50u;
+    cfg.chunk_size = 3u;
+    cfg.hit_buffer_capacity = 64u;
+
+    // Collect the hits of a simulation run
+    auto simulate = [&](const simulator_t::config &sim_cfg,
+                        hit_collection_t &hits) {
+        simulator_t sim{sim_cfg};
+        EXPECT_EQ(sim.n_threads(), sim_cfg.n_threads);
+
+        std::size_t n_batches{0u};
+        const auto summary =
+            sim.run(det, bfield, [&](const hit_collection_t &batch) {
+                hits.insert(hits.end(), batch.begin(), batch.end());
+                ++n_batches;
+            });
+
+        EXPECT_EQ(summary.stats.n_tracks, 200u);
+        EXPECT_EQ(summary.stats.n_success, 200u);
+        EXPECT_EQ(summary.n_hits, hits.size());
+        EXPECT_GT(n_batches, 1u);
+
+        return n_batches;
+    };
+
+    // Deterministic mode
+    cfg.n_threads = 1u;
+    hit_collection_t hits_single{};
+    const std::size_t n_batches_single{simulate(cfg, hits_single)};
+
+    // The hits of 50 tracks do not fit into the buffer: smaller batches
+    EXPECT_GT(n_batches_single, 200u / cfg.batch_size);
+
+    cfg.n_threads = 4u;
+    hit_collection_t hits_multi{};
+    simulate(cfg, hits_multi);
+
+    ASSERT_FALSE(hits_single.empty());
+    EXPECT_EQ(hits_single, hits_multi);
+
+    for (std::size_t i = 1u; i < hits_single.size(); ++i) {
+        EXPECT_LE(hits_single[i - 1u].track_id, hits_single[i].track_id);
+    }
+    for (const auto &h : hits_single) {
+        EXPECT_EQ(h.event_id, 0u);
+        EXPECT_EQ(h.surface.id(), surface_id::e_sensitive);
+    }
+
+    // Throughput mode: Same hits in a different order
+    cfg.deterministic = false;
+    hit_collection_t hits_unordered{};
+    simulate(cfg, hits_unordered);
+
+    std::stable_sort(hits_unordered.begin(), hits_unordered.end(),
+                     [](const auto &a, const auto &b) {
+                         return a.track_id < b.track_id;
+                     });
+    EXPECT_EQ(hits_single, hits_unordered);
+
+    // A different event gives different hits
+    cfg.deterministic = true;
+    cfg.track_generator.event(1u);
+    hit_collection_t hits_other_event{};
+    simulate(cfg, hits_other_event);
+
+    ASSERT_FALSE(hits_other_event.empty());
+    EXPECT_EQ(hits_other_event.front().event_id, 1u);
+    EXPECT_NE(hits_other_event.front().loc0, hits_single.front().loc0);
+}
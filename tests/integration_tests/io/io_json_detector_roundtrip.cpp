@@ -16,6 +16,7 @@
 #include "detray/io/frontend/detector_writer.hpp"
 #include "detray/io/json/json_reader.hpp"
 #include "detray/io/json/json_writer.hpp"
+#include "detray/test/common/toy_indexed_material_metadata.hpp"
 #include "detray/test/cpu/toy_detector_test.hpp"
 #include "detray/utils/consistency_checker.hpp"
 
@@ -28,6 +29,9 @@
 // System include(s)
 #include <filesystem>
 #include <ios>
+#include <map>
+#include <string>
+#include <type_traits>
 
 using namespace detray;
 
@@ -274,6 +278,70 @@ GTEST_TEST(io, json_toy_detector_roundtrip_material_maps) {
     // EXPECT_TRUE(toy_detector_test(det_io, names_io));
 }
 
+/// Test the reading and writing of a toy detector with indexed material maps
+GTEST_TEST(io, json_toy_detector_roundtrip_indexed_material_maps) {
+
+    using metadata_t = test::toy_indexed_material_metadata;
+
+    // Toy detectors with the same material, stored with and without material
+    // table
+    vecmem::host_memory_resource host_mr;
+    toy_det_config toy_cfg{};
+    toy_cfg.use_material_maps(true);
+    const auto [toy_det, toy_names] =
+        build_toy_detector<scalar, metadata_t>(host_mr, toy_cfg);
+    const auto [slab_det, slab_names] = build_toy_detector(host_mr, toy_cfg);
+
+    using detector_t = std::remove_cv_t<decltype(toy_det)>;
+    using mat_id = typename detector_t::materials::id;
+    const auto& mat_store = toy_det.material_store();
+    const auto& disc_maps = mat_store.get<mat_id::e_disc2_map>();
+    const auto& cyl_maps = mat_store.get<mat_id::e_concentric_cylinder2_map>();
+
+    // Every distinct material is stored only once
+    EXPECT_EQ(disc_maps.size(),
+              slab_det.material_store().get<mat_id::e_disc2_map>().size());
+    EXPECT_EQ(
+        cyl_maps.size(),
+        slab_det.material_store().get<mat_id::e_concentric_cylinder2_map>()
+            .size());
+    EXPECT_FALSE(disc_maps.materials().empty());
+    EXPECT_LT(disc_maps.materials().size(), disc_maps[0].nbins());
+    EXPECT_LT(cyl_maps.materials().size(), cyl_maps[0].nbins());
+
+    std::map<std::string, std::string> file_names;
+    file_names["geometry"] = "toy_detector_geometry.json";
+    file_names["homogeneous_material"] =
+        "toy_detector_homogeneous_material.json";
+    file_names["material_maps"] = "toy_detector_material_maps.json";
+    file_names["surface_grids"] = "toy_detector_surface_grids.json";
+
+    auto [det_io, names_io] =
+        test_detector_json_io<1u>(toy_det, toy_names, file_names, host_mr);
+
+    const auto& io_mat_store = det_io.material_store();
+    EXPECT_EQ(io_mat_store.get<mat_id::e_disc2_map>().size(), disc_maps.size());
+    EXPECT_EQ(io_mat_store.get<mat_id::e_disc2_map>().materials().size(),
+              disc_maps.materials().size());
+
+    // The indexed maps are written as full material slabs
+    auto slab_names_io = slab_names;
+    slab_names_io.at(0u) = "toy_detector_slab";
+    auto writer_cfg = io::detector_writer_config{}
+                          .format(io::format::json)
+                          .replace_files(true)
+                          .write_grids(false)
+                          .write_material(true);
+    io::write_detector(slab_det, slab_names_io, writer_cfg);
+
+    const std::string slab_mat_file{"toy_detector_slab_material_maps.json"};
+    EXPECT_TRUE(compare_files(file_names["material_maps"], slab_mat_file));
+
+    std::filesystem::remove("toy_detector_slab_geometry.json");
+    std::filesystem::remove("toy_detector_slab_homogeneous_material.json");
+    std::filesystem::remove(slab_mat_file);
+}
+
 /// Test the reading and writing of a wire chamber
 GTEST_TEST(io, json_wire_chamber_reader) {
 
@@ -0,0 +1,107 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/simulation/fast_simulator.hpp"
+
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/io/csv/hit.hpp"
+#include "detray/io/frontend/detector_reader.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/options/detector_io_options.hpp"
+#include "detray/options/parse_options.hpp"
+#include "detray/options/propagation_options.hpp"
+#include "detray/options/track_generator_options.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Boost
+#include <boost/program_options.hpp>
+
+// System include(s)
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace po = boost::program_options;
+using namespace detray;
+
+int main(int argc, char **argv) {
+
+    // Use the most general type to be able to read in all detector files
+    using detector_t = detray::detector<>;
+    using algebra_t = typename detector_t::algebra_type;
+    using scalar_t = dscalar<algebra_t>;
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+    using simulator_t = fast_simulator<stepper_t, navigator<detector_t>>;
+
+    // Specific options for this tool
+    po::options_description desc("\ndetray fast simulation options");
+
+    desc.add_options()(
+        "output",
+        po::value<std::string>()->default_value("./fast_sim/hits.csv"),
+        "Output csv file for the simulated hits")(
+        "bz", po::value<float>()->default_value(2.f),
+        "Magnetic field strength along z [T]")(
+        "seed", po::value<std::uint64_t>()->default_value(42u),
+        "Monte-Carlo seed")("event",
+                            po::value<std::uint32_t>()->default_value(0u),
+                            "Event index")(
+        "n_threads", po::value<std::size_t>()->default_value(0u),
+        "No. threads (0: No. hardware threads)")(
+        "batch_size", po::value<std::size_t>()->default_value(10000u),
+        "No. tracks between two hit flushes")(
+        "hit_buffer_size", po::value<std::size_t>()->default_value(100000u),
+        "No. hits every thread buffer is preallocated for")(
+        "no_energy_loss", "Don't simulate the energy loss")(
+        "no_scattering", "Don't simulate the multiple scattering")(
+        "throughput_mode",
+        "Write the hits as soon as a thread buffer is full (the order of "
+        "the hits depends on the scheduling)");
+
+    // Configs to be filled
+    detray::io::detector_reader_config reader_cfg{};
+    simulator_t::config sim_cfg{};
+
+    po::variables_map vm = detray::options::parse_options(
+        desc, argc, argv, reader_cfg, sim_cfg.track_generator,
+        sim_cfg.propagation);
+
+    sim_cfg.track_generator.seed(vm["seed"].as<std::uint64_t>());
+    sim_cfg.track_generator.event(vm["event"].as<std::uint32_t>());
+    sim_cfg.n_threads = vm["n_threads"].as<std::size_t>();
+    sim_cfg.batch_size = vm["batch_size"].as<std::size_t>();
+    sim_cfg.hit_buffer_capacity = vm["hit_buffer_size"].as<std::size_t>();
+    sim_cfg.do_energy_loss = !vm.count("no_energy_loss");
+    sim_cfg.do_multiple_scattering = !vm.count("no_scattering");
+    sim_cfg.deterministic = !vm.count("throughput_mode");
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto [det, names] =
+        detray::io::read_detector<detector_t>(host_mr, reader_cfg);
+
+    const scalar_t bz{vm["bz"].as<float>() * unit<scalar_t>::T};
+    const bfield_t bfield =
+        bfield::create_const_field(dvector3D<algebra_t>{0.f, 0.f, bz});
+
+    // Stream the hits to file
+    io::csv::hit_writer writer{vm["output"].as<std::string>()};
+
+    simulator_t sim{sim_cfg};
+    const auto summary = sim.run(det, bfield, writer);
+
+    std::cout << "\nFast simulation\n"
+              << "----------------------------\n"
+              << summary << std::endl;
+}
@@ -0,0 +1,168 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/builders/bvh_builder.hpp"
+
+#include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/geometry/shapes/rectangle2D.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/test/common/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// Gtest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <memory>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+using detector_t = detector<>;
+using bvh_t = typename bvh_collection<detector_t::surface_type>::value_type;
+
+/// Build a single cuboid volume with a row of sensitive rectangles, one
+/// passive rectangle and a box of portals into the detector @param d
+void build_volume(detector_t &d, const bool add_passives) {
+
+    using transform3 = typename detector_t::transform3_type;
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+
+    const auto geo_ctx = typename detector_t::geometry_context{};
+
+    auto vbuilder = std::make_unique<volume_builder<detector_t>>(
+        volume_id::e_cuboid, 0u);
+    vbuilder->add_volume_placement(point3{0.f, 0.f, 0.f});
+
+    auto bvh_bldr = bvh_builder<detector_t, bvh_t>{std::move(vbuilder)};
+    bvh_bldr.set_add_passives(add_passives);
+    bvh_bldr.set_max_leaf_size(2u);
+
+    // Sensitive planes along the x-axis and one passive plane
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    typename rectangle_factory::sf_data_collection rect_sf_data;
+    for (unsigned int i = 0u; i < 7u; ++i) {
+        rect_sf_data.emplace_back(
+            surface_id::e_sensitive,
+            transform3(point3{10.f * static_cast<scalar>(i), 0.f, 0.f},
+                       vector3{1.f, 0.f, 0.f}, vector3{0.f, 1.f, 0.f}),
+            0u, std::vector<scalar>{5.f, 5.f});
+    }
+    rect_sf_data.emplace_back(surface_id::e_passive,
+                              transform3(point3{30.f, 0.f, 20.f}), 0u,
+                              std::vector<scalar>{5.f, 5.f});
+    rect_factory->push_back(std::move(rect_sf_data));
+    bvh_bldr.add_surfaces(rect_factory, geo_ctx);
+
+    bvh_bldr.add_surfaces(
+        std::make_shared<cuboid_portal_generator<detector_t>>(0.1f));
+
+    bvh_bldr.build(d);
+}
+
+}  // anonymous namespace
+
+/// Unittest: Test the bounding volume hierarchy builder
+GTEST_TEST(detray_builders, bvh_builder) {
+
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+    using acc_ids = typename detector_t::accel::id;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    build_volume(d, false);
+
+    ASSERT_EQ(d.volumes().size(), 1u);
+    const auto &vol = d.volumes().back();
+
+    // The sensitives are referenced through the hierarchy
+    EXPECT_EQ(vol.template accel_link<geo_obj_id::e_portal>().id(),
+              acc_ids::e_brute_force);
+    EXPECT_EQ(vol.template accel_link<geo_obj_id::e_sensitive>().id(),
+              acc_ids::e_bvh);
+    EXPECT_EQ(vol.template accel_link<geo_obj_id::e_sensitive>().index(), 0u);
+
+    EXPECT_EQ(d.surfaces().size(), 14u);
+    ASSERT_EQ(d.accelerator_store().template size<acc_ids::e_bvh>(), 1u);
+
+    // Portals and passives stay in the brute force method
+    const auto &bf_finder =
+        d.accelerator_store().template get<acc_ids::e_brute_force>()[0];
+    for (const auto &sf : bf_finder.all()) {
+        EXPECT_FALSE(sf.is_sensitive());
+        EXPECT_EQ(sf.volume(), 0u);
+    }
+
+    // Only the sensitives are in the hierarchy
+    const auto bvh = d.accelerator_store().template get<acc_ids::e_bvh>()[0];
+    EXPECT_EQ(bvh.all().size(), 7u);
+    EXPECT_TRUE(bvh.n_nodes() > 1u);
+    for (const auto &sf : bvh.all()) {
+        EXPECT_TRUE(sf.is_sensitive());
+        EXPECT_EQ(sf.volume(), 0u);
+        EXPECT_FALSE(detail::is_invalid_value(sf.index()));
+    }
+
+    // A ray along the x-axis hits the boxes of all sensitives, a ray that
+    // is displaced in z only the box of a single sensitive
+    const detail::ray<test::algebra> ray_x(point3{-1.f, 0.f, 0.f}, 0.f,
+                                           vector3{1.f, 0.f, 0.f}, -1.f);
+    std::size_t n_found{0u};
+    for (const auto &sf : bvh.search(ray_x)) {
+        EXPECT_TRUE(sf.is_sensitive());
+        ++n_found;
+    }
+    EXPECT_EQ(n_found, 7u);
+
+    const detail::ray<test::algebra> ray_z(point3{40.f, 0.f, -10.f}, 0.f,
+                                           vector3{0.f, 0.f, 1.f}, -1.f);
+    n_found = 0u;
+    for (const auto &sf : bvh.search(ray_z)) {
+        EXPECT_EQ(d.transform_store()[sf.transform()].translation()[0], 40.f);
+        ++n_found;
+    }
+    EXPECT_EQ(n_found, 1u);
+}
+
+/// Unittest: Test the bounding volume hierarchy builder including passives
+GTEST_TEST(detray_builders, bvh_builder_passives) {
+
+    using acc_ids = typename detector_t::accel::id;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    build_volume(d, true);
+
+    // The passives are in both the brute force method and the hierarchy
+    const auto &bf_finder =
+        d.accelerator_store().template get<acc_ids::e_brute_force>()[0];
+    for (const auto &sf : bf_finder.all()) {
+        EXPECT_FALSE(sf.is_sensitive());
+    }
+
+    const auto bvh = d.accelerator_store().template get<acc_ids::e_bvh>()[0];
+    EXPECT_EQ(bvh.all().size(), 8u);
+
+    std::size_t n_passives{0u};
+    for (const auto &sf : bvh.all()) {
+        EXPECT_FALSE(sf.is_portal());
+        n_passives += sf.is_passive() ? 1u : 0u;
+    }
+    EXPECT_EQ(n_passives, 1u);
+}
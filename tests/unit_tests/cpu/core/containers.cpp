@@ -20,6 +20,7 @@
 // System include(s)
 #include <array>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 using namespace detray;
@@ -109,6 +110,54 @@ GTEST_TEST(detray_core, tuple_container) {
     EXPECT_TRUE(detail::get<2>(container).empty());
 }
 
+namespace {
+
+/// Element type that knows its position in the tuple
+template <std::size_t I>
+struct visit_payload {
+    std::size_t tuple_index{I};
+};
+
+/// @returns the tuple index of the visited element type
+struct get_tuple_index {
+    template <typename container_t>
+    std::size_t operator()(const container_t& coll,
+                           const unsigned int index) const {
+        return coll.empty() ? 0u : coll[index].tuple_index;
+    }
+};
+
+/// Make a tuple container with more elements than fit in one switch
+template <std::size_t... I>
+auto make_visit_container(vecmem::memory_resource& resource,
+                          std::index_sequence<I...>) {
+    return detail::tuple_container<std::tuple,
+                                   vecmem::vector<visit_payload<I>>...>(
+        resource, vecmem::vector<visit_payload<I>>(1u, visit_payload<I>{},
+                                                   &resource)...);
+}
+
+}  // namespace
+
+GTEST_TEST(detray_core, tuple_container_visit) {
+
+    // Vecmem memory resource
+    vecmem::host_memory_resource resource;
+
+    constexpr std::size_t n_types{37u};
+    const auto container =
+        make_visit_container(resource, std::make_index_sequence<n_types>{});
+
+    // Both dispatch strategies have to find the same tuple element
+    for (std::size_t i = 0u; i < n_types; ++i) {
+        EXPECT_EQ(container.visit<get_tuple_index>(i, 0u), i);
+        EXPECT_EQ(
+            (container.visit<get_tuple_index, detail::visit_dispatch::e_linear>(
+                i, 0u)),
+            i);
+    }
+}
+
 GTEST_TEST(detray_core, vector_multi_store) {
 
     // Vecmem memory resource
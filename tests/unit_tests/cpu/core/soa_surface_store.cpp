@@ -0,0 +1,252 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s).
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+
+// Project include(s)
+#include "detray/core/detail/soa_surface_store.hpp"
+
+#include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/soa_intersection_kernel.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using algebra_v = detray::vc_soa<test::scalar>;
+using point3 = test::point3;
+
+/// Compare every lane of the mirror with the AoS surface it holds
+template <typename detector_t, std::size_t... I>
+void check_lanes(const detector_t &det,
+                 const soa_surface_store<detector_t, algebra_v> &soa_store,
+                 std::index_sequence<I...>) {
+
+    using mask_registry = typename detector_t::masks;
+
+    const typename detector_t::geometry_context ctx{};
+    std::size_t n_mirrored{0u};
+
+    auto check_mask_type = [&](auto idx) {
+        constexpr auto id{mask_registry::to_id(decltype(idx)::value)};
+
+        const auto &chunks = soa_store.template chunks<id>();
+        const auto &masks = det.mask_store().template get<id>();
+
+        for (dindex c = 0u; c < chunks.size(); ++c) {
+            const auto &soa_trf = chunks.transforms[c];
+            const auto soa_z = getter::vector<3>(soa_trf.matrix(), 0u, 2u);
+            const auto soa_x = getter::vector<3>(soa_trf.matrix(), 0u, 0u);
+
+            for (dindex lane = 0u; lane < soa_store.width; ++lane) {
+                const dindex sf_idx{chunks.surfaces[c][lane]};
+                // Padding lanes: Only at the end of a chunk
+                if (sf_idx == dindex_invalid) {
+                    EXPECT_GT(lane, 0u);
+                    continue;
+                }
+                ++n_mirrored;
+
+                const auto &sf = det.surfaces()[sf_idx];
+                EXPECT_EQ(sf.index(), sf_idx);
+                EXPECT_EQ(sf.mask().id(), id);
+
+                const auto &link = soa_store.link(sf_idx);
+                EXPECT_EQ(link.id, id);
+                EXPECT_EQ(link.chunk, c);
+                EXPECT_EQ(link.lane, lane);
+
+                const auto &range = soa_store.chunk_range(sf.volume(), id);
+                EXPECT_TRUE(range[0] <= c && c < range[1]);
+
+                const auto &m = masks[sf.mask().index()];
+                for (std::size_t k = 0u; k < m.values().size(); ++k) {
+                    EXPECT_FLOAT_EQ(chunks.masks[c][k][lane], m[k]);
+                }
+
+                const auto &trf =
+                    det.transform_store().at(sf.transform(), ctx);
+                const auto z = getter::vector<3>(trf.matrix(), 0u, 2u);
+                const auto x = getter::vector<3>(trf.matrix(), 0u, 0u);
+                for (unsigned int k = 0u; k < 3u; ++k) {
+                    EXPECT_FLOAT_EQ(soa_trf.translation()[k][lane],
+                                    trf.translation()[k]);
+                    EXPECT_FLOAT_EQ(soa_z[k][lane], z[k]);
+                    EXPECT_FLOAT_EQ(soa_x[k][lane], x[k]);
+                }
+            }
+        }
+    };
+    (check_mask_type(std::integral_constant<std::size_t, I>{}), ...);
+
+    // All surfaces of the test detectors have a single mask
+    EXPECT_EQ(n_mirrored, det.surfaces().size());
+}
+
+}  // anonymous namespace
+
+/// Fill the mirror together with the detector in the detector builder
+GTEST_TEST(detray_core, soa_surface_store_builder) {
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3_type;
+    using trapezoid_factory = surface_factory<detector_t, trapezoid2D>;
+
+    const auto geo_ctx = typename detector_t::geometry_context{};
+
+    detector_builder<default_metadata> det_builder{};
+
+    // Volume with more sensitive surfaces than SIMD lanes
+    auto vbuilder = det_builder.new_volume(volume_id::e_cuboid);
+    vbuilder->add_volume_placement(point3{0.f, 0.f, 0.f});
+
+    const auto vol_idx{
+        static_cast<typename detector_t::surface_type::navigation_link>(
+            vbuilder->vol_index())};
+
+    auto trpz_factory = std::make_shared<trapezoid_factory>();
+    typename trapezoid_factory::sf_data_collection trpz_sf_data;
+    constexpr dindex width{soa_surface_store<detector_t, algebra_v>::width};
+    for (unsigned int i = 0u; i < 2u * width + 1u; ++i) {
+        trpz_sf_data.emplace_back(
+            surface_id::e_sensitive,
+            transform3(point3{0.1f * static_cast<scalar>(i), 0.f,
+                              10.f * static_cast<scalar>(i)}),
+            vol_idx, std::vector<scalar>{1.f, 3.f, 2.f, 0.25f});
+    }
+    trpz_factory->push_back(std::move(trpz_sf_data));
+    vbuilder->add_surfaces(trpz_factory, geo_ctx);
+
+    // Add a portal box around the volume
+    vbuilder->add_surfaces(
+        std::make_shared<cuboid_portal_generator<detector_t>>(0.1f));
+
+    vecmem::host_memory_resource host_mr;
+    soa_surface_store<detector_t, algebra_v> soa_store{};
+    const detector_t det = det_builder.build(host_mr, soa_store);
+
+    EXPECT_EQ(soa_store.n_volumes(), det.volumes().size());
+    check_lanes(det, soa_store,
+                std::make_index_sequence<detector_t::masks::n_types>{});
+}
+
+/// Compare the lanes of the mirror of the toy detector with its surfaces and
+/// the intersections found from the mirror with the scalar intersections
+GTEST_TEST(detray_core, soa_surface_store_toy_detector) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    using detector_t = std::remove_cv_t<decltype(det)>;
+    using surface_t = typename detector_t::surface_type;
+    using intersection_t = intersection2D<surface_t, algebra_t>;
+
+    const soa_surface_store<detector_t, algebra_v> soa_store{det, host_mr};
+
+    EXPECT_EQ(soa_store.n_volumes(), det.volumes().size());
+    check_lanes(det, soa_store,
+                std::make_index_sequence<detector_t::masks::n_types>{});
+
+    const std::array<scalar, 2u> mask_tol{0.f, 0.f};
+    const scalar mask_tol_scalor{0.f};
+    const scalar overstep_tol{-100.f};
+
+    // Sort the surfaces of every volume by mask type
+    std::vector<std::vector<surface_t>> vol_surfaces(det.volumes().size());
+    for (const auto &sf : det.surfaces()) {
+        vol_surfaces[sf.volume()].push_back(sf);
+    }
+    for (auto &surfaces : vol_surfaces) {
+        std::stable_sort(surfaces.begin(), surfaces.end(),
+                         [](const surface_t &a, const surface_t &b) {
+                             return a.mask().id() < b.mask().id();
+                         });
+    }
+
+    auto by_surface = [](const intersection_t &a, const intersection_t &b) {
+        return a.sf_desc.index() < b.sf_desc.index() ||
+               (a.sf_desc.index() == b.sf_desc.index() && a.path < b.path);
+    };
+
+    std::size_t n_intersections{0u};
+    std::vector<intersection_t> scalar_is;
+    std::vector<intersection_t> soa_is;
+
+    using ray_generator_t = uniform_track_generator<detail::ray<algebra_t>>;
+    for (const auto ray : ray_generator_t(20u, 20u)) {
+        for (const auto &surfaces : vol_surfaces) {
+            // Intersect the surfaces of the same mask type in one go
+            for (std::size_t begin = 0u; begin < surfaces.size();) {
+                const auto id = surfaces[begin].mask().id();
+                std::size_t end{begin + 1u};
+                while (end < surfaces.size() &&
+                       surfaces[end].mask().id() == id) {
+                    ++end;
+                }
+                const auto n{static_cast<dindex>(end - begin)};
+
+                scalar_is.clear();
+                soa_is.clear();
+
+                det.mask_store()
+                    .template visit<
+                        intersection_initialize_batch<ray_intersector>>(
+                        id, surfaces.data() + begin, n, scalar_is, ray,
+                        det.transform_store(), mask_tol, mask_tol_scalor,
+                        overstep_tol);
+                det.mask_store()
+                    .template visit<
+                        soa_intersection_initialize_batch<algebra_v>>(
+                        id, surfaces.data() + begin, n, soa_store, soa_is,
+                        ray, det.transform_store(), mask_tol, mask_tol_scalor,
+                        overstep_tol);
+
+                ASSERT_EQ(soa_is.size(), scalar_is.size());
+
+                std::sort(scalar_is.begin(), scalar_is.end(), by_surface);
+                std::sort(soa_is.begin(), soa_is.end(), by_surface);
+                for (std::size_t i = 0u; i < soa_is.size(); ++i) {
+                    EXPECT_EQ(soa_is[i].sf_desc, scalar_is[i].sf_desc);
+                    EXPECT_EQ(soa_is[i].volume_link, scalar_is[i].volume_link);
+                    const scalar path{scalar_is[i].path};
+                    EXPECT_NEAR(
+                        soa_is[i].path, path,
+                        1e-3f * std::max(scalar{1.f}, math::fabs(path)));
+                }
+                n_intersections += soa_is.size();
+
+                begin = end;
+            }
+        }
+    }
+
+    EXPECT_TRUE(n_intersections > 0u);
+}
@@ -26,4 +26,15 @@ GTEST_TEST(detray_detectors, wire_chamber) {
 
     // Check general consistency of the detector
     detail::check_consistency(wire_det, true, names);
+
+    // Find the volumes by position
+    using point3_t = typename decltype(wire_det)::point3_type;
+
+    EXPECT_EQ(wire_det.volume_index(point3_t{0.f, 0.f, 0.f}), 0u);
+    EXPECT_EQ(wire_det.volume_index(point3_t{0.f, 510.f, 900.f}), 1u);
+    EXPECT_EQ(wire_det.volume_index(point3_t{-610.f, 0.f, -100.f}), 6u);
+    EXPECT_EQ(wire_det.volume_index(point3_t{0.f, 0.f, 1200.f}),
+              dindex_invalid);
+    EXPECT_EQ(wire_det.volume_index(point3_t{800.f, 0.f, 0.f}),
+              dindex_invalid);
 }
@@ -0,0 +1,194 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/materials/detail/relativistic_quantities.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/propagator/actors/pointwise_material_interactor.hpp"
+#include "detray/test/common/types.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+using namespace detray;
+
+namespace {
+
+// Muon hypothesis
+constexpr int pdg{pdg_particle::eMuon};
+constexpr scalar mass{105.7f * unit<scalar>::MeV};
+constexpr scalar q{-1.f};
+
+// Maximal relative deviation from the analytic expressions
+constexpr scalar rel_tol{1e-3f};
+
+}  // anonymous namespace
+
+// Compare the tabulated interactions with the analytic expressions
+GTEST_TEST(detray_material, interaction_table) {
+
+    interaction<scalar> I;
+    interaction_table<scalar> table(pdg, mass, q);
+
+    const dindex si_idx{table.add_material(silicon<scalar>())};
+    const dindex ar_idx{table.add_material(argon_liquid<scalar>())};
+
+    // Materials are only tabulated once
+    EXPECT_EQ(table.add_material(silicon<scalar>()), si_idx);
+    EXPECT_EQ(table.n_materials(), 2u);
+    EXPECT_EQ(table.find(silicon<scalar>()), si_idx);
+    EXPECT_EQ(table.find(argon_liquid<scalar>()), ar_idx);
+    EXPECT_EQ(table.find(gold<scalar>()), dindex_invalid);
+
+    // Particle hypothesis
+    EXPECT_TRUE(table.matches(pdg, mass, q));
+    EXPECT_TRUE(table.matches(pdg, mass, -q));
+    EXPECT_FALSE(table.matches(pdg_particle::eElectron, mass, q));
+    EXPECT_FALSE(table.matches(pdg, 0.511f * unit<scalar>::MeV, q));
+    EXPECT_FALSE(table.matches(pdg, mass, 2.f * q));
+
+    std::mt19937_64 gen(42u);
+    std::uniform_real_distribution<scalar> log_p_dist(
+        std::log(100.f * unit<scalar>::MeV),
+        std::log(100.f * unit<scalar>::GeV));
+
+    const scalar path{1.f * unit<scalar>::mm};
+
+    for (const dindex mat_idx : {si_idx, ar_idx}) {
+        const auto &mat = table.get_material(mat_idx);
+        const scalar x_over_X0{path / mat.X0()};
+
+        for (std::size_t n = 0u; n < 1000u; ++n) {
+            const scalar p{std::exp(log_p_dist(gen))};
+            const scalar qop{q / p};
+
+            // Mean energy loss
+            const scalar e_loss{I.compute_energy_loss_bethe_bloch(
+                path, mat, pdg, mass, qop, q)};
+            EXPECT_NEAR(
+                table.compute_energy_loss_bethe_bloch(path, mat_idx, qop),
+                e_loss, rel_tol * e_loss)
+                << "p = " << p;
+
+            // Energy loss fluctuation
+            const scalar sigma_qop{I.compute_energy_loss_landau_sigma_QOverP(
+                path, mat, pdg, mass, qop, q)};
+            EXPECT_NEAR(
+                table.compute_energy_loss_landau_sigma_QOverP(path, mat_idx,
+                                                              qop),
+                sigma_qop, rel_tol * sigma_qop)
+                << "p = " << p;
+
+            // Multiple scattering
+            const scalar theta0{I.compute_multiple_scattering_theta0(
+                x_over_X0, pdg, mass, qop, q)};
+            EXPECT_NEAR(
+                table.compute_multiple_scattering_theta0(x_over_X0, qop),
+                theta0, rel_tol * theta0)
+                << "p = " << p;
+        }
+
+        // Derivative of the stopping power (away from the minimum, where it
+        // changes sign)
+        for (const scalar p : {0.12f * unit<scalar>::GeV,
+                               0.2f * unit<scalar>::GeV,
+                               0.3f * unit<scalar>::GeV}) {
+            for (const scalar qop : {q / p, -q / p}) {
+                const detail::relativistic_quantities<scalar> rq(mass, qop, q);
+                const scalar dSdqop{I.derive_bethe_bloch(
+                    mat, pdg, rq, I.compute_bethe_bloch(mat, pdg, rq))};
+                EXPECT_NEAR(table.derive_stopping_power(mat_idx, qop), dSdqop,
+                            1e-2f * std::abs(dSdqop))
+                    << "p = " << p;
+            }
+        }
+    }
+
+    // Outside of the tabulated range, the analytic expressions are used
+    const scalar qop_low{q / (10.f * unit<scalar>::MeV)};
+    const auto &si = table.get_material(si_idx);
+    EXPECT_FLOAT_EQ(
+        table.compute_energy_loss_bethe_bloch(path, si_idx, qop_low),
+        I.compute_energy_loss_bethe_bloch(path, si, pdg, mass, qop_low, q));
+}
+
+// Neutral particles and invalid binnings are rejected
+GTEST_TEST(detray_material, interaction_table_errors) {
+
+    EXPECT_THROW(interaction_table<scalar>(pdg_particle::eMuon, mass, 0.f),
+                 std::invalid_argument);
+    EXPECT_THROW(interaction_table<scalar>(pdg, mass, q,
+                                           10.f * unit<scalar>::GeV,
+                                           1.f * unit<scalar>::GeV),
+                 std::invalid_argument);
+}
+
+// The interactor only searches the table when the material changes
+GTEST_TEST(detray_material, interaction_table_interactor_lookup) {
+
+    using interactor_t = pointwise_material_interactor<test::algebra>;
+
+    interaction_table<scalar> table(pdg, mass, q);
+    const dindex si_idx{table.add_material(silicon<scalar>())};
+    const dindex ar_idx{table.add_material(argon_liquid<scalar>())};
+
+    const material<scalar> si{silicon<scalar>()};
+    const material<scalar> si_copy{silicon<scalar>()};
+    const material<scalar> ar{argon_liquid<scalar>()};
+    const material<scalar> au{gold<scalar>()};
+
+    interactor_t::state s{};
+    s.mass = mass;
+    s.pdg = pdg;
+    s.mat_table = &table;
+
+    // Table is not enabled
+    EXPECT_EQ(s.interaction_table_index(si, q), dindex_invalid);
+
+    s.use_interaction_table = true;
+    EXPECT_EQ(s.interaction_table_index(si, q), si_idx);
+    EXPECT_EQ(s.cached_mat, &si);
+    EXPECT_EQ(s.cached_table_idx, si_idx);
+
+    // Same material instance or same parameters: No new search
+    EXPECT_EQ(s.interaction_table_index(si, q), si_idx);
+    EXPECT_EQ(s.interaction_table_index(si_copy, q), si_idx);
+    EXPECT_EQ(s.cached_mat, &si_copy);
+
+    // Material changes
+    EXPECT_EQ(s.interaction_table_index(ar, q), ar_idx);
+    EXPECT_EQ(s.interaction_table_index(au, q), dindex_invalid);
+    EXPECT_EQ(s.interaction_table_index(au, q), dindex_invalid);
+    EXPECT_EQ(s.interaction_table_index(si, q), si_idx);
+
+    // A different table invalidates the cache
+    interaction_table<scalar> table2(pdg, mass, q);
+    table2.add_material(argon_liquid<scalar>());
+    const dindex si_idx2{table2.add_material(silicon<scalar>())};
+    s.mat_table = &table2;
+    EXPECT_EQ(s.interaction_table_index(si, q), si_idx2);
+
+    // The particle hypothesis does not match the table
+    s.mat_table = &table;
+    EXPECT_EQ(s.interaction_table_index(si, 2.f * q), dindex_invalid);
+    s.mass = 0.511f * unit<scalar>::MeV;
+    EXPECT_EQ(s.interaction_table_index(si, q), dindex_invalid);
+    s.mass = mass;
+    s.pdg = pdg_particle::eElectron;
+    EXPECT_EQ(s.interaction_table_index(si, q), dindex_invalid);
+}
@@ -9,8 +9,18 @@
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/mask.hpp"
 #include "detray/geometry/shapes.hpp"
+#include "detray/materials/detail/material_accessor.hpp"
+#include "detray/materials/indexed_material_map.hpp"
 #include "detray/materials/material_map.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s)
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 // GTest include(s)
 #include <gtest/gtest.h>
 
@@ -239,3 +249,76 @@ GTEST_TEST(detray_material, trapezoid_map) {
     EXPECT_FALSE(trapezoid_map.at(199, 0) ==
                  material_t(aluminium<scalar>{}, 201.f * unit<scalar>::mm));
 }
+
+/// Unittest: Test the conversion into indexed material maps
+GTEST_TEST(detray_material, indexed_material_map) {
+
+    using indexed_map_t = indexed_material_map<ring2D, scalar>;
+    using point_t = typename indexed_map_t::point_type;
+
+    vecmem::host_memory_resource host_mr;
+    indexed_material_collection<indexed_map_t> mat_coll(&host_mr);
+
+    mask<ring2D> r2{0u, 0.f * unit<scalar>::mm, 3.5f * unit<scalar>::mm};
+
+    // Two maps that are made of the same two materials
+    std::vector<decltype(mat_map_factory.new_grid(r2, {10u, 20u}))> disc_maps;
+    for (dindex i = 0u; i < 2u; ++i) {
+        auto disc_map = mat_map_factory.new_grid(r2, {10u, 20u});
+
+        scalar thickness = 2.f * unit<scalar>::mm;
+        for (dindex gbin = 0; gbin < disc_map.nbins(); ++gbin) {
+            disc_map.template populate<replace<>>(
+                gbin, ((gbin + i) % 2u == 0u)
+                          ? material_t(aluminium<scalar>{}, thickness)
+                          : material_t(silicon<scalar>{}, thickness));
+            thickness += 1.f * unit<scalar>::mm;
+        }
+
+        mat_coll.push_back(disc_map);
+        disc_maps.push_back(std::move(disc_map));
+    }
+
+    EXPECT_EQ(mat_coll.size(), 2u);
+    EXPECT_EQ(mat_coll.materials().size(), 2u);
+    EXPECT_EQ(mat_coll[0].nbins(), 200u);
+    EXPECT_EQ(mat_coll[1].nbins(), 200u);
+
+    // Device-side collection that is constructed from the vecmem view
+    using device_map_t =
+        indexed_material_map<ring2D, scalar, device_container_types>;
+    auto coll_view = mat_coll.get_data();
+    static_assert(
+        std::is_same_v<
+            decltype(coll_view),
+            typename indexed_material_collection<indexed_map_t>::view_type>,
+        "Indexed material collection view incorrectly assembled");
+    const indexed_material_collection<device_map_t> device_coll(coll_view);
+
+    EXPECT_EQ(device_coll.size(), 2u);
+    EXPECT_EQ(device_coll.materials().size(), 2u);
+
+    // Resolve the material slabs against the material table
+    for (const point_t p : {point_t{0.1f * unit<scalar>::mm, 0.f},
+                            point_t{1.2f * unit<scalar>::mm, 1.f},
+                            point_t{3.4f * unit<scalar>::mm, -2.f}}) {
+        for (dindex i = 0u; i < 2u; ++i) {
+            const auto slab = detail::material_accessor::get(mat_coll, i, p);
+            const material_t &expected = *(disc_maps[i].search(p));
+
+            EXPECT_EQ(
+                detail::material_accessor::get(device_coll, i, p).to_slab(),
+                expected);
+
+            EXPECT_EQ(slab.to_slab(), expected);
+            EXPECT_FLOAT_EQ(slab.thickness_in_X0(),
+                            expected.thickness_in_X0());
+            EXPECT_TRUE(static_cast<bool>(slab));
+
+            // The material is not copied into the bins
+            const auto &table = mat_coll.materials();
+            EXPECT_TRUE(&slab.get_material() == &table[0] ||
+                        &slab.get_material() == &table[1]);
+        }
+    }
+}
@@ -0,0 +1,324 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Detray include(s)
+#include "detray/navigation/accelerators/bounding_volume_hierarchy.hpp"
+
+#include "detray/builders/bvh_builder.hpp"
+#include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/navigator.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+vecmem::host_memory_resource host_mr;
+
+// Algebra definitions
+using algebra_t = test::algebra;
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+/// Cuboid volume with irregularly placed sensitive rectangles and a box of
+/// portals around them. The sensitives are either held by a bounding volume
+/// hierarchy (@param use_bvh) or by the brute force method
+auto build_bvh_detector(const bool use_bvh) {
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3_type;
+    using bvh_t = typename bvh_collection<detector_t::surface_type>::value_type;
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+
+    const auto geo_ctx = typename detector_t::geometry_context{};
+
+    detector_builder<default_metadata> det_builder{};
+
+    volume_builder_interface<detector_t> *vbuilder =
+        det_builder.new_volume(volume_id::e_cuboid);
+    vbuilder->add_volume_placement(point3{0.f, 0.f, 0.f});
+
+    if (use_bvh) {
+        auto *bvh_bldr =
+            det_builder.template decorate<bvh_builder<detector_t, bvh_t>>(
+                vbuilder);
+        bvh_bldr->set_max_leaf_size(2u);
+        vbuilder = bvh_bldr;
+    }
+
+    const auto vol_idx{
+        static_cast<typename detector_t::surface_type::navigation_link>(
+            vbuilder->vol_index())};
+
+    // Scatter the planes with alternating orientations through the volume
+    const std::array<vector3, 3> normals{vector3{1.f, 0.f, 0.f},
+                                         vector3{0.f, 1.f, 0.f},
+                                         vector3{0.f, 0.f, 1.f}};
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    typename rectangle_factory::sf_data_collection rect_sf_data;
+    for (unsigned int i = 0u; i < 60u; ++i) {
+        const point3 t{-44.5f + static_cast<scalar>((37u * i) % 90u),
+                       -44.5f + static_cast<scalar>((53u * i) % 90u),
+                       -44.5f + static_cast<scalar>((71u * i) % 90u)};
+        const vector3 &z = normals[i % 3u];
+        const vector3 &x = normals[(i + 1u) % 3u];
+
+        rect_sf_data.emplace_back(surface_id::e_sensitive,
+                                  transform3(t, z, x), vol_idx,
+                                  std::vector<scalar>{5.f, 5.f});
+    }
+    rect_factory->push_back(std::move(rect_sf_data));
+    vbuilder->add_surfaces(rect_factory, geo_ctx);
+
+    vbuilder->add_surfaces(
+        std::make_shared<cuboid_portal_generator<detector_t>>(0.1f));
+
+    return det_builder.build(host_mr);
+}
+
+/// Run the navigation of a track with the stepping state @param stepping
+/// through the detector @param det and record the surfaces the navigator
+/// stops on
+template <typename stepper_t, typename detector_t>
+std::vector<geometry::barcode> run_navigation(
+    const detector_t &det, const typename stepper_t::state &stepping) {
+
+    using navigator_t = navigator<detector_t>;
+
+    stepper_t stepper;
+    navigator_t nav;
+    const navigation::config cfg{};
+
+    prop_state<typename stepper_t::state, typename navigator_t::state>
+        propagation{stepping, typename navigator_t::state(det, host_mr)};
+    auto &navigation = propagation._navigation;
+
+    std::vector<geometry::barcode> surfaces;
+    bool heartbeat = nav.init(propagation, cfg);
+    for (unsigned int i = 0u; heartbeat && i < 10000u; ++i) {
+        if (navigation.is_on_module() || navigation.is_on_portal()) {
+            surfaces.push_back(navigation.barcode());
+        }
+        stepper.step(propagation);
+        navigation.set_high_trust();
+        heartbeat = nav.update(propagation, cfg);
+    }
+    EXPECT_TRUE(navigation.is_complete());
+
+    return surfaces;
+}
+
+}  // anonymous namespace
+
+/// Test the construction and search of bounding volume hierarchies
+GTEST_TEST(detray_navigation, bounding_volume_hierarchy) {
+
+    using bvh_coll_t = bvh_collection<dindex>;
+    using box_t = typename bvh_coll_t::box_type;
+
+    bvh_coll_t bvh_collection(&host_mr);
+
+    ASSERT_TRUE(bvh_collection.empty());
+
+    // Grid of 10 x 10 boxes in the x-z plane, the surface index encodes the
+    // position of the box
+    std::vector<dindex> surfaces{};
+    std::vector<box_t> boxes{};
+    for (dindex i = 0u; i < 10u; ++i) {
+        for (dindex j = 0u; j < 10u; ++j) {
+            const scalar x{10.f * static_cast<scalar>(i)};
+            const scalar z{10.f * static_cast<scalar>(j)};
+
+            surfaces.push_back(10u * i + j);
+            boxes.emplace_back(0u, x - 1.f, -1.f, z - 1.f, x + 1.f, 1.f,
+                               z + 1.f);
+        }
+    }
+
+    bvh_collection.push_back(surfaces, boxes, 2u);
+    // Empty hierarchy
+    bvh_collection.push_back(std::vector<dindex>{}, std::vector<box_t>{});
+
+    ASSERT_EQ(bvh_collection.size(), 2u);
+    ASSERT_EQ(bvh_collection.all().size(), surfaces.size());
+
+    const auto bvh = bvh_collection[0];
+    EXPECT_EQ(bvh.n_max_candidates(), 100u);
+    EXPECT_EQ(bvh.all().size(), 100u);
+    EXPECT_TRUE(bvh.n_nodes() > 1u);
+
+    // Every surface ends up in exactly one leaf
+    dindex n_leaf_sf{0u};
+    for (dindex i = 0u; i < bvh.n_nodes(); ++i) {
+        const auto &node = bvh.node(i);
+        if (node.is_leaf()) {
+            EXPECT_TRUE(node.n_surfaces <= 2u);
+            n_leaf_sf += node.n_surfaces;
+        }
+    }
+    EXPECT_EQ(n_leaf_sf, 100u);
+
+    // Ray along the z-axis through the column of boxes at x = 30mm
+    const detail::ray<test::algebra> ray_z(point3{30.f, 0.f, -50.f}, 0.f,
+                                           vector3{0.f, 0.f, 1.f}, 0.f);
+
+    std::vector<dindex> found{};
+    for (const dindex sf : bvh.search(ray_z)) {
+        found.push_back(sf);
+    }
+    std::sort(found.begin(), found.end());
+
+    std::vector<dindex> expected{30u, 31u, 32u, 33u, 34u,
+                                 35u, 36u, 37u, 38u, 39u};
+    EXPECT_EQ(found, expected);
+
+    // Ray along the x-axis through the row of boxes at z = 50mm
+    const detail::ray<test::algebra> ray_x(point3{-50.f, 0.f, 50.f}, 0.f,
+                                           vector3{1.f, 0.f, 0.f}, 0.f);
+    found.clear();
+    for (const dindex sf : bvh.search(ray_x)) {
+        found.push_back(sf);
+    }
+    std::sort(found.begin(), found.end());
+
+    expected = {5u, 15u, 25u, 35u, 45u, 55u, 65u, 75u, 85u, 95u};
+    EXPECT_EQ(found, expected);
+
+    // Ray that passes the column at x = 30mm within a tolerance of 1mm
+    const detail::ray<test::algebra> ray_tol(point3{31.5f, 0.f, -50.f}, 0.f,
+                                             vector3{0.f, 0.f, 1.f}, 0.f);
+    const auto no_tol = bvh.search(ray_tol);
+    EXPECT_TRUE(no_tol.begin() == no_tol.end());
+
+    found.clear();
+    for (const dindex sf : bvh.search(ray_tol, 1.f * unit<scalar>::mm)) {
+        found.push_back(sf);
+    }
+    std::sort(found.begin(), found.end());
+
+    expected = {30u, 31u, 32u, 33u, 34u, 35u, 36u, 37u, 38u, 39u};
+    EXPECT_EQ(found, expected);
+
+    // Ray that misses all boxes
+    const detail::ray<test::algebra> ray_miss(point3{0.f, 5.f, 0.f}, 0.f,
+                                              vector3{1.f, 0.f, 0.f}, 0.f);
+    const auto miss = bvh.search(ray_miss);
+    EXPECT_TRUE(miss.begin() == miss.end());
+
+    // Empty hierarchy
+    const auto empty_search = bvh_collection[1].search(ray_z);
+    EXPECT_TRUE(empty_search.begin() == empty_search.end());
+}
+
+/// Navigate through a volume that holds its sensitives in a bounding volume
+/// hierarchy and compare with the brute force navigation
+GTEST_TEST(detray_navigation, bounding_volume_hierarchy_navigation) {
+
+    const auto bvh_det = build_bvh_detector(true);
+    const auto bf_det = build_bvh_detector(false);
+
+    using detector_t = std::remove_cv_t<decltype(bvh_det)>;
+    using geo_obj_id = typename detector_t::geo_obj_ids;
+    using acc_ids = typename detector_t::accel::id;
+
+    ASSERT_EQ(bvh_det.volumes().size(), 1u);
+    ASSERT_EQ(bvh_det.surfaces().size(), bf_det.surfaces().size());
+    EXPECT_EQ(bvh_det.volumes()[0]
+                  .template accel_link<geo_obj_id::e_sensitive>()
+                  .id(),
+              acc_ids::e_bvh);
+    EXPECT_EQ(bf_det.accelerator_store().template size<acc_ids::e_bvh>(),
+              0u);
+
+    using stepper_t = line_stepper<algebra_t>;
+
+    std::size_t n_sensitives{0u};
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    for (const auto track : generator_t(20u, 20u)) {
+        const typename stepper_t::state stepping{track};
+        const auto surfaces = run_navigation<stepper_t>(bvh_det, stepping);
+        const auto ref_surfaces = run_navigation<stepper_t>(bf_det, stepping);
+
+        ASSERT_EQ(surfaces, ref_surfaces);
+        n_sensitives += static_cast<std::size_t>(std::count_if(
+            surfaces.begin(), surfaces.end(),
+            [](const geometry::barcode bcd) {
+                return bcd.id() == surface_id::e_sensitive;
+            }));
+    }
+
+    // The tracks cross the sensitive surfaces in the hierarchy
+    EXPECT_TRUE(n_sensitives > 0u);
+}
+
+/// Navigate curved tracks through a volume that holds its sensitives in a
+/// bounding volume hierarchy and compare with the brute force navigation
+GTEST_TEST(detray_navigation, bounding_volume_hierarchy_navigation_rk) {
+
+    const auto bvh_det = build_bvh_detector(true);
+    const auto bf_det = build_bvh_detector(false);
+
+    using bfield_t = bfield::const_field_t;
+    using stepper_t = rk_stepper<typename bfield_t::view_t, algebra_t>;
+
+    const bfield_t hom_bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+
+    // Low momentum, so that the tracks deviate from their tangents by more
+    // than the mask tolerance inside of the volume
+    const scalar p_mag{100.f * unit<scalar>::MeV};
+
+    std::size_t n_sensitives{0u};
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    for (const auto track : generator_t(20u, 20u, p_mag)) {
+        const typename stepper_t::state stepping{track, hom_bfield};
+        const auto surfaces = run_navigation<stepper_t>(bvh_det, stepping);
+        const auto ref_surfaces = run_navigation<stepper_t>(bf_det, stepping);
+
+        ASSERT_EQ(surfaces, ref_surfaces);
+        n_sensitives += static_cast<std::size_t>(std::count_if(
+            surfaces.begin(), surfaces.end(),
+            [](const geometry::barcode bcd) {
+                return bcd.id() == surface_id::e_sensitive;
+            }));
+    }
+
+    // The tracks cross the sensitive surfaces in the hierarchy
+    EXPECT_TRUE(n_sensitives > 0u);
+}
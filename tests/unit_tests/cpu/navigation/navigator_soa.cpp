@@ -0,0 +1,298 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s).
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+
+// Project include(s)
+#include "detray/navigation/navigator.hpp"
+
+#include "detray/builders/cuboid_portal_generator.hpp"
+#include "detray/builders/detector_builder.hpp"
+#include "detray/builders/surface_factory.hpp"
+#include "detray/core/detail/soa_surface_store.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/detail/indexing.hpp"
+#include "detray/detectors/build_toy_detector.hpp"
+#include "detray/navigation/detail/ray.hpp"
+#include "detray/navigation/intersection_kernel.hpp"
+#include "detray/navigation/soa_intersection_kernel.hpp"
+#include "detray/propagator/line_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Test include(s)
+#include "detray/test/common/types.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GoogleTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace detray;
+
+namespace {
+
+using algebra_t = test::algebra;
+using algebra_v = detray::vc_soa<test::scalar>;
+using point3 = test::point3;
+using vector3 = test::vector3;
+
+vecmem::host_memory_resource host_mr;
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+/// What the navigator sees after every navigation call
+struct nav_record {
+    /// Surface the track is on (invalid if not on a surface)
+    geometry::barcode current{};
+    /// Reachable candidates, ordered by barcode
+    std::vector<geometry::barcode> candidates{};
+};
+
+/// Run the navigation of a straight line @param track through the detector
+/// @param det and record the navigation state after every call
+template <typename navigator_t, typename detector_t>
+std::vector<nav_record> run_navigation(
+    const detector_t &det, const free_track_parameters<algebra_t> &track,
+    const navigation::config &cfg,
+    const typename navigator_t::soa_store_type *soa_store = nullptr) {
+
+    using stepper_t = line_stepper<algebra_t>;
+
+    stepper_t stepper;
+    navigator_t nav;
+
+    prop_state<typename stepper_t::state, typename navigator_t::state>
+        propagation{typename stepper_t::state{track},
+                    typename navigator_t::state(det, host_mr)};
+    auto &navigation = propagation._navigation;
+    if (soa_store != nullptr) {
+        navigation.set_soa_store(*soa_store);
+    }
+
+    std::vector<nav_record> records;
+    auto record = [&navigation, &records]() {
+        nav_record rec{};
+        if (navigation.is_on_module() || navigation.is_on_portal()) {
+            rec.current = navigation.barcode();
+        }
+        for (const auto &candidate : navigation) {
+            rec.candidates.push_back(candidate.sf_desc.barcode());
+        }
+        std::sort(rec.candidates.begin(), rec.candidates.end());
+        records.push_back(std::move(rec));
+    };
+
+    bool heartbeat = nav.init(propagation, cfg);
+    record();
+
+    for (unsigned int i = 0u; heartbeat && i < 10000u; ++i) {
+        stepper.step(propagation);
+        navigation.set_high_trust();
+        heartbeat = nav.update(propagation, cfg);
+        record();
+    }
+    EXPECT_TRUE(navigation.is_complete());
+
+    return records;
+}
+
+/// Compare the records of two navigation runs
+void compare_records(const std::vector<nav_record> &records,
+                     const std::vector<nav_record> &ref_records) {
+
+    ASSERT_EQ(records.size(), ref_records.size());
+    for (std::size_t i = 0u; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].current, ref_records[i].current) << i;
+        EXPECT_EQ(records[i].candidates, ref_records[i].candidates) << i;
+    }
+}
+
+/// Cuboid volume with three planes, two of which are parallel to the
+/// x-axis, and a box of portals around them (all have rectangle masks)
+auto build_plane_detector(
+    soa_surface_store<detector<>, algebra_v> &soa_store) {
+
+    using detector_t = detector<>;
+    using transform3 = typename detector_t::transform3_type;
+    using rectangle_factory = surface_factory<detector_t, rectangle2D>;
+
+    const auto geo_ctx = typename detector_t::geometry_context{};
+
+    detector_builder<default_metadata> det_builder{};
+
+    auto vbuilder = det_builder.new_volume(volume_id::e_cuboid);
+    vbuilder->add_volume_placement(point3{0.f, 0.f, 0.f});
+
+    const auto vol_idx{
+        static_cast<typename detector_t::surface_type::navigation_link>(
+            vbuilder->vol_index())};
+
+    const std::vector<scalar> bounds{5.f, 5.f};
+
+    auto rect_factory = std::make_shared<rectangle_factory>();
+    typename rectangle_factory::sf_data_collection rect_sf_data;
+    rect_sf_data.emplace_back(
+        surface_id::e_sensitive,
+        transform3(point3{10.f, 0.f, 0.f}, vector3{1.f, 0.f, 0.f},
+                   vector3{0.f, 1.f, 0.f}),
+        vol_idx, bounds);
+    rect_sf_data.emplace_back(surface_id::e_sensitive,
+                              transform3(point3{0.f, 0.f, -3.f}), vol_idx,
+                              bounds);
+    rect_sf_data.emplace_back(surface_id::e_sensitive,
+                              transform3(point3{0.f, 0.f, 3.f}), vol_idx,
+                              bounds);
+    rect_factory->push_back(std::move(rect_sf_data));
+    vbuilder->add_surfaces(rect_factory, geo_ctx);
+
+    vbuilder->add_surfaces(
+        std::make_shared<cuboid_portal_generator<detector_t>>(0.1f));
+
+    return det_builder.build(host_mr, soa_store);
+}
+
+/// Intersect all surfaces of @param det with @param ray, using the scalar
+/// and the SoA kernels (with and without the mirror @param soa_store)
+template <typename detector_t>
+void compare_kernels(const detector_t &det,
+                     const soa_surface_store<detector_t, algebra_v> &soa_store,
+                     const detail::ray<algebra_t> &ray,
+                     const std::array<scalar, 2u> &mask_tol,
+                     const std::size_t n_expected) {
+
+    using surface_t = typename detector_t::surface_type;
+    using intersection_t = intersection2D<surface_t, algebra_t>;
+    using mask_id = typename detector_t::masks::id;
+
+    std::vector<surface_t> surfaces(det.surfaces().begin(),
+                                    det.surfaces().end());
+    for (const auto &sf : surfaces) {
+        ASSERT_EQ(sf.mask().id(), mask_id::e_rectangle2);
+    }
+    const auto n{static_cast<dindex>(surfaces.size())};
+
+    const scalar mask_tol_scalor{0.f};
+    const scalar overstep_tol{-1.f};
+
+    std::vector<intersection_t> scalar_is;
+    det.mask_store()
+        .template visit<intersection_initialize_batch<ray_intersector>>(
+            mask_id::e_rectangle2, surfaces.data(), n, scalar_is, ray,
+            det.transform_store(), mask_tol, mask_tol_scalor, overstep_tol);
+
+    std::vector<intersection_t> soa_is;
+    det.mask_store()
+        .template visit<soa_intersection_initialize_batch<algebra_v>>(
+            mask_id::e_rectangle2, surfaces.data(), n, soa_is, ray,
+            det.transform_store(), mask_tol, mask_tol_scalor, overstep_tol);
+
+    std::vector<intersection_t> store_is;
+    det.mask_store()
+        .template visit<soa_intersection_initialize_batch<algebra_v>>(
+            mask_id::e_rectangle2, surfaces.data(), n, soa_store, store_is,
+            ray, det.transform_store(), mask_tol, mask_tol_scalor,
+            overstep_tol);
+
+    ASSERT_EQ(scalar_is.size(), n_expected);
+
+    auto by_surface = [](const intersection_t &a, const intersection_t &b) {
+        return a.sf_desc.index() < b.sf_desc.index();
+    };
+    std::sort(scalar_is.begin(), scalar_is.end(), by_surface);
+
+    for (auto *intersections : {&soa_is, &store_is}) {
+        ASSERT_EQ(intersections->size(), n_expected);
+        std::sort(intersections->begin(), intersections->end(), by_surface);
+
+        for (std::size_t i = 0u; i < n_expected; ++i) {
+            EXPECT_EQ((*intersections)[i].sf_desc, scalar_is[i].sf_desc);
+            EXPECT_NEAR((*intersections)[i].path, scalar_is[i].path, 1e-4f);
+        }
+    }
+}
+
+}  // anonymous namespace
+
+/// A lane that is parallel to its plane makes the whole SIMD vector invalid:
+/// The surfaces are intersected one by one instead
+GTEST_TEST(detray_navigation, soa_kernel_parallel_lane) {
+
+    soa_surface_store<detector<>, algebra_v> soa_store{};
+    const auto det = build_plane_detector(soa_store);
+
+    // Only the plane at x = 10 mm and the portal behind it are reachable
+    const detail::ray<algebra_t> ray(point3{0.f, 0.f, 0.f}, 0.f,
+                                     vector3{1.f, 0.f, 0.f}, -1.f);
+    compare_kernels(det, soa_store, ray, {0.f, 0.f}, 2u);
+}
+
+/// The mask tolerance must not be applied to the portal lanes
+GTEST_TEST(detray_navigation, soa_kernel_portal_tolerance) {
+
+    soa_surface_store<detector<>, algebra_v> soa_store{};
+    const auto det = build_plane_detector(soa_store);
+
+    // Slightly tilted, so that no lane is parallel to its plane, and outside
+    // of all masks by less than the mask tolerance
+    const detail::ray<algebra_t> ray(
+        point3{0.f, 5.5f, 0.f}, 0.f,
+        vector::normalize(vector3{1.f, 0.001f, 0.01f}), -1.f);
+
+    // Without tolerance: no plane and no portal is hit in front of the ray
+    compare_kernels(det, soa_store, ray, {0.f, 0.f}, 0u);
+    // With tolerance: only the sensitive plane at x = 10 mm
+    compare_kernels(det, soa_store, ray,
+                    {1.f * unit<scalar>::mm, 1.f * unit<scalar>::mm}, 1u);
+}
+
+/// Navigate through the toy detector with the SoA navigator and compare
+/// every navigation step with the scalar navigator
+GTEST_TEST(detray_navigation, navigator_soa_toy_geometry) {
+
+    const auto [det, names] = build_toy_detector(host_mr);
+
+    using detector_t = std::remove_cv_t<decltype(det)>;
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, algebra_t>;
+    using navigator_t = navigator<detector_t>;
+    using soa_navigator_t = navigator<detector_t, navigation::void_inspector,
+                                      intersection_t, algebra_v>;
+
+    const soa_surface_store<detector_t, algebra_v> soa_store{det, host_mr};
+
+    navigation::config cfg{};
+    cfg.path_tolerance = 1.f * unit<float>::um;
+    cfg.search_window = {3u, 3u};
+
+    using generator_t =
+        uniform_track_generator<free_track_parameters<algebra_t>>;
+    for (const auto track : generator_t(10u, 10u)) {
+        const auto ref_records = run_navigation<navigator_t>(det, track, cfg);
+
+        // Lanes gathered on the fly
+        compare_records(run_navigation<soa_navigator_t>(det, track, cfg),
+                        ref_records);
+        // Lanes taken from the SoA mirror
+        compare_records(
+            run_navigation<soa_navigator_t>(det, track, cfg, &soa_store),
+            ref_records);
+    }
+}
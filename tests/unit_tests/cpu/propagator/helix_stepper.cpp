@@ -0,0 +1,169 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// detray include(s)
+#include "detray/propagator/helix_stepper.hpp"
+
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/navigation/detail/helix.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// System include(s)
+#include <memory>
+#include <type_traits>
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using point3 = test::point3;
+using transform3 = test::transform3;
+
+namespace {
+
+constexpr scalar tol{1e-3f};
+
+vecmem::host_memory_resource host_mr;
+
+// dummy navigation struct
+struct nav_state {
+    /// New detector
+    nav_state(vecmem::host_memory_resource &mr)
+        : m_step_size{1.f * unit<scalar>::mm},
+          m_det{std::make_unique<detray::detector<>>(mr)} {
+        // Empty dummy volume
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar operator()() const { return m_step_size; }
+    inline auto current_object() const -> dindex { return dindex_invalid; }
+    inline auto tolerance() const -> scalar { return tol; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    scalar m_step_size;
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+// dummy propagator state
+template <typename stepping_t, typename navigation_t>
+struct prop_state {
+    stepping_t _stepping;
+    navigation_t _navigation;
+};
+
+}  // namespace
+
+// This tests the base functionality of the helix stepper
+GTEST_TEST(detray_propagator, helix_stepper) {
+
+    using bfield_t = bfield::const_field_t;
+    using helix_stepper_t = helix_stepper<bfield_t::view_t, algebra_t>;
+    using rk_stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+
+    // The constant field selects the helix stepper
+    static_assert(std::is_same_v<field_stepper_t<bfield_t::view_t, algebra_t>,
+                                 helix_stepper_t>);
+    using inhom_field_view_t = bfield::inhom_field_t::view_t;
+    static_assert(
+        std::is_same_v<field_stepper_t<inhom_field_view_t, algebra_t>,
+                       rk_stepper<inhom_field_view_t, algebra_t>>);
+
+    const vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+                    1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    helix_stepper_t h_stepper;
+    rk_stepper_t rk_stepper;
+
+    constexpr unsigned int n_steps{10u};
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps{10u};
+    constexpr unsigned int phi_steps{10u};
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        // Truth helix
+        detail::helix helix(track, &B);
+
+        prop_state<helix_stepper_t::state, nav_state> h_propagation{
+            helix_stepper_t::state{track, hom_bfield}, nav_state{host_mr}};
+        prop_state<rk_stepper_t::state, nav_state> rk_propagation{
+            rk_stepper_t::state{track, hom_bfield}, nav_state{host_mr}};
+
+        helix_stepper_t::state &h_state = h_propagation._stepping;
+        rk_stepper_t::state &rk_state = rk_propagation._stepping;
+
+        // Large steps
+        h_propagation._navigation.m_step_size = 10.f * unit<scalar>::cm;
+
+        for (unsigned int i = 0u; i < n_steps; ++i) {
+            h_stepper.step(h_propagation);
+        }
+
+        const scalar path_length{h_state.path_length()};
+        ASSERT_NEAR(path_length, 1.f * unit<scalar>::m, tol);
+
+        // The helix stepper stays on the truth helix
+        const point3 pos_err = h_state().pos() - helix(path_length);
+        EXPECT_NEAR(getter::norm(pos_err) / path_length, 0.f, tol);
+        const vector3 dir_err = h_state().dir() - helix.dir(path_length);
+        EXPECT_NEAR(getter::norm(dir_err), 0.f, tol);
+
+        // Same path with the Runge-Kutta stepper
+        rk_propagation._navigation.m_step_size = path_length;
+        rk_state.set_step_size(path_length);
+        while (rk_state.path_length() < path_length - tol) {
+            rk_propagation._navigation.m_step_size =
+                path_length - rk_state.path_length();
+            rk_stepper.step(rk_propagation);
+        }
+
+        // The transport jacobians agree
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                // No time derivatives in the Runge-Kutta stepper
+                if (i == e_free_time || j == e_free_time) {
+                    continue;
+                }
+                const scalar ref{
+                    getter::element(rk_state._jac_transport, i, j)};
+                EXPECT_NEAR(getter::element(h_state._jac_transport, i, j), ref,
+                            tol * math::max(1.f, math::fabs(ref)));
+            }
+        }
+
+        // Roll back to the origin
+        h_propagation._navigation.m_step_size = -10.f * unit<scalar>::cm;
+        for (unsigned int i = 0u; i < n_steps; ++i) {
+            h_stepper.step(h_propagation);
+        }
+
+        ASSERT_NEAR(h_state.path_length(), 0.f, tol);
+        EXPECT_NEAR(getter::norm(h_state().pos() - track.pos()) / path_length,
+                    0.f, tol);
+    }
+}
@@ -0,0 +1,167 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/propagator/detail/jacobian_engine.hpp"
+
+#include "detray/geometry/mask.hpp"
+#include "detray/geometry/shapes/line.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// GTest include(s).
+#include <gtest/gtest.h>
+
+// System include(s).
+#include <algorithm>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using point3 = test::point3;
+using vector3 = test::vector3;
+using transform3 = test::transform3;
+using matrix_operator = test::matrix_operator;
+
+namespace {
+
+constexpr scalar isclose{1e-4f};
+
+/// Transport jacobian without any zero entries
+free_matrix<algebra_t> make_transport_jacobian() {
+    free_matrix<algebra_t> jac =
+        matrix_operator().template identity<e_free_size, e_free_size>();
+
+    for (unsigned int i = 0u; i < e_free_size; ++i) {
+        for (unsigned int j = 0u; j < e_free_size; ++j) {
+            matrix_operator().element(jac, i, j) +=
+                0.1f * static_cast<scalar>((3u * i + 7u * j) % 11u) - 0.5f;
+        }
+    }
+    return jac;
+}
+
+/// Symmetric, positive definite covariance
+template <std::size_t N>
+test::matrix<N, N> make_covariance() {
+    test::matrix<N, N> a = matrix_operator().template zero<N, N>();
+
+    for (unsigned int i = 0u; i < N; ++i) {
+        for (unsigned int j = 0u; j < N; ++j) {
+            matrix_operator().element(a, i, j) =
+                0.2f * static_cast<scalar>((5u * i + 3u * j) % 7u) - 0.3f;
+        }
+    }
+    return a * matrix_operator().transpose(a) +
+           matrix_operator().template identity<N, N>();
+}
+
+/// Departure surface: A line, which has all entries of the bound to free
+/// jacobian set
+bound_to_free_matrix<algebra_t> make_bound_to_free_jacobian() {
+    using line_engine = detail::jacobian_engine<line2D<algebra_t>>;
+
+    const mask<line<>> ln{0u, 2.f, 50.f};
+    const transform3 trf(point3{1.f, -2.f, 0.5f},
+                         vector::normalize(vector3{1.f, 2.f, 3.f}),
+                         vector::normalize(vector3{2.f, -4.f, 2.f}));
+
+    const free_track_parameters<algebra_t> free_params(
+        point3{1.5f, -1.f, 2.f}, 0.1f, vector3{1.f, 6.f, -2.f}, -1.f);
+    const auto bound_vec =
+        detail::free_to_bound_vector<line2D<algebra_t>>(trf,
+                                                        free_params.vector());
+
+    return line_engine::bound_to_free_jacobian(trf, ln, bound_vec);
+}
+
+/// Compare the entries of two @tparam ROWS x @tparam COLS matrices
+template <std::size_t ROWS, std::size_t COLS, typename matrix_t>
+void expect_near(const matrix_t &fused, const matrix_t &dense) {
+    for (unsigned int i = 0u; i < ROWS; ++i) {
+        for (unsigned int j = 0u; j < COLS; ++j) {
+            const scalar ref{matrix_operator().element(dense, i, j)};
+            EXPECT_NEAR(matrix_operator().element(fused, i, j), ref,
+                        isclose * std::max(scalar{1.f}, math::fabs(ref)))
+                << "(" << i << ", " << j << ")";
+        }
+    }
+}
+
+/// Compare the fused kernels with the dense matrix products
+template <typename frame_t>
+void test_fused_jacobians(const transform3 &trf) {
+
+    using jac_engine = detail::jacobian_engine<frame_t>;
+
+    const free_track_parameters<algebra_t> free_params(
+        point3{0.5f, 1.f, 3.f}, 0.2f, vector3{1.f, 2.f, 3.f}, -1.f);
+    const auto &free_vec = free_params.vector();
+    const vector3 dtds{0.01f, -0.02f, 0.005f};
+    const scalar dqopds{-0.003f};
+
+    const free_matrix<algebra_t> transport_jac = make_transport_jacobian();
+    const bound_to_free_matrix<algebra_t> bound_to_free_jac =
+        make_bound_to_free_jacobian();
+
+    // Dense reference
+    const free_matrix<algebra_t> correction_term =
+        matrix_operator().template identity<e_free_size, e_free_size>() +
+        jac_engine::path_correction(free_params.pos(), free_params.dir(), dtds,
+                                    dqopds, trf);
+    const free_to_bound_matrix<algebra_t> corr_jac =
+        jac_engine::free_to_bound_jacobian(trf, free_vec) * correction_term;
+    const free_to_bound_matrix<algebra_t> free_jac = corr_jac * transport_jac;
+    const bound_matrix<algebra_t> bound_jac = free_jac * bound_to_free_jac;
+
+    expect_near<e_bound_size, e_free_size>(
+        jac_engine::corrected_free_to_bound_jacobian(trf, free_vec, dtds,
+                                                     dqopds),
+        corr_jac);
+    expect_near<e_bound_size, e_free_size>(
+        jac_engine::free_to_bound_transport_jacobian(trf, free_vec, dtds,
+                                                     dqopds, transport_jac),
+        free_jac);
+    expect_near<e_bound_size, e_bound_size>(
+        jac_engine::bound_to_bound_transport_jacobian(
+            trf, free_vec, dtds, dqopds, transport_jac, bound_to_free_jac),
+        bound_jac);
+
+    // Covariance transport
+    const auto free_cov = make_covariance<e_free_size>();
+    const auto bound_cov = make_covariance<e_bound_size>();
+
+    const bound_matrix<algebra_t> free_to_bound_cov =
+        free_jac * free_cov * matrix_operator().transpose(free_jac);
+    const bound_matrix<algebra_t> bound_to_bound_cov =
+        bound_jac * bound_cov * matrix_operator().transpose(bound_jac);
+
+    expect_near<e_bound_size, e_bound_size>(
+        jac_engine::template transport_covariance<e_free_size>(free_jac,
+                                                               free_cov),
+        free_to_bound_cov);
+    expect_near<e_bound_size, e_bound_size>(
+        jac_engine::template transport_covariance<e_bound_size>(bound_jac,
+                                                                bound_cov),
+        bound_to_bound_cov);
+}
+
+}  // namespace
+
+// Structure-aware jacobians for every local frame
+GTEST_TEST(detray_propagator, jacobian_engine_fused) {
+
+    const transform3 trf(point3{2.f, 3.f, 4.f},
+                         vector::normalize(vector3{0.2f, 0.1f, 1.f}),
+                         vector::normalize(vector3{1.f, 0.f, -0.2f}));
+
+    test_fused_jacobians<cartesian2D<algebra_t>>(trf);
+    test_fused_jacobians<polar2D<algebra_t>>(trf);
+    test_fused_jacobians<cylindrical2D<algebra_t>>(trf);
+    test_fused_jacobians<concentric_cylindrical2D<algebra_t>>(trf);
+    test_fused_jacobians<line2D<algebra_t>>(trf);
+}
@@ -0,0 +1,177 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Algebra include(s).
+#ifdef DETRAY_ALGEBRA_VC_SOA
+#include "detray/plugins/algebra/vc_soa_definitions.hpp"
+#endif
+
+// detray include(s)
+#include "detray/propagator/soa/rk_stepper.hpp"
+
+#include "detray/builders/volume_builder.hpp"
+#include "detray/core/detector.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/detectors/bfield.hpp"
+#include "detray/propagator/rk_stepper.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s)
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+// google-test include(s)
+#include <gtest/gtest.h>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using vector3 = test::vector3;
+using track_t = free_track_parameters<algebra_t>;
+using bfield_t = bfield::const_field_t;
+using scalar_stepper_t = rk_stepper<bfield_t::view_t, algebra_t>;
+
+namespace {
+
+constexpr scalar tol{1e-5f};
+constexpr unsigned int n_steps{100u};
+constexpr scalar step_size{1.f * unit<scalar>::mm};
+
+vecmem::host_memory_resource host_mr;
+
+// dummy navigation struct in an empty volume without material
+struct nav_state {
+
+    explicit nav_state(vecmem::host_memory_resource &mr)
+        : m_det{std::make_unique<detray::detector<>>(mr)} {
+        volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
+        vbuilder.build(*m_det);
+    }
+
+    scalar operator()() const { return step_size; }
+    inline auto current_object() const -> dindex { return dindex_invalid; }
+    inline auto tolerance() const -> scalar { return tol; }
+    inline auto detector() const -> const detray::detector<> * {
+        return m_det.get();
+    }
+    inline auto volume() -> unsigned int { return 0u; }
+    inline void set_full_trust() {}
+    inline void set_high_trust() {}
+    inline void set_fair_trust() {}
+    inline void set_no_trust() {}
+    inline bool abort() { return false; }
+
+    std::unique_ptr<detray::detector<>> m_det;
+};
+
+// dummy propagator state
+struct prop_state {
+    scalar_stepper_t::state _stepping;
+    nav_state _navigation;
+};
+
+/// @returns the test tracks
+std::vector<track_t> generate_tracks() {
+    std::vector<track_t> tracks;
+    for (auto track : uniform_track_generator<track_t>(
+             6u, 6u, 2.f * unit<scalar>::GeV, true)) {
+        tracks.push_back(track);
+    }
+    return tracks;
+}
+
+/// Compare @param a and @param b relative to the magnitude of @param b
+void expect_near(const scalar a, const scalar b) {
+    EXPECT_NEAR(a, b, tol * std::max(scalar{1.f}, math::fabs(b)));
+}
+
+/// Step the tracks in bundles and compare every lane with the scalar RKN
+/// stepper, which takes the same (fixed) steps
+template <typename bundle_algebra_t>
+void test_bundle_against_scalar_stepper() {
+
+    using bundle_stepper_t =
+        rk_bundle_stepper<bfield_t::view_t, bundle_algebra_t>;
+    using bundle_scalar_t = dscalar<bundle_algebra_t>;
+    constexpr std::size_t n_lanes{bundle_stepper_t::size()};
+
+    const bfield_t field = bfield::create_const_field(
+        vector3{0.f, 0.5f * unit<scalar>::T, 2.f * unit<scalar>::T});
+
+    stepping::config cfg{};
+    cfg.do_covariance_transport = true;
+
+    const std::vector<track_t> tracks = generate_tracks();
+    ASSERT_FALSE(tracks.empty());
+
+    const scalar_stepper_t scalar_stepper{};
+    const bundle_stepper_t bundle_stepper{};
+
+    for (std::size_t first = 0u; first < tracks.size(); first += n_lanes) {
+        const std::size_t n{std::min(n_lanes, tracks.size() - first)};
+
+        typename bundle_stepper_t::state bundle(&tracks[first], n, field);
+        for (std::size_t i = 0u; i < n; ++i) {
+            detray::detail::soa::set_lane(bundle._step_size, i, step_size);
+        }
+        for (unsigned int i_s = 0u; i_s < n_steps; ++i_s) {
+            bundle_stepper.step(bundle, bundle_scalar_t(step_size), cfg);
+        }
+
+        for (std::size_t i = 0u; i < n; ++i) {
+            ASSERT_TRUE(bundle.is_active(i));
+
+            prop_state propagation{
+                scalar_stepper_t::state{tracks[first + i], field},
+                nav_state{host_mr}};
+            auto &stepping = propagation._stepping;
+            stepping.set_step_size(step_size);
+            for (unsigned int i_s = 0u; i_s < n_steps; ++i_s) {
+                ASSERT_TRUE(scalar_stepper.step(propagation, cfg));
+            }
+
+            track_t lane_track{tracks[first + i]};
+            bundle.store(i, lane_track);
+
+            expect_near(detray::detail::soa::get_lane(bundle._path_length, i),
+                        stepping.path_length());
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                expect_near(lane_track.pos()[j], stepping().pos()[j]);
+                expect_near(lane_track.dir()[j], stepping().dir()[j]);
+            }
+            expect_near(lane_track.qop(), stepping().qop());
+
+            for (unsigned int r = 0u; r < e_free_size; ++r) {
+                for (unsigned int c = 0u; c < e_free_size; ++c) {
+                    expect_near(
+                        bundle.jacobian(i, r, c),
+                        getter::element(stepping._jac_transport, r, c));
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// One track per bundle: The bundle stepper runs with the scalar algebra
+GTEST_TEST(detray_propagator, rk_bundle_stepper_single_lane) {
+    test_bundle_against_scalar_stepper<algebra_t>();
+}
+
+#ifdef DETRAY_ALGEBRA_VC_SOA
+// One track per SIMD lane
+GTEST_TEST(detray_propagator, rk_bundle_stepper_soa) {
+    test_bundle_against_scalar_stepper<detray::vc_soa<scalar>>();
+}
+#endif
@@ -10,10 +10,13 @@
 
 #include "detray/builders/volume_builder.hpp"
 #include "detray/core/detector.hpp"
+#include "detray/definitions/pdg_particle.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/bfield.hpp"
+#include "detray/detectors/bfield_gradient.hpp"
 #include "detray/geometry/tracking_surface.hpp"
 #include "detray/io/utils/file_handle.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/navigation/detail/trajectories.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
@@ -21,7 +24,9 @@
 #include "detray/tracks/tracks.hpp"
 
 // System include(s)
+#include <cmath>
 #include <memory>
+#include <utility>
 
 // google-test include(s)
 #include <gtest/gtest.h>
@@ -44,6 +49,7 @@ namespace {
 
 constexpr scalar tol{1e-3f};
 constexpr material<scalar> vol_mat{detray::cesium_iodide_with_ded<scalar>()};
+constexpr material<scalar> vol_mat2{detray::silicon_with_ded<scalar>()};
 
 vecmem::host_memory_resource host_mr;
 
@@ -56,14 +62,20 @@ struct nav_state {
 
         using material_id = detray::detector<>::materials::id;
 
-        // Empty dummy volume
+        // Empty dummy volumes with different materials
         volume_builder<detray::detector<>> vbuilder{volume_id::e_cylinder};
         vbuilder.build(*m_det);
+        volume_builder<detray::detector<>> vbuilder2{volume_id::e_cylinder,
+                                                     1u};
+        vbuilder2.build(*m_det);
 
         // @TODO: Homogeneous volume material builder
         m_det->material_store().template push_back<material_id::e_raw_material>(
             vol_mat);
-        m_det->volumes().back().set_material(material_id::e_raw_material, 0u);
+        m_det->material_store().template push_back<material_id::e_raw_material>(
+            vol_mat2);
+        m_det->volumes()[0].set_material(material_id::e_raw_material, 0u);
+        m_det->volumes()[1].set_material(material_id::e_raw_material, 1u);
     }
 
     scalar operator()() const { return m_step_size; }
@@ -72,7 +84,7 @@ struct nav_state {
     inline auto detector() const -> const detray::detector<> * {
         return m_det.get();
     }
-    inline auto volume() -> unsigned int { return 0u; }
+    inline auto volume() -> unsigned int { return m_volume; }
     inline void set_full_trust() {}
     inline void set_high_trust() {}
     inline void set_fair_trust() {}
@@ -80,6 +92,7 @@ struct nav_state {
     inline bool abort() { return false; }
 
     scalar m_step_size;
+    unsigned int m_volume{0u};
     std::unique_ptr<detray::detector<>> m_det;
 };
 
@@ -199,6 +212,133 @@ GTEST_TEST(detray_propagator, rk_stepper) {
     }
 }
 
+/// This tests the Dormand-Prince integration scheme of the Runge-Kutta stepper
+GTEST_TEST(detray_propagator, rk_stepper_dormand_prince) {
+
+    // Constant magnetic field
+    using bfield_t = bfield::const_field_t;
+
+    vector3 B{1.f * unit<scalar>::T, 1.f * unit<scalar>::T,
+              1.f * unit<scalar>::T};
+    const bfield_t hom_bfield = bfield::create_const_field(B);
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    stepping::config rkn_cfg{};
+    stepping::config dp_cfg{};
+    dp_cfg.scheme = stepping::rk_scheme::e_dormand_prince;
+
+    constexpr unsigned int rk_steps = 100u;
+
+    // Track generator configuration
+    const scalar p_mag{10.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        // helix trajectory
+        detail::helix helix(track, &B);
+
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> rkn_propagation{
+            rk_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr}};
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> dp_propagation{
+            rk_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr}};
+
+        rk_stepper_t<bfield_t>::state &rkn_state = rkn_propagation._stepping;
+        rk_stepper_t<bfield_t>::state &dp_state = dp_propagation._stepping;
+
+        rkn_state.set_step_size(1.f * unit<scalar>::mm);
+        dp_state.set_step_size(1.f * unit<scalar>::mm);
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(rkn_propagation, rkn_cfg);
+            rk_stepper.step(dp_propagation, dp_cfg);
+        }
+
+        // Check that the stepper position lies on the truth helix
+        const scalar path_length{dp_state.path_length()};
+        ASSERT_NEAR(path_length, rkn_state.path_length(), tol);
+
+        const point3 relative_error{(1.f / path_length) *
+                                    (dp_state().pos() - helix(path_length))};
+        EXPECT_NEAR(getter::norm(relative_error), 0.f, tol);
+
+        // The transport jacobians of both schemes agree
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                const scalar ref{
+                    getter::element(rkn_state._jac_transport, i, j)};
+                EXPECT_NEAR(getter::element(dp_state._jac_transport, i, j),
+                            ref, tol * math::max(1.f, math::fabs(ref)));
+            }
+        }
+    }
+}
+
+/// This tests the field and energy loss gradients in the jacobian transport
+/// of the Dormand-Prince scheme
+TEST(detray_propagator, rk_stepper_dormand_prince_gradients) {
+
+    using bfield_t = bfield::inhom_field_t;
+    bfield_t inhom_bfield = bfield::create_inhom_field();
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    stepping::config rkn_cfg{};
+    rkn_cfg.use_eloss_gradient = true;
+    rkn_cfg.use_field_gradient = true;
+    stepping::config dp_cfg{rkn_cfg};
+    dp_cfg.scheme = stepping::rk_scheme::e_dormand_prince;
+
+    constexpr unsigned int rk_steps = 100u;
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 5u;
+    constexpr unsigned int phi_steps = 5u;
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             phi_steps, theta_steps, p_mag)) {
+
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> rkn_propagation{
+            rk_stepper_t<bfield_t>::state{track, inhom_bfield},
+            nav_state{host_mr}};
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> dp_propagation{
+            rk_stepper_t<bfield_t>::state{track, inhom_bfield},
+            nav_state{host_mr}};
+
+        rk_stepper_t<bfield_t>::state &rkn_state = rkn_propagation._stepping;
+        rk_stepper_t<bfield_t>::state &dp_state = dp_propagation._stepping;
+
+        rkn_state.set_step_size(1.f * unit<scalar>::mm);
+        dp_state.set_step_size(1.f * unit<scalar>::mm);
+
+        for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+            rk_stepper.step(rkn_propagation, rkn_cfg);
+            rk_stepper.step(dp_propagation, dp_cfg);
+        }
+
+        ASSERT_NEAR(dp_state.path_length(), rkn_state.path_length(), tol);
+
+        // The energy loss gradient is propagated
+        EXPECT_TRUE(getter::element(dp_state._jac_transport, e_free_qoverp,
+                                    e_free_qoverp) != 1.f);
+
+        // The transport jacobians of both schemes agree
+        for (unsigned int i = 0u; i < e_free_size; ++i) {
+            for (unsigned int j = 0u; j < e_free_size; ++j) {
+                const scalar ref{
+                    getter::element(rkn_state._jac_transport, i, j)};
+                EXPECT_NEAR(getter::element(dp_state._jac_transport, i, j),
+                            ref, tol * math::max(1.f, math::fabs(ref)));
+            }
+        }
+    }
+}
+
 /// This tests the base functionality of the Runge-Kutta stepper in an
 /// in-homogeneous magnetic field, read from file
 TEST(detray_propagator, rk_stepper_inhomogeneous_bfield) {
@@ -285,6 +425,229 @@ TEST(detray_propagator, rk_stepper_inhomogeneous_bfield) {
     }
 }
 
+/// This tests that the field cache (first-same-as-last) gives the same result
+/// as evaluating the field at the beginning of every step, also when the
+/// step gets cut by a constraint or the track is moved between steps
+TEST(detray_propagator, rk_stepper_field_cache) {
+    using namespace step;
+
+    using bfield_t = bfield::inhom_field_t;
+    bfield_t inhom_bfield = bfield::create_inhom_field();
+
+    crk_stepper_t<bfield_t> crk_stepper;
+
+    constexpr unsigned int rk_steps = 100u;
+    constexpr scalar stepsize_constr{0.7f * unit<scalar>::mm};
+
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+    constexpr unsigned int theta_steps = 10u;
+    constexpr unsigned int phi_steps = 10u;
+
+    for (const auto scheme :
+         {stepping::rk_scheme::e_rkn4, stepping::rk_scheme::e_dormand_prince}) {
+
+        stepping::config cached_cfg{};
+        cached_cfg.scheme = scheme;
+        cached_cfg.use_field_cache = true;
+
+        stepping::config uncached_cfg{cached_cfg};
+        uncached_cfg.use_field_cache = false;
+
+        for (auto track :
+             uniform_track_generator<free_track_parameters<algebra_t>>(
+                 phi_steps, theta_steps, p_mag)) {
+
+            prop_state<crk_stepper_t<bfield_t>::state, nav_state> cached{
+                crk_stepper_t<bfield_t>::state{track, inhom_bfield},
+                nav_state{host_mr}};
+            prop_state<crk_stepper_t<bfield_t>::state, nav_state> uncached{
+                crk_stepper_t<bfield_t>::state{track, inhom_bfield},
+                nav_state{host_mr}};
+
+            auto &cached_state = cached._stepping;
+            auto &uncached_state = uncached._stepping;
+
+            // Steps of 1mm, every other step is cut by the constraint
+            cached_state.set_step_size(1.f * unit<scalar>::mm);
+            uncached_state.set_step_size(1.f * unit<scalar>::mm);
+
+            for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+                if (i_s % 2u == 0u) {
+                    cached_state.template set_constraint<constraint::e_user>(
+                        stepsize_constr);
+                    uncached_state.template set_constraint<constraint::e_user>(
+                        stepsize_constr);
+                } else {
+                    cached_state.template release_step<constraint::e_user>();
+                    uncached_state.template release_step<constraint::e_user>();
+                }
+
+                // Move the track between steps (e.g. by an actor)
+                if (i_s == rk_steps / 2u) {
+                    const point3 shift{1.f * unit<scalar>::cm, 0.f, 0.f};
+                    cached_state().set_pos(cached_state().pos() + shift);
+                    uncached_state().set_pos(uncached_state().pos() + shift);
+                }
+
+                crk_stepper.step(cached, cached_cfg);
+                crk_stepper.step(uncached, uncached_cfg);
+            }
+
+            ASSERT_NEAR(cached_state.path_length(),
+                        uncached_state.path_length(), 1e-5f);
+
+            const scalar pos_err{
+                getter::norm(cached_state().pos() - uncached_state().pos())};
+            const scalar dir_err{
+                getter::norm(cached_state().dir() - uncached_state().dir())};
+            EXPECT_NEAR(pos_err, 0.f, 1e-5f);
+            EXPECT_NEAR(dir_err, 0.f, 1e-6f);
+
+            for (unsigned int i = 0u; i < e_free_size; ++i) {
+                for (unsigned int j = 0u; j < e_free_size; ++j) {
+                    const scalar ref{
+                        getter::element(uncached_state._jac_transport, i, j)};
+                    EXPECT_NEAR(
+                        getter::element(cached_state._jac_transport, i, j),
+                        ref, 1e-5f * math::max(1.f, math::fabs(ref)));
+                }
+            }
+        }
+    }
+}
+
+/// This tests that the stepper looks up the volume material in the
+/// interaction table whenever the material changes
+GTEST_TEST(detray_propagator, rk_stepper_interaction_table) {
+
+    using bfield_t = bfield::const_field_t;
+    const bfield_t hom_bfield = bfield::create_const_field(
+        vector3{0.f, 0.f, 2.f * unit<scalar>::T});
+
+    rk_stepper_t<bfield_t> rk_stepper;
+
+    // Muon hypothesis, as in the stepper state
+    interaction_table<scalar> table(pdg_particle::eMuon,
+                                    105.7f * unit<scalar>::MeV, -1.f);
+    const dindex idx{table.add_material(vol_mat)};
+    const dindex idx2{table.add_material(vol_mat2)};
+
+    stepping::config table_cfg{};
+    table_cfg.use_interaction_table = true;
+
+    constexpr unsigned int rk_steps = 50u;
+    const scalar p_mag{1.f * unit<scalar>::GeV};
+
+    for (auto track : uniform_track_generator<free_track_parameters<algebra_t>>(
+             5u, 5u, p_mag)) {
+
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> tab_propagation{
+            rk_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr}};
+        prop_state<rk_stepper_t<bfield_t>::state, nav_state> ref_propagation{
+            rk_stepper_t<bfield_t>::state{track, hom_bfield},
+            nav_state{host_mr}};
+
+        auto &tab_state = tab_propagation._stepping;
+        auto &ref_state = ref_propagation._stepping;
+
+        tab_state.set_volume_material(nullptr, &table);
+        tab_state.set_step_size(1.f * unit<scalar>::mm);
+        ref_state.set_step_size(1.f * unit<scalar>::mm);
+
+        for (const auto [vol_idx, mat_idx] :
+             {std::pair{0u, idx}, std::pair{1u, idx2}}) {
+
+            tab_propagation._navigation.m_volume = vol_idx;
+            ref_propagation._navigation.m_volume = vol_idx;
+
+            for (unsigned int i_s = 0u; i_s < rk_steps; i_s++) {
+                rk_stepper.step(tab_propagation, table_cfg);
+                rk_stepper.step(ref_propagation);
+            }
+
+            // The table index follows the volume material
+            ASSERT_TRUE(tab_state._mat != nullptr);
+            EXPECT_EQ(*tab_state._mat, vol_idx == 0u ? vol_mat : vol_mat2);
+            EXPECT_EQ(tab_state._mat_table_idx, mat_idx);
+            EXPECT_TRUE(tab_state.use_interaction_table(table_cfg));
+
+            // Same energy loss as the analytic computation
+            const scalar ref_p{ref_state().p()};
+            const scalar e_loss{p_mag - ref_p};
+            ASSERT_TRUE(e_loss > 0.f);
+            EXPECT_NEAR(tab_state().p(), ref_p, 1e-2f * e_loss);
+        }
+    }
+}
+
+/// This tests the analytic field gradient of the interpolated field map
+TEST(detray_propagator, rk_stepper_field_gradient) {
+
+    using bfield_t = bfield::inhom_field_t;
+    using grad_view_t = bfield::inhom_grad_view_t;
+
+    bfield_t inhom_bfield = bfield::create_inhom_field();
+    const grad_view_t grad_view{inhom_bfield};
+
+    using grad_stepper_t = rk_stepper<grad_view_t, algebra_t>;
+
+    const free_track_parameters<algebra_t> track{};
+    grad_stepper_t::state grad_state{track, grad_view};
+
+    // The interpolated field is linear along every axis inside of a cell: At
+    // least one of the one-sided differences does not leave the cell
+    constexpr scalar delta{0.5f * unit<scalar>::mm};
+
+    for (scalar r : {10.f, 200.f, 600.f, 1100.f}) {
+        for (scalar phi : {0.1f, 1.3f, 2.9f, -2.f}) {
+            for (scalar z : {-2500.f, -300.f, 50.f, 1700.f}) {
+                const point3 pos{r * math::cos(phi), r * math::sin(phi), z};
+
+                // The adapter gives the same field
+                const auto b = grad_view.at(pos[0], pos[1], pos[2]);
+                const auto b_ref = inhom_bfield.at(pos[0], pos[1], pos[2]);
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    ASSERT_FLOAT_EQ(b[i], b_ref[i]);
+                }
+
+                const auto dBdr = grad_state.evaluate_field_gradient(pos);
+                for (unsigned int j = 0u; j < 3u; ++j) {
+                    point3 pos1 = pos;
+                    pos1[j] += delta;
+                    point3 pos2 = pos;
+                    pos2[j] -= delta;
+                    const auto b1 = grad_view.at(pos1[0], pos1[1], pos1[2]);
+                    const auto b2 = grad_view.at(pos2[0], pos2[1], pos2[2]);
+
+                    for (unsigned int i = 0u; i < 3u; ++i) {
+                        const scalar grad{getter::element(dBdr, i, j)};
+                        const scalar fwd{(b1[i] - b[i]) / delta};
+                        const scalar bwd{(b[i] - b2[i]) / delta};
+                        const scalar diff{math::min(math::fabs(grad - fwd),
+                                                    math::fabs(grad - bwd))};
+
+                        EXPECT_NEAR(diff, 0.f,
+                                    1e-2f * math::fabs(grad) + 1e-9f);
+                    }
+                }
+            }
+        }
+    }
+
+    // Outside of the field map, the closest boundary cell is used
+    for (const point3 &pos : {point3{0.f, 0.f, 1e5f},
+                              point3{-1e5f, 1e5f, -1e5f},
+                              point3{1e5f, -1e5f, 1e5f}}) {
+        const auto dBdr = grad_state.evaluate_field_gradient(pos);
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                EXPECT_TRUE(std::isfinite(getter::element(dBdr, i, j)));
+            }
+        }
+    }
+}
+
 /// This tests dqop of the Runge-Kutta stepper
 TEST(detray_propagator, qop_derivative) {
     using namespace step;
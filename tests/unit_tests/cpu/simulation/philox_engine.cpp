@@ -0,0 +1,141 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/simulation/philox_engine.hpp"
+
+#include "detray/simulation/event_generator/random_numbers.hpp"
+#include "detray/simulation/event_generator/random_track_generator.hpp"
+#include "detray/simulation/landau_distribution.hpp"
+#include "detray/test/common/types.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/statistics.hpp"
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <cstdint>
+#include <vector>
+
+using namespace detray;
+
+using algebra_t = test::algebra;
+using scalar_t = test::scalar;
+
+/// Compare with the known answer tests of the Random123 library
+GTEST_TEST(detray_simulation, philox_known_answers) {
+
+    using counter_t = philox_engine::counter_type;
+
+    EXPECT_EQ(philox_engine::generate_block({0u, 0u, 0u, 0u}, {0u, 0u}),
+              (counter_t{0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u}));
+
+    EXPECT_EQ(philox_engine::generate_block(
+                  {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                  {0xffffffffu, 0xffffffffu}),
+              (counter_t{0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu}));
+
+    EXPECT_EQ(philox_engine::generate_block(
+                  {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                  {0xa4093822u, 0x299f31d0u}),
+              (counter_t{0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u}));
+}
+
+/// Test the stream handling of the counter-based engine
+GTEST_TEST(detray_simulation, philox_streams) {
+
+    constexpr std::size_t n{11u};
+
+    philox_engine rng{42u, 1u, 2u, 3u};
+
+    std::vector<philox_engine::result_type> sequence{};
+    for (std::size_t i = 0u; i < n; ++i) {
+        sequence.push_back(rng());
+    }
+
+    // Same key and stream: Same sequence
+    rng.set_stream(1u, 2u, 3u);
+    for (std::size_t i = 0u; i < n; ++i) {
+        EXPECT_EQ(rng(), sequence[i]);
+    }
+
+    // Skip ahead
+    for (std::size_t i = 0u; i < n; ++i) {
+        philox_engine skip{42u, 1u, 2u, 3u};
+        skip.discard(i);
+        EXPECT_EQ(skip(), sequence[i]) << i;
+    }
+
+    // Different event, track, surface or seed: Different sequence
+    for (philox_engine other :
+         {philox_engine{42u, 0u, 2u, 3u}, philox_engine{42u, 1u, 0u, 3u},
+          philox_engine{42u, 1u, 2u, 0u}, philox_engine{43u, 1u, 2u, 3u}}) {
+        EXPECT_NE(other(), sequence[0]);
+    }
+
+    // Uniform random numbers in (0, 1)
+    constexpr std::size_t n_samples{1000000u};
+    std::vector<float> u_float(n_samples);
+    std::vector<double> u_double(n_samples);
+    for (std::size_t i = 0u; i < n_samples; ++i) {
+        u_float[i] = rng.uniform<float>();
+        u_double[i] = rng.uniform<double>();
+
+        ASSERT_TRUE(u_float[i] > 0.f && u_float[i] < 1.f);
+        ASSERT_TRUE(u_double[i] > 0. && u_double[i] < 1.);
+    }
+    EXPECT_NEAR(statistics::mean(u_float), 0.5f, 1e-3f);
+    EXPECT_NEAR(statistics::variance(u_float), 1.f / 12.f, 1e-3f);
+    EXPECT_NEAR(statistics::mean(u_double), 0.5, 1e-3);
+    EXPECT_NEAR(statistics::variance(u_double), 1. / 12., 1e-3);
+
+    // Landau samples only depend on the stream
+    landau_distribution<scalar_t> ld{};
+    philox_engine rng1{7u, 0u, 5u, 10u};
+    philox_engine rng2{7u, 0u, 5u, 10u};
+    EXPECT_EQ(ld(rng1, 0.f, 1.f), ld(rng2, 0.f, 1.f));
+}
+
+/// The tracks of a counter-based track generator do not depend on the order
+/// in which they are generated
+GTEST_TEST(detray_simulation, random_track_generator_streams) {
+
+    using generator_t = detail::counter_random_numbers<scalar_t>;
+    using trk_generator_t =
+        random_track_generator<free_track_parameters<algebra_t>, generator_t>;
+
+    trk_generator_t::configuration trk_gen_cfg{};
+    trk_gen_cfg.n_tracks(100u).seed(42u).randomize_charge(true);
+    trk_gen_cfg.mom_range(1.f * unit<scalar_t>::GeV, 2.f * unit<scalar_t>::GeV);
+    trk_gen_cfg.origin_stddev({0.1f * unit<scalar_t>::mm,
+                               0.1f * unit<scalar_t>::mm,
+                               0.2f * unit<scalar_t>::mm});
+
+    std::vector<free_track_parameters<algebra_t>> tracks{};
+    for (const auto track : trk_generator_t{trk_gen_cfg}) {
+        tracks.push_back(track);
+    }
+    ASSERT_EQ(tracks.size(), 100u);
+
+    // Only generate every other track
+    trk_generator_t trk_gen{trk_gen_cfg};
+    std::size_t n_tracks{0u};
+    for (auto itr = trk_gen.begin(); itr != trk_gen.end(); ++itr) {
+        if (n_tracks % 2u == 1u) {
+            const auto track = *itr;
+            const auto &ref = tracks[n_tracks];
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                EXPECT_EQ(track.pos()[i], ref.pos()[i]);
+                EXPECT_EQ(track.dir()[i], ref.dir()[i]);
+            }
+            EXPECT_EQ(track.qop(), ref.qop());
+        }
+        ++n_tracks;
+    }
+    ASSERT_EQ(n_tracks, 100u);
+}
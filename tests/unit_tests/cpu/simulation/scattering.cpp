@@ -6,6 +6,7 @@
  */
 
 // Project include(s).
+#include "detray/definitions/units.hpp"
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/simulation/random_scatterer.hpp"
 #include "detray/simulation/scattering_helper.hpp"
@@ -19,6 +20,7 @@
 // System include(s).
 #include <algorithm>
 #include <random>
+#include <utility>
 #include <vector>
 
 using namespace detray;
@@ -128,3 +130,55 @@ GTEST_TEST(detray_simulation, angle_update) {
     EXPECT_NEAR((var_theta - statistics::rms(thetas, theta0)) / var_theta, 0.f,
                 1e-2f);
 }
+
+// Test the random streams of the material interactions
+GTEST_TEST(detray_simulation, random_scatterer_streams) {
+
+    using scatterer_t = random_scatterer<algebra_t>;
+
+    const scatterer_t scatterer{};
+    const vector3 dir = vector::normalize(vector3{1.f, 2.f, 3.f});
+    const scalar_t p0{1.f * unit<scalar_t>::GeV};
+    const scalar_t e_loss_mpv{1.f * unit<scalar_t>::MeV};
+    const scalar_t e_loss_sigma{0.1f * unit<scalar_t>::MeV};
+    const scalar_t scattering_angle{0.01f};
+
+    // Interaction of the track on the surface with index @param sf
+    auto cross = [&](scatterer_t::state &s, const dindex sf) {
+        s.set_stream(sf);
+        const scalar_t p = scatterer.attenuate(e_loss_mpv, e_loss_sigma,
+                                               s.mass, p0, s.generator);
+        const vector3 new_dir =
+            scatterer.scatter(dir, scattering_angle, s.generator);
+        return std::make_pair(p, new_dir);
+    };
+
+    // Scattering the same track twice gives bit-identical results
+    scatterer_t::state state_a{42u, 3u, 7u};
+    scatterer_t::state state_b{42u, 3u, 7u};
+    for (const dindex sf : {5u, 10u, 5u}) {
+        const auto [p_a, dir_a] = cross(state_a, sf);
+        const auto [p_b, dir_b] = cross(state_b, sf);
+
+        EXPECT_EQ(p_a, p_b);
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            EXPECT_EQ(dir_a[i], dir_b[i]);
+        }
+    }
+
+    // Re-crossing a surface draws different random numbers
+    scatterer_t::state state{42u, 3u, 7u};
+    const auto [p_first, dir_first] = cross(state, 5u);
+    const auto [p_second, dir_second] = cross(state, 5u);
+
+    EXPECT_NE(p_first, p_second);
+    EXPECT_FALSE(dir_first[0] == dir_second[0] &&
+                 dir_first[1] == dir_second[1] &&
+                 dir_first[2] == dir_second[2]);
+
+    // Another track draws different random numbers on the same surface
+    scatterer_t::state other_track{42u, 3u, 8u};
+    const auto [p_other, dir_other] = cross(other_track, 5u);
+
+    EXPECT_NE(p_first, p_other);
+}
@@ -330,6 +330,55 @@ GTEST_TEST(detray_grid, closed_irregular_axis) {
     EXPECT_EQ(cir_axis.range(3.f, nhood11s), expected_range);
 }
 
+GTEST_TEST(detray_grid, closed_irregular_lut_axis) {
+
+    using lut_binning_t = irregular_lut<>;
+
+    // Lower bin edges for the bins in [-3, 15], plus the final upper bin edge
+    const vecmem::vector<scalar> edges = {-3.f, 1.f,  2.f, 4.f,
+                                          8.f,  12.f, 15.f};
+    // The index table goes behind the bin edges
+    vecmem::vector<scalar> bin_edges = edges;
+    const auto index_table = lut_binning_t::make_index_table(edges);
+    bin_edges.insert(bin_edges.end(), index_table.begin(), index_table.end());
+
+    dindex_range edge_range = {0u, 6u};
+
+    // A closed irregular z-axis with and without index table
+    single_axis<closed<label::e_z>, irregular<>> cir_axis(edge_range,
+                                                          &bin_edges);
+    single_axis<closed<label::e_z>, lut_binning_t> lut_axis(edge_range,
+                                                            &bin_edges);
+
+    EXPECT_EQ(index_table.size(), lut_binning_t::lut_size_factor * 6u);
+    EXPECT_EQ(lut_axis.binning(), axis::binning::e_irregular);
+    EXPECT_EQ(lut_axis.nbins(), 6u);
+
+    // Bin tests
+    EXPECT_EQ(lut_axis.bin(-2), 0u);
+    EXPECT_EQ(lut_axis.bin(10), 4u);
+    EXPECT_EQ(lut_axis.bin(5.8f), 3u);
+    // Underflow test
+    EXPECT_EQ(lut_axis.bin(-4), 0u);
+    // Overflow test
+    EXPECT_EQ(lut_axis.bin(17), 5u);
+
+    // Compare to the binary search, including values on the bin edges
+    for (scalar v = -5.f; v < 17.f; v += 0.05f) {
+        EXPECT_EQ(lut_axis.bin(v), cir_axis.bin(v)) << "value: " << v;
+    }
+    for (const scalar e : edges) {
+        EXPECT_EQ(lut_axis.bin(e), cir_axis.bin(e)) << "edge: " << e;
+    }
+
+    // Axis range access
+    const darray<dindex, 2> nhood11i = {1u, 1u};
+    const darray<scalar, 2> nhood10s = {1.5f, 0.2f};
+
+    EXPECT_EQ(lut_axis.range(3.f, nhood11i), cir_axis.range(3.f, nhood11i));
+    EXPECT_EQ(lut_axis.range(3.f, nhood10s), cir_axis.range(3.f, nhood10s));
+}
+
 GTEST_TEST(detray_grid, multi_axis) {
 
     // readable axis ownership definition
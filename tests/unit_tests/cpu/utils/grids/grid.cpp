@@ -8,7 +8,9 @@
 // Detray include(s)
 #include "detray/utils/grid/grid.hpp"
 
+#include "detray/builders/grid_baker.hpp"
 #include "detray/builders/grid_builder.hpp"
+#include "detray/builders/grid_compactor.hpp"
 #include "detray/definitions/detail/indexing.hpp"
 #include "detray/geometry/shapes/cuboid3D.hpp"
 #include "detray/test/common/types.hpp"
@@ -23,7 +25,9 @@
 
 // System include(s)
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <stdexcept>
 
 using namespace detray;
 using namespace detray::axis;
@@ -265,6 +269,180 @@ GTEST_TEST(detray_grid, dynamic_array) {
         std::equal(flat_bin_view.begin(), flat_bin_view.end(), seq.begin()));
 }
 
+/// Test the compaction of a grid into CSR bins with narrow indices
+GTEST_TEST(detray_grid, compact_bins) {
+
+    vecmem::host_memory_resource host_mr;
+
+    using grid_owning_t = grid<axes<cuboid3D>, bins::dynamic_array<dindex>>;
+    using compact_t = compact_grid_t<grid_owning_t, std::uint16_t>;
+
+    static_assert(
+        std::is_same_v<compact_t::value_type, std::uint16_t>,
+        "Compact grid should hold narrow indices");
+
+    // Every second bin holds one element, otherwise three
+    grid_owning_t::bin_container_type bin_data{};
+    bin_data.entries.resize(80'000u);
+    bin_data.bins.resize(40'000u);
+
+    int i{0};
+    dindex offset{0u};
+    dindex entry{0u};
+    complete<> completer{};
+
+    for (auto& data : bin_data.bins) {
+        data.offset = offset;
+        data.capacity = (i % 2) ? 1u : 3u;
+
+        detray::bins::dynamic_array bin{bin_data.entries.data(), data};
+        offset += bin.capacity();
+
+        // Leave every tenth bin empty
+        if (i % 10 != 0) {
+            completer(bin, entry);
+        }
+        ++entry;
+        ++i;
+    }
+
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+    grid_owning_t grid_own(std::move(bin_data), std::move(axes_own));
+
+    const compact_t grid_compact =
+        compact_grid<std::uint16_t>(grid_own, host_mr);
+
+    // Same binning and bin content
+    EXPECT_EQ(grid_compact.nbins(), grid_own.nbins());
+    EXPECT_EQ(grid_compact.size(), grid_own.size());
+    EXPECT_EQ(grid_compact.bins().entry_data().size(), grid_own.size());
+
+    for (dindex gbin = 0u; gbin < grid_own.nbins(); ++gbin) {
+        const auto bin = grid_own.bin(gbin);
+        const auto compact_bin = grid_compact.bin(gbin);
+
+        ASSERT_EQ(compact_bin.size(), bin.size()) << "bin " << gbin;
+        EXPECT_TRUE(std::equal(bin.begin(), bin.end(), compact_bin.begin()));
+    }
+
+    // Same neighborhood search
+    const point3 p{-4.5f, -4.5f, 4.5f};
+    const darray<dindex, 2> win_size{1u, 1u};
+
+    std::vector<dindex> expected{};
+    for (const dindex e : grid_own.search(p, win_size)) {
+        expected.push_back(e);
+    }
+    std::vector<dindex> result{};
+    for (const std::uint16_t e : grid_compact.search(p, win_size)) {
+        result.push_back(e);
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(result, expected);
+
+    // Add the compact grid to a grid collection
+    using compact_n_owning_t = compact_t::template type<false>;
+
+    grid_collection<compact_n_owning_t> grid_coll(&host_mr);
+    grid_coll.push_back(grid_compact);
+    grid_coll.push_back(grid_compact);
+
+    EXPECT_EQ(grid_coll.size(), 2u);
+    EXPECT_EQ(grid_coll.bin_storage().size(), 2u * grid_own.nbins());
+
+    const auto coll_grid = grid_coll[1];
+    EXPECT_EQ(coll_grid.nbins(), grid_own.nbins());
+    EXPECT_EQ(coll_grid.size(), grid_own.size());
+    result.clear();
+    for (const std::uint16_t e : coll_grid.search(p, win_size)) {
+        result.push_back(e);
+    }
+    EXPECT_EQ(result, expected);
+
+    // The entry indices do not fit into 8 bits
+    EXPECT_THROW(compact_grid<std::uint8_t>(grid_own, host_mr),
+                 std::invalid_argument);
+}
+
+/// Test the baking of the bin neighborhoods into the bin content
+GTEST_TEST(detray_grid, baked_neighborhood) {
+
+    vecmem::host_memory_resource host_mr;
+
+    using grid_owning_t = grid<axes<cuboid3D>, bins::dynamic_array<dindex>>;
+
+    // Only grids with dynamic bin capacities keep a baked search window
+    static_assert(grid_owning_t::is_bakeable);
+    static_assert(!grid<axes<cuboid3D>, bins::single<dindex>>::is_bakeable);
+
+    // Every bin holds its global bin index
+    grid_owning_t::bin_container_type bin_data{};
+    bin_data.entries.resize(40'000u);
+    bin_data.bins.resize(40'000u);
+
+    dindex gbin{0u};
+    for (auto& data : bin_data.bins) {
+        data.offset = gbin;
+        data.capacity = 1u;
+
+        detray::bins::dynamic_array bin{bin_data.entries.data(), data};
+        bin.push_back(gbin);
+        ++gbin;
+    }
+
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+    grid_owning_t grid_own(std::move(bin_data), std::move(axes_own));
+
+    EXPECT_FALSE(grid_own.is_baked());
+
+    const darray<dindex, 2> win_size{1u, 1u};
+    const grid_owning_t baked_grid = bake_neighborhood(grid_own, win_size);
+
+    EXPECT_TRUE(baked_grid.is_baked());
+    EXPECT_EQ(baked_grid.baked_window(), win_size);
+    EXPECT_EQ(baked_grid.nbins(), grid_own.nbins());
+
+    // A single bin lookup in the baked grid yields the neighborhood
+    auto check_bin = [&](const point3& p, const std::size_t n_expected) {
+        std::vector<dindex> expected{};
+        for (const dindex e : grid_own.search(p, win_size)) {
+            expected.push_back(e);
+        }
+        std::vector<dindex> result{};
+        for (const dindex e : baked_grid.search(p)) {
+            result.push_back(e);
+        }
+        std::sort(expected.begin(), expected.end());
+        std::sort(result.begin(), result.end());
+
+        EXPECT_EQ(result.size(), n_expected);
+        EXPECT_EQ(result, expected);
+    };
+
+    // Inside the grid
+    check_bin({-4.5f, -4.5f, 4.5f}, 27u);
+    // At the closed axis boundaries
+    check_bin({-9.5f, -19.5f, 99.5f}, 8u);
+    check_bin({9.5f, 0.5f, 50.5f}, 18u);
+
+    // The baking survives the grid collection
+    using grid_n_owning_t = grid_owning_t::template type<false>;
+
+    grid_collection<grid_n_owning_t> grid_coll(&host_mr);
+    grid_coll.push_back(grid_own);
+    grid_coll.push_back(baked_grid);
+
+    EXPECT_FALSE(grid_coll[0].is_baked());
+    EXPECT_TRUE(grid_coll[1].is_baked());
+    EXPECT_EQ(grid_coll[1].baked_window(), win_size);
+}
+
 /// Test bin entry retrieval
 GTEST_TEST(detray_grid, bin_view) {
 
@@ -385,6 +563,102 @@ GTEST_TEST(detray_grid, bin_view) {
     }
 }
 
+/// Test the search for the bins that are crossed by a straight line
+GTEST_TEST(detray_grid, ray_march) {
+
+    // 3D cartesian, replacing grid
+    using grid_t = grid<axes<cuboid3D>, bins::single<scalar>>;
+    using vector3 = test::vector3;
+    using transform3 = test::transform3;
+
+    // Bin entries: global bin index + 1
+    grid_t::bin_container_type bin_data{};
+    bin_data.resize(40'000u);
+    std::generate_n(bin_data.begin(), 40'000u,
+                    bin_content_sequence<replace<>, bins::single<scalar>>());
+
+    dvector<scalar> bin_edges_cp(bin_edges);
+    dvector<dindex_range> edge_ranges_cp(edge_ranges);
+
+    cartesian_3D<is_owning, host_container_types> axes_own(
+        std::move(edge_ranges_cp), std::move(bin_edges_cp));
+    grid_t grid_3D(std::move(bin_data), std::move(axes_own));
+
+    const transform3 identity{};
+
+    // Along the x-axis: crosses the bins 0 to 5 (bin width 1)
+    const point3 p = {-9.5f, -19.5f, 1.f};
+    const vector3 dir_x = {1.f, 0.f, 0.f};
+
+    std::vector<scalar> expected{1, 2, 3, 4, 5, 6};
+
+    const auto march_x = grid_3D.search(identity, p, dir_x, 5.f);
+
+    ASSERT_EQ(march_x.size(), 6u);
+    for (auto [i, entry] : detray::views::enumerate(march_x)) {
+        EXPECT_EQ(entry, expected[i]) << "bin entry: " << entry;
+    }
+
+    // Along the z-axis: crosses the bins 0 to 2 (bin width 2)
+    const vector3 dir_z = {0.f, 0.f, 1.f};
+
+    expected = {1, 801, 1601};
+
+    const auto march_z = grid_3D.search(identity, p, dir_z, 4.5f);
+
+    ASSERT_EQ(march_z.size(), 3u);
+    for (auto [i, entry] : detray::views::enumerate(march_z)) {
+        EXPECT_EQ(entry, expected[i]) << "bin entry: " << entry;
+    }
+
+    // Diagonal: no bin along the line may be missed
+    const vector3 dir_xy = vector::normalize(vector3{1.f, 1.f, 0.f});
+
+    const auto march_xy = grid_3D.search(identity, p, dir_xy, 2.9f);
+
+    std::vector<scalar> result{};
+    for (scalar entry : march_xy) {
+        result.push_back(entry);
+    }
+    // Every bin only once
+    std::vector<scalar> unique_result{result};
+    std::sort(unique_result.begin(), unique_result.end());
+    unique_result.erase(
+        std::unique(unique_result.begin(), unique_result.end()),
+        unique_result.end());
+
+    ASSERT_EQ(result.size(), unique_result.size());
+    for (scalar entry : {1.f, 22.f, 43.f}) {
+        EXPECT_TRUE(std::find(result.begin(), result.end(), entry) !=
+                    result.end())
+            << "missing bin entry: " << entry;
+    }
+
+    // Crosses more bins than fit into the bin sequence: Falls back to the
+    // window of bins around the line
+    const vector3 dir_long = vector::normalize(vector3{1.f, 2.f, 1.5f});
+    constexpr scalar long_dist{52.f};
+
+    axis::detail::bin_sequence<grid_t> seq{grid_3D};
+    EXPECT_FALSE(
+        axis::detail::march(grid_3D, identity, p, dir_long, long_dist, seq));
+    EXPECT_GT(seq.size(), seq.capacity());
+
+    const auto march_long = grid_3D.search(identity, p, dir_long, long_dist);
+
+    result.clear();
+    for (scalar entry : march_long) {
+        result.push_back(entry);
+    }
+    // No bin along the line is missed
+    for (scalar s = 0.f; s < long_dist; s += 0.01f) {
+        const scalar entry{grid_3D.search(p + s * dir_long)[0]};
+        ASSERT_TRUE(std::find(result.begin(), result.end(), entry) !=
+                    result.end())
+            << "missing bin entry: " << entry << " at s = " << s;
+    }
+}
+
 /// Integration test: Test replace population
 GTEST_TEST(detray_grid, replace_population) {
 
@@ -603,4 +877,15 @@ GTEST_TEST(detray_grid, regular_attach_population) {
     for (scalar entry : grid_search4) {
         EXPECT_TRUE(entry == 5.f || entry == 6.f || entry == 7.f);
     }
+
+    // Every entry only once
+    const auto grid_search5 = g3ra.search_unique(p, search_window_size);
+    ASSERT_EQ(grid_search5.size(), 3u);
+
+    std::vector<scalar> result{};
+    for (scalar entry : grid_search5) {
+        result.push_back(entry);
+    }
+    std::sort(result.begin(), result.end());
+    EXPECT_EQ(result, entries);
 }
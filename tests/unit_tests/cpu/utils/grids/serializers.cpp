@@ -22,7 +22,9 @@
 #include <gtest/gtest.h>
 
 // System inculde(s)
+#include <algorithm>
 #include <climits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::axis;
@@ -108,3 +110,83 @@ GTEST_TEST(detray_grid, serializer3D) {
     expected_mbin = {1u, 1u, 1u};
     EXPECT_EQ(serializer(axes, 13u), expected_mbin);
 }
+
+GTEST_TEST(detray_grid, morton_serializer2D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 16u}, {2u, 16u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    polar_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    morton_serializer<2> serializer{};
+
+    // Serializing (the phi axis is circular)
+    multi_bin<2> mbin{0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {1u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {0u, 15u};
+    EXPECT_EQ(serializer(axes, mbin), 2u);
+    mbin = {0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 8u);
+    mbin = {1u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 9u);
+    mbin = {8u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 64u);
+
+    // Deserialize
+    multi_bin<2> expected_mbin{0u, 0u};
+    EXPECT_EQ(serializer(axes, 0u), expected_mbin);
+    expected_mbin = {0u, 15u};
+    EXPECT_EQ(serializer(axes, 2u), expected_mbin);
+    expected_mbin = {1u, 1u};
+    EXPECT_EQ(serializer(axes, 9u), expected_mbin);
+    expected_mbin = {8u, 0u};
+    EXPECT_EQ(serializer(axes, 64u), expected_mbin);
+
+    // Number of bins that is not a multiple of the tile size
+    vecmem::vector<dindex_range> edge_ranges2 = {{0u, 6u}, {2u, 13u}};
+    polar_axes axes2(std::move(edge_ranges2), vecmem::vector<scalar>{});
+
+    // The serialization is dense and can be reversed
+    std::vector<bool> visited(6u * 13u, false);
+    for (dindex gbin = 0u; gbin < 6u * 13u; ++gbin) {
+        const multi_bin<2> loc_bin = serializer(axes2, gbin);
+        ASSERT_LT(loc_bin[0], 6u);
+        ASSERT_LT(loc_bin[1], 13u);
+        EXPECT_EQ(serializer(axes2, loc_bin), gbin);
+        visited[loc_bin[0] + 6u * loc_bin[1]] = true;
+    }
+    EXPECT_TRUE(std::all_of(visited.begin(), visited.end(),
+                            [](bool v) { return v; }));
+}
+
+GTEST_TEST(detray_grid, morton_serializer3D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 5u}, {2u, 9u}, {4u, 7u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    cylinder_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    morton_serializer<3> serializer{};
+
+    // First tile is complete: Z-order
+    multi_bin<3> mbin{1u, 0u, 0u};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {0u, 0u, 1u};
+    EXPECT_EQ(serializer(axes, mbin), 4u);
+
+    // The serialization is dense and can be reversed
+    const dindex n_bins{5u * 9u * 7u};
+    for (dindex gbin = 0u; gbin < n_bins; ++gbin) {
+        const multi_bin<3> loc_bin = serializer(axes, gbin);
+        ASSERT_LT(loc_bin[0], 5u);
+        ASSERT_LT(loc_bin[1], 9u);
+        ASSERT_LT(loc_bin[2], 7u);
+        EXPECT_EQ(serializer(axes, loc_bin), gbin);
+    }
+}
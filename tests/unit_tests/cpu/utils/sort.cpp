@@ -31,3 +31,32 @@ GTEST_TEST(detray_utils, selection_sort) {
 
     ASSERT_EQ(vec, vec_sorted);
 }
+
+GTEST_TEST(detray_utils, shift_insertion_sort) {
+
+    std::vector<double> vec = {4.1, 5., 1.2, 1.4, 9.};
+    std::vector<double> vec_sorted = {1.2, 1.4, 4.1, 5., 9.};
+
+    detray::shift_insertion_sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+
+    // Almost sorted range
+    vec = {1.2, 4.1, 1.4, 5., 9.};
+    detray::shift_insertion_sort(vec.begin(), vec.end());
+
+    ASSERT_EQ(vec, vec_sorted);
+}
+
+GTEST_TEST(detray_utils, partial_selection_sort) {
+
+    std::vector<double> vec = {4.1, 5., 1.2, 9., 1.4};
+
+    detray::partial_selection_sort(vec.begin(), vec.begin() + 2, vec.end());
+
+    ASSERT_EQ(vec[0], 1.2);
+    ASSERT_EQ(vec[1], 1.4);
+    for (std::size_t i = 2u; i < vec.size(); ++i) {
+        ASSERT_TRUE(vec[i] >= 1.4);
+    }
+}
@@ -153,6 +153,43 @@ GTEST_TEST(io, json_grid_payload) {
     EXPECT_EQ(g.bins.size(), pg.bins.size());
 }
 
+/// This tests the json io for the baked search window of a grid
+GTEST_TEST(io, json_grid_baked_window_payload) {
+
+    detray::io::axis_payload a0{
+        detray::axis::binning::e_regular, detray::axis::bounds::e_circular,
+        detray::axis::label::e_phi, 1u,
+        std::vector<detray::real_io>{-detray::constant<detray::real_io>::pi,
+                                     detray::constant<detray::real_io>::pi}};
+
+    detray::io::axis_payload a1{
+        detray::axis::binning::e_regular, detray::axis::bounds::e_closed,
+        detray::axis::label::e_r, 1u, std::vector<detray::real_io>{0.f, 2.f}};
+
+    detray::io::grid_payload<> g;
+    g.grid_link = {detray::io::grid_payload<>::grid_type::polar2_grid, 0u};
+    g.owner_link = {1u};
+    g.axes = {a0, a1};
+    g.bins = {{{0u, 0u}, {0u, 1u}}};
+
+    // The key is only written for baked grids
+    nlohmann::ordered_json j;
+    j["grid"] = g;
+    EXPECT_TRUE(j["grid"].find("baked_window") == j["grid"].end());
+
+    detray::io::grid_payload<> pg = j["grid"];
+    EXPECT_EQ(pg.baked_window[0], 0u);
+    EXPECT_EQ(pg.baked_window[1], 0u);
+
+    g.baked_window = {2u, 1u};
+    j["grid"] = g;
+    ASSERT_TRUE(j["grid"].find("baked_window") != j["grid"].end());
+
+    pg = j["grid"].get<detray::io::grid_payload<>>();
+    EXPECT_EQ(pg.baked_window[0], 2u);
+    EXPECT_EQ(pg.baked_window[1], 1u);
+}
+
 /// This tests the json io for a surface mask
 GTEST_TEST(io, json_mask_payload) {
 
@@ -10,6 +10,7 @@
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/io/covfie/read_bfield.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // Covfie include(s)
 #include <covfie/core/backend/primitive/constant.hpp>
@@ -18,6 +19,7 @@
 #include <covfie/core/backend/transformer/nearest_neighbour.hpp>
 #include <covfie/core/backend/transformer/strided.hpp>
 #include <covfie/core/field.hpp>
+#include <covfie/core/field_view.hpp>
 #include <covfie/core/vector.hpp>
 
 namespace detray::bfield {
@@ -58,3 +60,17 @@ inline inhom_field_t create_inhom_field() {
 }
 
 }  // namespace detray::bfield
+
+namespace detray::detail {
+
+/// The constant covfie field (and its view) is homogeneous
+/// @{
+template <>
+struct is_const_field<bfield::const_field_t> : public std::true_type {};
+
+template <>
+struct is_const_field<bfield::const_field_t::view_t> : public std::true_type {
+};
+/// @}
+
+}  // namespace detray::detail
@@ -0,0 +1,175 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/math.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/detectors/bfield.hpp"
+
+// Covfie include(s)
+#include <covfie/core/backend/transformer/affine.hpp>
+#include <covfie/core/backend/transformer/linear.hpp>
+#include <covfie/core/field.hpp>
+#include <covfie/core/field_view.hpp>
+
+// System include(s)
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace detray::bfield {
+
+/// @brief Field access that provides the analytic gradient of the field.
+///
+/// Can be used as the magnetic field type of the Runge-Kutta stepper, which
+/// then uses @c gradient() instead of finite differences for the transport
+/// of the covariance (see @c stepping::config::use_field_gradient).
+///
+/// @tparam backend_t the covfie backend of the field
+template <typename backend_t>
+class gradient_view;
+
+/// @brief Specialization for trilinear interpolation on a regular grid that
+/// is placed in global coordinates by an affine transformation.
+///
+/// The gradient is taken directly from the interpolation cell, i.e. one cell
+/// lookup (eight grid points) replaces six field evaluations for central
+/// finite differences.
+template <typename storage_t>
+class gradient_view<
+    covfie::backend::affine<covfie::backend::linear<storage_t>>> {
+
+    public:
+    using backend_t =
+        covfie::backend::affine<covfie::backend::linear<storage_t>>;
+    using field_t = covfie::field<backend_t>;
+    using view_t = covfie::field_view<backend_t>;
+    using output_t = typename view_t::output_t;
+    using scalar_type =
+        std::remove_cv_t<std::remove_reference_t<decltype(std::declval<
+                                                           output_t>()[0])>>;
+    /// Field gradient dB_i/dx_j for field component i and coordinate j
+    using gradient_t = darray<darray<scalar_type, 3u>, 3u>;
+
+    /// Construct from the owning @param field (host)
+    DETRAY_HOST
+    gradient_view(const field_t &field) : m_view{field} {}
+
+    /// Construct from a @param view of the field
+    DETRAY_HOST_DEVICE
+    gradient_view(const view_t &view) : m_view{view} {}
+
+    /// @returns the field at the position (@param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    output_t at(const scalar_type x, const scalar_type y,
+                const scalar_type z) const {
+        return m_view.at(x, y, z);
+    }
+
+    /// @returns the gradient of the interpolated field at the position
+    /// (@param x, @param y, @param z)
+    DETRAY_HOST_DEVICE
+    gradient_t gradient(const scalar_type x, const scalar_type y,
+                        const scalar_type z) const {
+
+        const auto [trf_ptr, grid_ptr] = backend_data();
+        const auto &transform = *trf_ptr;
+        const auto &grid = *grid_ptr;
+
+        // Position in grid coordinates
+        const scalar_type glob[3]{x, y, z};
+        scalar_type loc[3];
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            loc[i] = transform(i, 3u);
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                loc[i] += transform(i, j) * glob[j];
+            }
+        }
+
+        // Interpolation cell and position in the cell (same as covfie
+        // linear). Outside of the grid, the closest boundary cell is used.
+        std::size_t size[3];
+        std::size_t idx[3];
+        scalar_type frac[3];
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            size[i] = static_cast<std::size_t>(grid.m_sizes[i]);
+            const auto max_idx{
+                static_cast<scalar_type>(size[i] > 1u ? size[i] - 2u : 0u)};
+
+            const scalar_type lower{math::min(
+                math::max(math::floor(loc[i]), scalar_type{0}), max_idx)};
+            idx[i] = static_cast<std::size_t>(lower);
+            frac[i] = math::min(math::max(loc[i] - lower, scalar_type{0}),
+                                scalar_type{1});
+        }
+
+        // Derivatives of the interpolated field along the grid axes
+        gradient_t dBdu{};
+        for (unsigned int n = 0u; n < 8u; ++n) {
+            const std::size_t corner[3]{(n >> 2u) & 1u, (n >> 1u) & 1u,
+                                        n & 1u};
+            std::size_t pt[3];
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                pt[i] = math::min(idx[i] + corner[i], size[i] - 1u);
+            }
+            const auto b = grid.at({pt[0], pt[1], pt[2]});
+
+            // Interpolation weights of the corner and their derivatives
+            scalar_type w[3];
+            scalar_type dw[3];
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                w[i] = corner[i] == 1u ? frac[i] : 1.f - frac[i];
+                dw[i] = corner[i] == 1u ? 1.f : -1.f;
+            }
+            const scalar_type dwdu[3]{dw[0] * w[1] * w[2], w[0] * dw[1] * w[2],
+                                      w[0] * w[1] * dw[2]};
+
+            for (unsigned int c = 0u; c < 3u; ++c) {
+                for (unsigned int k = 0u; k < 3u; ++k) {
+                    dBdu[c][k] += dwdu[k] * b[c];
+                }
+            }
+        }
+
+        // Chain rule: du_k/dx_j is the linear part of the affine transform
+        gradient_t dBdx{};
+        for (unsigned int c = 0u; c < 3u; ++c) {
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                for (unsigned int k = 0u; k < 3u; ++k) {
+                    dBdx[c][j] += dBdu[c][k] * transform(k, j);
+                }
+            }
+        }
+
+        return dBdx;
+    }
+
+    private:
+    /// @returns pointers to the affine transform and to the grid storage below
+    /// the interpolation, which covfie does not expose otherwise
+    ///
+    /// @note This is the only place that reaches into the (public) members of
+    /// the non-owning covfie backends, as of covfie v0.9.0: affine::m_transform
+    /// and affine::m_backend, linear::m_backend and strided::m_sizes (used in
+    /// @c gradient()).
+    DETRAY_HOST_DEVICE
+    auto backend_data() const {
+        const auto &affine = m_view.backend();
+        return std::make_pair(&affine.m_transform, &affine.m_backend.m_backend);
+    }
+
+    /// The underlying covfie field view
+    view_t m_view;
+};
+
+/// Inhomogeneous field with analytic gradient (host)
+using inhom_grad_view_t = gradient_view<inhom_bknd_t>;
+
+}  // namespace detray::bfield
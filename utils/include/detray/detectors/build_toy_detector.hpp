@@ -498,10 +498,10 @@ inline void add_cylinder_grid(detector_builder_t &det_builder,
     using detector_t = typename detector_builder_t::detector_type;
     using scalar_t = typename detector_t::scalar_type;
 
-    constexpr auto grid_id = detector_t::accel::id::e_cylinder2_grid;
-
-    using cyl_grid_t =
-        typename detector_t::accelerator_container::template get_type<grid_id>;
+    // The grid type that is filled (the detector might store its compact
+    // representation)
+    using cyl_grid_t = typename detector_t::metadata::template cylinder_sf_grid<
+        typename detector_t::surface_type, host_container_types>;
     using grid_builder_t =
         grid_builder<detector_t, cyl_grid_t, detray::fill_by_pos>;
 
@@ -529,10 +529,10 @@ inline void add_disc_grid(detector_builder_t &det_builder, toy_det_config &cfg,
     using detector_t = typename detector_builder_t::detector_type;
     using scalar_t = typename detector_t::scalar_type;
 
-    constexpr auto grid_id = detector_t::accel::id::e_disc_grid;
-
-    using disc_grid_t =
-        typename detector_t::accelerator_container::template get_type<grid_id>;
+    // The grid type that is filled (the detector might store its compact
+    // representation)
+    using disc_grid_t = typename detector_t::metadata::template disc_sf_grid<
+        typename detector_t::surface_type, host_container_types>;
     using grid_builder_t =
         grid_builder<detector_t, disc_grid_t, detray::fill_by_pos>;
 
@@ -1177,15 +1177,19 @@ inline void add_beampipe_portals(
 /// present when an endcap detector is built to have the barrel region radius
 /// match the endcap diameter.
 ///
+/// @tparam metadata_t the detector type metadata, which has to provide the
+///         type ids of the toy detector (e.g. to swap the material map types)
+///
 /// @param resource vecmem memory resource to use for container allocations
 /// @param cfg toy detector configuration
 ///
 /// @returns a complete detector object
-template <typename scalar_t = detray::scalar>
+template <typename scalar_t = detray::scalar,
+          typename metadata_t = toy_metadata>
 inline auto build_toy_detector(vecmem::memory_resource &resource,
                                toy_det_config cfg = {}) {
 
-    using builder_t = detector_builder<toy_metadata, volume_builder>;
+    using builder_t = detector_builder<metadata_t, volume_builder>;
     using detector_t = typename builder_t::detector_type;
     using transform3_t = typename detector_t::transform3_type;
     using nav_link_t = typename detector_t::surface_type::navigation_link;
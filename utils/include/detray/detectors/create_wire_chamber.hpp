@@ -9,6 +9,7 @@
 
 // Project include(s)
 #include "detray/builders/grid_builder.hpp"
+#include "detray/builders/volume_lut_builder.hpp"
 #include "detray/core/detector.hpp"
 #include "detray/core/detector_metadata.hpp"
 #include "detray/definitions/detail/indexing.hpp"
@@ -459,35 +460,12 @@ inline auto create_wire_chamber(vecmem::memory_resource &resource,
         det.accelerator_store().template push_back<grid_id>(gbuilder.get());
         vol_desc.template set_accel_link<geo_obj_ids::e_sensitive>(
             grid_id, det.accelerator_store().template size<grid_id>() - 1u);
-
-        // Add volume grid
-        // TODO: Fill it
-
-        // Dimensions of the volume grid: minr, min phi, minz, maxr, maxphi,
-        // maxz
-        // TODO: Adapt to number of layers
-        mask<cylinder3D> vgrid_dims{0u,     0.f,   -constant<scalar_t>::pi,
-                                    -600.f, 180.f, constant<scalar_t>::pi,
-                                    600.f};
-        std::array<std::size_t, 3> n_vgrid_bins{1u, 1u, 1u};
-
-        const scalar_t outer_radius{inner_cyl_rad +
-                                    static_cast<scalar_t>(cfg.n_layers() + 1) *
-                                        cell_size * 2.f};
-        std::array<std::vector<scalar_t>, 3UL> bin_edges{
-            std::vector<scalar_t>{0.f, outer_radius},
-            std::vector<scalar_t>{-constant<scalar_t>::pi,
-                                  constant<scalar_t>::pi},
-            std::vector<scalar_t>{-cyl_half_z, cyl_half_z}};
-
-        grid_factory_type<typename detector_t::volume_finder> vgrid_factory{};
-        auto vgrid = vgrid_factory.template new_grid<
-            axis::open<axis::label::e_r>, axis::circular<axis::label::e_phi>,
-            axis::open<axis::label::e_z>, axis::irregular<>, axis::regular<>,
-            axis::irregular<>>(vgrid_dims, n_vgrid_bins, {}, bin_edges);
-        det.set_volume_finder(std::move(vgrid));
     }
 
+    // Add volume grid: r-z lookup table of the cylinder volumes
+    using vgrid_t = typename detector_t::volume_finder;
+    det.set_volume_finder(build_rz_volume_lut<vgrid_t>(det));
+
     return std::make_pair(std::move(det), std::move(name_map));
 }
 
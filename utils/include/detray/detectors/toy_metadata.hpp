@@ -157,8 +157,8 @@ struct toy_metadata {
     /// Volume search grid
     template <typename container_t = host_container_types>
     using volume_finder =
-        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular,
-                  axis::regular, axis::irregular>,
+        grid<axes<cylinder3D, axis::bounds::e_open, axis::irregular_lut,
+                  axis::regular, axis::irregular_lut>,
              bins::single<dindex>, simple_serializer, container_t>;
 };
 
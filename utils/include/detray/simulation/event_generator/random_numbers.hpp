@@ -10,9 +10,11 @@
 // Project include(s)
 #include "detray/definitions/detail/algebra.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/simulation/philox_engine.hpp"
 
 // System include(s)
 #include <array>
+#include <cstdint>
 #include <limits>
 #include <random>
 
@@ -26,7 +28,7 @@ struct random_numbers {
 
     using distribution_type = distribution_t;
     using engine_type = engine_t;
-    using seed_type = typename engine_t::result_type;
+    using seed_type = std::uint64_t;
 
     std::seed_seq m_seeds;
     engine_t m_engine;
@@ -50,6 +52,14 @@ struct random_numbers {
     random_numbers(random_numbers&& other)
         : m_engine(std::move(other.m_engine)) {}
 
+    /// Select the stream of a counter-based engine, e.g. one per track
+    template <typename E = engine_t,
+              std::enable_if_t<has_random_streams_v<E>, bool> = true>
+    DETRAY_HOST void set_stream(const std::uint32_t event,
+                                const std::uint32_t track) {
+        m_engine.set_stream(event, track);
+    }
+
     /// Generate random numbers in a given range
     DETRAY_HOST auto operator()(const std::array<scalar_t, 2> range = {
                                     -std::numeric_limits<scalar_t>::max(),
@@ -86,4 +96,11 @@ struct random_numbers {
     static constexpr seed_type default_seed() { return engine_t::default_seed; }
 };
 
+/// Random numbers from the counter-based engine: Every track can be generated
+/// from its own stream, independent of the other tracks
+template <typename scalar_t = scalar,
+          typename distribution_t = std::uniform_real_distribution<scalar_t>>
+using counter_random_numbers =
+    random_numbers<scalar_t, distribution_t, philox_engine>;
+
 }  // namespace detray::detail
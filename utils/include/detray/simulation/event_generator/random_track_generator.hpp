@@ -12,12 +12,15 @@
 #include "detray/definitions/detail/math.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
+#include "detray/simulation/event_generator/random_numbers.hpp"
 #include "detray/simulation/event_generator/random_track_generator_config.hpp"
+#include "detray/simulation/philox_engine.hpp"
 #include "detray/utils/ranges/ranges.hpp"
 
 // System include(s)
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <limits>
 #include <random>
 
@@ -34,6 +37,10 @@ namespace detray {
 /// @note Since the random number generator might not be copy constructible,
 /// neither is this generator. The iterators hold a reference to the rand
 /// generator, which must not be invalidated during the iteration.
+/// @note With a counter-based generator (e.g.
+/// @c detail::counter_random_numbers), the n-th track only depends on the
+/// seed, the event index and n, which makes the generation reproducible
+/// across threads.
 /// @note the random numbers are clamped to fit the phi/theta ranges. This can
 /// effect distribution mean etc.
 template <typename track_t, typename generator_t = detail::random_numbers<>>
@@ -89,6 +96,13 @@ class random_track_generator
         DETRAY_HOST_DEVICE
         track_t operator*() const {
 
+            // Counter-based generators draw every track from its own stream,
+            // so that the track does not depend on the order of generation
+            if constexpr (detail::has_random_streams_v<generator_t>) {
+                m_rnd_numbers.set_stream(m_cfg.event(),
+                                         static_cast<std::uint32_t>(m_tracks));
+            }
+
             const auto& ori = m_cfg.origin();
             const auto& ori_stddev = m_cfg.origin_stddev();
 
@@ -17,6 +17,7 @@
 // System include(s)
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <limits>
 #include <ostream>
 #include <random>
@@ -34,6 +35,9 @@ struct random_track_generator_config {
     /// Monte-Carlo seed
     seed_t m_seed{detail::random_numbers<>::default_seed()};
 
+    /// Event index (selects the random streams of counter-based generators)
+    std::uint32_t m_event{0u};
+
     /// How many tracks will be generated
     std::size_t m_n_tracks{10u};
 
@@ -64,6 +68,11 @@ struct random_track_generator_config {
         m_seed = s;
         return *this;
     }
+    DETRAY_HOST_DEVICE random_track_generator_config& event(
+        const std::uint32_t e) {
+        m_event = e;
+        return *this;
+    }
     DETRAY_HOST_DEVICE random_track_generator_config& do_vertex_smearing(
         bool b) {
         m_do_vtx_smearing = b;
@@ -197,6 +206,9 @@ struct random_track_generator_config {
     /// Getters
     /// @{
     DETRAY_HOST_DEVICE constexpr seed_t seed() const { return m_seed; }
+    DETRAY_HOST_DEVICE constexpr std::uint32_t event() const {
+        return m_event;
+    }
     DETRAY_HOST_DEVICE constexpr bool do_vertex_smearing() const {
         return m_do_vtx_smearing;
     }
@@ -0,0 +1,365 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/containers.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/definitions/pdg_particle.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/propagator/actor_chain.hpp"
+#include "detray/propagator/actors/aborters.hpp"
+#include "detray/propagator/actors/parameter_resetter.hpp"
+#include "detray/propagator/actors/parameter_transporter.hpp"
+#include "detray/propagator/batch_propagator.hpp"
+#include "detray/propagator/propagation_config.hpp"
+#include "detray/propagator/propagator.hpp"
+#include "detray/propagator/state_pool.hpp"
+#include "detray/simulation/event_generator/random_numbers.hpp"
+#include "detray/simulation/event_generator/random_track_generator.hpp"
+#include "detray/simulation/event_generator/random_track_generator_config.hpp"
+#include "detray/simulation/hit_recorder.hpp"
+#include "detray/simulation/random_scatterer.hpp"
+#include "detray/tracks/tracks.hpp"
+#include "detray/utils/thread_pool.hpp"
+
+// System include(s).
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <tuple>
+#include <vector>
+
+namespace detray {
+
+namespace simulation {
+
+/// Configuration of the fast simulation
+template <typename scalar_t>
+struct fast_sim_config {
+    /// Propagation setup (e.g. the path limit)
+    propagation::config propagation{};
+    /// Track generation (number of tracks, momentum range, seed, event...)
+    random_track_generator_config track_generator{};
+
+    /// Particle hypothesis
+    int pdg{pdg_particle::eMuon};
+    scalar_t mass{105.7f * unit<scalar_t>::MeV};
+    /// Material interactions
+    bool do_energy_loss{true};
+    bool do_multiple_scattering{true};
+
+    /// Number of threads (zero selects the number of hardware threads)
+    std::size_t n_threads{0u};
+    /// Number of consecutive tracks a thread takes at once
+    std::size_t chunk_size{16u};
+    /// Number of tracks that are simulated between two flushes of the hits
+    /// (in deterministic mode, the batches are shrunk if the hits of a batch
+    /// do not fit into the thread buffers)
+    std::size_t batch_size{10000u};
+    /// Number of hits every thread buffer is preallocated for
+    std::size_t hit_buffer_capacity{100000u};
+    /// Hand the hits to the output in the order of the track index, so that
+    /// the output does not depend on the number of threads
+    bool deterministic{true};
+};
+
+/// Summary of a fast simulation run
+struct fast_sim_summary {
+    /// Propagation statistics of all tracks
+    propagation::batch_statistics stats{};
+    /// Number of recorded hits
+    std::size_t n_hits{0u};
+
+    /// Print the summary
+    DETRAY_HOST
+    friend std::ostream &operator<<(std::ostream &out,
+                                    const fast_sim_summary &summary) {
+        out << summary.stats
+            << "  No. hits              : " << summary.n_hits << "\n";
+        return out;
+    }
+};
+
+}  // namespace simulation
+
+/// @brief Fast simulation of randomly generated tracks on a host thread pool.
+///
+/// Every track is generated, propagated and scattered with its own random
+/// streams (keyed by seed, event and track index), so the simulated hits of a
+/// track do not depend on the thread that processed it. The hits on the
+/// sensitive surfaces are collected in preallocated per-thread buffers and
+/// handed to an output sink in batches:
+///
+/// - deterministic mode: after every batch of tracks, the thread buffers are
+///   merged in the order of the track index and passed to the sink from the
+///   calling thread. A buffer can outgrow its capacity during a batch, in
+///   which case the following batches are made smaller.
+/// - throughput mode: every thread passes its buffer to the sink as soon as
+///   it is full (the calls are serialized), so the order of the hits depends
+///   on the scheduling.
+///
+/// @tparam stepper_t the stepper type, e.g. the RKN stepper
+/// @tparam navigator_t the navigator type
+template <typename stepper_t, typename navigator_t>
+class fast_simulator {
+
+    public:
+    using detector_type = typename navigator_t::detector_type;
+    using algebra_type = typename detector_type::algebra_type;
+    using scalar_type = dscalar<algebra_type>;
+    using track_type = free_track_parameters<algebra_type>;
+    using hit_type = simulation::hit<algebra_type>;
+    using hit_collection = std::vector<hit_type>;
+
+    using actor_chain_type =
+        actor_chain<dtuple, pathlimit_aborter,
+                    parameter_transporter<algebra_type>,
+                    hit_recorder<algebra_type>, random_scatterer<algebra_type>,
+                    parameter_resetter<algebra_type>>;
+    using propagator_type =
+        propagator<stepper_t, navigator_t, actor_chain_type>;
+
+    using config = simulation::fast_sim_config<scalar_type>;
+    using summary = simulation::fast_sim_summary;
+
+    private:
+    using track_generator_type =
+        random_track_generator<track_type, detail::counter_random_numbers<>>;
+    using state_pool_type = state_pool<propagator_type>;
+
+    /// Resources that are owned by a single thread
+    struct worker {
+        /// Propagation states with presized candidate buffers
+        state_pool_type states;
+        /// Random numbers for the track generation
+        detail::counter_random_numbers<> rand_numbers;
+        /// Hits that were not handed to the output yet
+        hit_collection hits{};
+        /// Number of successfully propagated tracks
+        std::size_t n_success{0u};
+
+        DETRAY_HOST
+        worker(const detector_type &det, const config &cfg)
+            : states{det}, rand_numbers{cfg.track_generator.seed()} {
+            hits.reserve(cfg.hit_buffer_capacity);
+        }
+    };
+
+    public:
+    /// Construct from the simulation configuration @param cfg
+    DETRAY_HOST
+    explicit fast_simulator(const config &cfg = {})
+        : m_cfg{cfg}, m_propagator{cfg.propagation}, m_pool{cfg.n_threads} {}
+
+    /// @returns the configuration
+    DETRAY_HOST
+    const config &get_config() const { return m_cfg; }
+
+    /// @returns the number of worker threads
+    DETRAY_HOST
+    std::size_t n_threads() const { return m_pool.size(); }
+
+    /// Simulate the tracks in the detector @param det without magnetic field
+    ///
+    /// @param sink callable that takes the hits as @c hit_collection
+    template <typename sink_t>
+    DETRAY_HOST summary run(const detector_type &det, sink_t &&sink) {
+        return run_impl(
+            [](state_pool_type &states, const track_type &track) {
+                return states.make_state(track);
+            },
+            det, sink);
+    }
+
+    /// Simulate the tracks in the detector @param det and the magnetic field
+    /// @param field
+    ///
+    /// @param sink callable that takes the hits as @c hit_collection
+    template <typename field_t, typename sink_t>
+    DETRAY_HOST summary run(const detector_type &det, const field_t &field,
+                            sink_t &&sink) {
+        return run_impl(
+            [&field](state_pool_type &states, const track_type &track) {
+                return states.make_state(track, field);
+            },
+            det, sink);
+    }
+
+    private:
+    /// Simulate all tracks, batch by batch
+    template <typename state_maker_t, typename sink_t>
+    DETRAY_HOST summary run_impl(state_maker_t &&make_state,
+                                 const detector_type &det, sink_t &sink) {
+
+        const std::size_t n_tracks{m_cfg.track_generator.n_tracks()};
+        std::size_t batch_size{std::max(std::size_t{1u}, m_cfg.batch_size)};
+
+        summary result{};
+        result.stats.n_tracks = n_tracks;
+        result.stats.n_threads = m_pool.size();
+
+        // Set up the thread resources once for the detector
+        if (m_workers.empty() ||
+            &(m_workers.front()->states.detector()) != &det) {
+            m_workers.clear();
+            for (std::size_t i = 0u; i < m_pool.size(); ++i) {
+                m_workers.push_back(std::make_unique<worker>(det, m_cfg));
+            }
+        }
+        for (auto &w : m_workers) {
+            w->hits.clear();
+            w->n_success = 0u;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t first = 0u; first < n_tracks;) {
+            const std::size_t n{std::min(batch_size, n_tracks - first)};
+
+            m_pool.parallel_for(
+                n, m_cfg.chunk_size,
+                [&](const std::size_t thread_idx, const std::size_t i) {
+                    worker &w = *m_workers[thread_idx];
+
+                    simulate(w, make_state, first + i);
+
+                    // Stream the hits out as soon as the buffer is full
+                    if (!m_cfg.deterministic &&
+                        w.hits.size() >= m_cfg.hit_buffer_capacity) {
+                        std::lock_guard<std::mutex> lock(m_sink_mutex);
+                        result.n_hits += w.hits.size();
+                        sink(static_cast<const hit_collection &>(w.hits));
+                        w.hits.clear();
+                    }
+                });
+
+            // The hits of a deterministic batch are only handed out at its
+            // end: Shrink the next batches to the capacity of the buffers
+            if (m_cfg.deterministic) {
+                std::size_t max_hits{0u};
+                for (const auto &w : m_workers) {
+                    max_hits = std::max(max_hits, w->hits.size());
+                }
+                if (max_hits > m_cfg.hit_buffer_capacity) {
+                    batch_size = std::max(
+                        std::size_t{1u},
+                        n * m_cfg.hit_buffer_capacity / max_hits);
+                }
+            }
+
+            result.n_hits += flush(sink);
+            first += n;
+        }
+
+        const std::chrono::duration<double> wall_time{
+            std::chrono::steady_clock::now() - start};
+        result.stats.wall_time = wall_time.count();
+
+        for (const auto &w : m_workers) {
+            result.stats.n_success += w->n_success;
+        }
+
+        return result;
+    }
+
+    /// Generate, propagate and scatter the track with index @param track_idx
+    template <typename state_maker_t>
+    DETRAY_HOST void simulate(worker &w, state_maker_t &make_state,
+                              const std::size_t track_idx) {
+
+        const auto event{m_cfg.track_generator.event()};
+        const auto track_id{static_cast<std::uint32_t>(track_idx)};
+
+        // The track only depends on the seed, the event and its index
+        const track_type track = *typename track_generator_type::iterator_t{
+            w.rand_numbers, m_cfg.track_generator, track_idx};
+
+        // Returns the candidate buffer to the pool when done
+        auto propagation_handle = make_state(w.states, track);
+        auto &propagation = *propagation_handle;
+
+        pathlimit_aborter::state aborter_state{};
+        aborter_state.set_path_limit(m_cfg.propagation.stepping.path_limit);
+        typename parameter_transporter<algebra_type>::state transporter_state{};
+        typename hit_recorder<algebra_type>::state recorder_state{
+            w.hits, event, track_id};
+        typename random_scatterer<algebra_type>::state scatterer_state{
+            m_cfg.track_generator.seed(), event, track_id};
+        scatterer_state.pdg = m_cfg.pdg;
+        scatterer_state.mass = m_cfg.mass;
+        scatterer_state.do_energy_loss = m_cfg.do_energy_loss;
+        scatterer_state.do_multiple_scattering = m_cfg.do_multiple_scattering;
+        typename parameter_resetter<algebra_type>::state resetter_state{};
+
+        auto actor_states =
+            std::tie(aborter_state, transporter_state, recorder_state,
+                     scatterer_state, resetter_state);
+
+        if (m_propagator.propagate(propagation, actor_states)) {
+            ++w.n_success;
+        }
+    }
+
+    /// Hand the remaining hits of all threads to the @param sink
+    ///
+    /// @returns the number of hits
+    template <typename sink_t>
+    DETRAY_HOST std::size_t flush(sink_t &sink) {
+        std::size_t n_hits{0u};
+
+        if (!m_cfg.deterministic) {
+            for (auto &w : m_workers) {
+                if (!w->hits.empty()) {
+                    n_hits += w->hits.size();
+                    sink(static_cast<const hit_collection &>(w->hits));
+                    w->hits.clear();
+                }
+            }
+            return n_hits;
+        }
+
+        // The hits of a track are contiguous in the buffer of the thread
+        // that simulated it: A stable sort restores the global order
+        m_merged.clear();
+        for (auto &w : m_workers) {
+            m_merged.insert(m_merged.end(), w->hits.begin(), w->hits.end());
+            w->hits.clear();
+        }
+        std::stable_sort(m_merged.begin(), m_merged.end(),
+                         [](const hit_type &a, const hit_type &b) {
+                             return a.track_id < b.track_id;
+                         });
+
+        n_hits = m_merged.size();
+        if (n_hits > 0u) {
+            sink(static_cast<const hit_collection &>(m_merged));
+        }
+        return n_hits;
+    }
+
+    /// Simulation configuration
+    config m_cfg;
+    /// The propagator is shared by all threads (it is stateless)
+    propagator_type m_propagator;
+    /// Thread pool that processes the tracks
+    thread_pool m_pool;
+    /// Resources per thread
+    std::vector<std::unique_ptr<worker>> m_workers{};
+    /// Merged hits of a batch in deterministic mode
+    hit_collection m_merged{};
+    /// Serializes the output in throughput mode
+    std::mutex m_sink_mutex{};
+};
+
+}  // namespace detray
@@ -0,0 +1,96 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/algebra.hpp"
+#include "detray/definitions/detail/qualifiers.hpp"
+#include "detray/geometry/barcode.hpp"
+#include "detray/propagator/base_actor.hpp"
+
+// System include(s).
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace detray {
+
+namespace simulation {
+
+/// Simulated measurement of a track on a sensitive surface
+template <typename algebra_t>
+struct hit {
+    using scalar_type = dscalar<algebra_t>;
+
+    /// Event and track the hit belongs to
+    std::uint32_t event_id{0u};
+    std::uint32_t track_id{0u};
+    /// The sensitive surface
+    geometry::barcode surface{};
+    /// Bound track parameters on the surface, before the material interaction
+    scalar_type loc0{0.f};
+    scalar_type loc1{0.f};
+    scalar_type phi{0.f};
+    scalar_type theta{0.f};
+    scalar_type qop{0.f};
+    scalar_type time{0.f};
+
+    /// Equality operator
+    bool operator==(const hit &) const = default;
+};
+
+}  // namespace simulation
+
+/// @brief Records the bound track parameters on every sensitive surface.
+///
+/// The hits are appended to an external buffer, which is usually owned by the
+/// thread that propagates the track and reused between tracks. Needs to run
+/// after the @c parameter_transporter.
+template <typename algebra_t>
+struct hit_recorder : actor {
+
+    using hit_type = simulation::hit<algebra_t>;
+
+    struct state {
+        /// Buffer the hits are appended to (not owning)
+        std::vector<hit_type> *hits{nullptr};
+        /// Identify the track
+        std::uint32_t event_id{0u};
+        std::uint32_t track_id{0u};
+
+        /// Construct from the hit buffer @param buffer of the track
+        /// @param event and @param track
+        DETRAY_HOST
+        state(std::vector<hit_type> &buffer, const std::uint32_t event = 0u,
+              const std::uint32_t track = 0u)
+            : hits{&buffer}, event_id{event}, track_id{track} {}
+    };
+
+    template <typename propagator_state_t>
+    DETRAY_HOST void operator()(state &recorder_state,
+                                const propagator_state_t &prop_state) const {
+
+        const auto &navigation = prop_state._navigation;
+
+        if (!navigation.is_on_sensitive()) {
+            return;
+        }
+
+        assert(recorder_state.hits != nullptr);
+
+        const auto &bound_params = prop_state._stepping._bound_params;
+        const auto loc = bound_params.bound_local();
+
+        recorder_state.hits->push_back(
+            {recorder_state.event_id, recorder_state.track_id,
+             navigation.barcode(), loc[0], loc[1], bound_params.phi(),
+             bound_params.theta(), bound_params.qop(), bound_params.time()});
+    }
+};
+
+}  // namespace detray
@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/definitions/detail/math.hpp"
+#include "detray/simulation/philox_engine.hpp"
 
 // System include(s).
 #include <array>
@@ -40,10 +41,14 @@ class landau_distribution {
     ///
     /// Reference[1]: ROOT TRandom.cxx
     /// Reference[2]: ACTS LandauDistribution.cxx
+    ///
+    /// @note With the counter-based @c philox_engine, the uniform random
+    /// number is converted without the standard library, so that the sample
+    /// does not depend on its implementation.
     template <typename generator_t>
     scalar_type operator()(generator_t &generator, const scalar_type location,
                            const scalar_type scale) const {
-        const auto z = std::uniform_real_distribution<scalar_type>()(generator);
+        const auto z = detail::uniform_01<scalar_type>(generator);
         // LANDAU quantile : algorithm from CERNLIB G110 ranlan
         // Converted by Rene Brun from CERNLIB routine ranlan(G110),
         // Moved and adapted to QuantFuncMathCore by B. List 29.4.2010
@@ -0,0 +1,241 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2024 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/detail/qualifiers.hpp"
+
+// System include(s).
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+
+namespace detray {
+
+/// @brief Counter-based random number engine (Philox4x32-10)
+///
+/// The engine holds no sequential state: the n-th random number of a stream
+/// is a pure function of the 64 bit key (the seed), the stream identifier and
+/// n. A stream is identified by an event, track and surface index, so that
+/// every track (and every material crossing of a track) draws from its own
+/// sequence, regardless of how the tracks are distributed over threads.
+/// Setting up a stream only writes a couple of integers.
+///
+/// The engine models the C++ UniformRandomBitGenerator, so it can be used
+/// with the standard distributions on the host.
+///
+/// Reference: J. K. Salmon et al., "Parallel Random Numbers: As Easy as 1, 2,
+/// 3", SC11 (2011)
+class philox_engine {
+
+    public:
+    using result_type = std::uint32_t;
+    using seed_type = std::uint64_t;
+    using counter_type = std::array<std::uint32_t, 4u>;
+    using key_type = std::array<std::uint32_t, 2u>;
+
+    static constexpr seed_type default_seed{5489u};
+
+    /// Construct from a @param seed and the stream identifier
+    DETRAY_HOST_DEVICE
+    constexpr explicit philox_engine(const seed_type sd = default_seed,
+                                     const std::uint32_t event = 0u,
+                                     const std::uint32_t track = 0u,
+                                     const std::uint32_t surface = 0u) {
+        seed(sd);
+        set_stream(event, track, surface);
+    }
+
+    /// Construct from a seed sequence @param seq (e.g. std::seed_seq)
+    template <typename seed_seq_t,
+              std::enable_if_t<!std::is_convertible_v<seed_seq_t, seed_type>,
+                               bool> = true>
+    DETRAY_HOST explicit philox_engine(seed_seq_t &seq) {
+        std::array<std::uint32_t, 2u> k{};
+        seq.generate(k.begin(), k.end());
+        m_key = {k[0], k[1]};
+    }
+
+    /// Set the key from a new seed @param sd and restart the stream
+    DETRAY_HOST_DEVICE
+    constexpr void seed(const seed_type sd = default_seed) {
+        m_key = {static_cast<std::uint32_t>(sd),
+                 static_cast<std::uint32_t>(sd >> 32u)};
+        restart();
+    }
+
+    /// Select the stream for a given @param event, @param track and
+    /// @param surface, starting at its first random number
+    DETRAY_HOST_DEVICE
+    constexpr void set_stream(const std::uint32_t event,
+                              const std::uint32_t track,
+                              const std::uint32_t surface = 0u) {
+        m_counter = {0u, surface, track, event};
+        m_pos = block_size;
+    }
+
+    /// Go back to the first random number of the current stream
+    DETRAY_HOST_DEVICE
+    constexpr void restart() {
+        m_counter[0] = 0u;
+        m_pos = block_size;
+    }
+
+    /// @returns the next random number of the stream
+    DETRAY_HOST_DEVICE
+    constexpr result_type operator()() {
+        if (m_pos == block_size) {
+            m_block = generate_block(m_counter, m_key);
+            ++m_counter[0];
+            m_pos = 0u;
+        }
+        return m_block[m_pos++];
+    }
+
+    /// Skip the next @param n random numbers in constant time
+    DETRAY_HOST_DEVICE
+    constexpr void discard(unsigned long long n) {
+        // Use up the current block first
+        while (n > 0u && m_pos < block_size) {
+            ++m_pos;
+            --n;
+        }
+        if (n == 0u) {
+            return;
+        }
+        m_counter[0] += static_cast<std::uint32_t>(n / block_size);
+        m_pos = block_size;
+
+        const auto rest{static_cast<std::uint32_t>(n % block_size)};
+        if (rest > 0u) {
+            (*this)();
+            m_pos = rest;
+        }
+    }
+
+    /// @returns a uniformly distributed random number in the open interval
+    /// (0, 1), independent of the standard library implementation
+    template <typename scalar_t>
+    DETRAY_HOST_DEVICE constexpr scalar_t uniform() {
+        if constexpr (sizeof(scalar_t) <= sizeof(std::uint32_t)) {
+            // 24 bits of mantissa
+            const auto r{static_cast<scalar_t>((*this)() >> 8u)};
+            return (r + scalar_t{0.5f}) * scalar_t{0x1p-24f};
+        } else {
+            // 53 bits of mantissa
+            const std::uint64_t hi{(*this)() >> 6u};
+            const std::uint64_t lo{(*this)() >> 5u};
+            const auto r{static_cast<scalar_t>((hi << 27u) | lo)};
+            return (r + scalar_t{0.5}) * scalar_t{0x1p-53};
+        }
+    }
+
+    /// The range of the random numbers
+    /// @{
+    DETRAY_HOST_DEVICE
+    static constexpr result_type min() { return 0u; }
+    DETRAY_HOST_DEVICE
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+    /// @}
+
+    /// @returns the key of the engine
+    DETRAY_HOST_DEVICE
+    constexpr const key_type &key() const { return m_key; }
+
+    /// @returns the counter of the next block of random numbers
+    DETRAY_HOST_DEVICE
+    constexpr const counter_type &counter() const { return m_counter; }
+
+    /// Equality operator: Same key and same position in the same stream
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const philox_engine &rhs) const {
+        return m_key == rhs.m_key && m_counter == rhs.m_counter &&
+               m_pos == rhs.m_pos &&
+               (m_pos == block_size || m_block == rhs.m_block);
+    }
+
+    /// The Philox4x32-10 bijection: encrypt the @param ctr with @param key
+    DETRAY_HOST_DEVICE
+    static constexpr counter_type generate_block(counter_type ctr,
+                                                 key_type key) {
+        for (unsigned int r = 0u; r < n_rounds; ++r) {
+            if (r > 0u) {
+                key[0] += weyl[0];
+                key[1] += weyl[1];
+            }
+            const std::uint64_t p0{std::uint64_t{mult[0]} * ctr[0]};
+            const std::uint64_t p1{std::uint64_t{mult[1]} * ctr[2]};
+
+            ctr = {static_cast<std::uint32_t>(p1 >> 32u) ^ ctr[1] ^ key[0],
+                   static_cast<std::uint32_t>(p1),
+                   static_cast<std::uint32_t>(p0 >> 32u) ^ ctr[3] ^ key[1],
+                   static_cast<std::uint32_t>(p0)};
+        }
+        return ctr;
+    }
+
+    private:
+    /// Number of random numbers per counter increment
+    static constexpr std::uint32_t block_size{4u};
+    /// Number of Philox rounds
+    static constexpr unsigned int n_rounds{10u};
+    /// Round multipliers
+    static constexpr std::array<std::uint32_t, 2u> mult{0xD2511F53u,
+                                                        0xCD9E8D57u};
+    /// Key schedule (Weyl sequence)
+    static constexpr std::array<std::uint32_t, 2u> weyl{0x9E3779B9u,
+                                                        0xBB67AE85u};
+
+    /// Word 0: block index in the stream, words 1-3: surface, track, event
+    counter_type m_counter{0u, 0u, 0u, 0u};
+    key_type m_key{0u, 0u};
+    /// Random numbers of the current block
+    counter_type m_block{0u, 0u, 0u, 0u};
+    /// Position of the next random number in the current block
+    std::uint32_t m_pos{block_size};
+};
+
+namespace detail {
+
+/// Helper trait that checks if a random number generator provides independent
+/// streams, which can be selected by event and track index
+/// @{
+template <typename generator_t, typename = void>
+struct has_random_streams : public std::false_type {};
+
+template <typename generator_t>
+struct has_random_streams<
+    generator_t, std::void_t<decltype(std::declval<generator_t &>().set_stream(
+                     std::declval<std::uint32_t>(),
+                     std::declval<std::uint32_t>()))>>
+    : public std::true_type {};
+
+template <typename generator_t>
+inline constexpr bool has_random_streams_v =
+    has_random_streams<generator_t>::value;
+/// @}
+
+/// @returns a uniformly distributed random number in (0, 1). Uses the
+/// portable conversion of the counter-based engine, if available.
+template <typename scalar_t, typename generator_t>
+DETRAY_HOST_DEVICE inline scalar_t uniform_01(generator_t &generator) {
+    if constexpr (std::is_same_v<generator_t, philox_engine>) {
+        return generator.template uniform<scalar_t>();
+    } else {
+        return std::uniform_real_distribution<scalar_t>()(generator);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace detray
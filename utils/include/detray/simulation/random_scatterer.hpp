@@ -8,6 +8,7 @@
 #pragma once
 
 // Project include(s).
+#include "detray/definitions/detail/indexing.hpp"
 #include "detray/definitions/detail/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/definitions/units.hpp"
@@ -15,6 +16,7 @@
 #include "detray/materials/interaction.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/simulation/landau_distribution.hpp"
+#include "detray/simulation/philox_engine.hpp"
 #include "detray/simulation/scattering_helper.hpp"
 #include "detray/tracks/bound_track_parameters.hpp"
 #include "detray/utils/axis_rotation.hpp"
@@ -22,6 +24,7 @@
 #include "detray/utils/unit_vectors.hpp"
 
 // System include(s).
+#include <cstdint>
 #include <random>
 
 namespace detray {
@@ -36,8 +39,17 @@ struct random_scatterer : actor {
     using interaction_type = interaction<scalar_type>;
 
     struct state {
-        std::random_device rd{};
-        std::mt19937_64 generator{rd()};
+        /// Counter-based random number generator: Every material crossing
+        /// draws from its own stream, keyed by (event, track, surface)
+        philox_engine generator{};
+
+        /// Identify the random stream of the track
+        std::uint32_t event_id{0u};
+        std::uint32_t track_id{0u};
+
+        /// Number of material interactions of the track so far (separates
+        /// the random streams, if a surface is crossed more than once)
+        std::uint32_t n_interactions{0u};
 
         /// The particle mass
         scalar_type mass{105.7f * unit<scalar_type>::MeV};
@@ -61,9 +73,21 @@ struct random_scatterer : actor {
         /// Constructor with seed
         ///
         /// @param sd the seed number
-        state(const uint_fast64_t sd = 0u) { generator.seed(sd); }
+        /// @param event the index of the event
+        /// @param track the index of the track in the event
+        state(const uint_fast64_t sd = 0u, const std::uint32_t event = 0u,
+              const std::uint32_t track = 0u)
+            : generator{sd}, event_id{event}, track_id{track} {}
 
         void set_seed(const uint_fast64_t sd) { generator.seed(sd); }
+
+        /// Select the random stream for the interaction on surface @param sf
+        void set_stream(const dindex sf) {
+            generator.set_stream(event_id, track_id, sf);
+            generator.discard(static_cast<unsigned long long>(n_interactions)
+                              << 16u);
+            ++n_interactions;
+        }
     };
 
     /// Material store visitor
@@ -141,7 +165,7 @@ struct random_scatterer : actor {
 
         auto& navigation = prop_state._navigation;
 
-        if (not navigation.is_on_module()) {
+        if (not navigation.encountered_sf_material()) {
             return;
         }
 
@@ -153,9 +177,16 @@ struct random_scatterer : actor {
             sf.cos_angle(geo_context_type{}, bound_params.dir(),
                          bound_params.bound_local())};
 
+        // Don't apply the interaction of the previous surface again
+        simulator_state.e_loss_mpv = 0.f;
+        simulator_state.e_loss_sigma = 0.f;
+        simulator_state.projected_scattering_angle = 0.f;
+
         sf.template visit_material<kernel>(simulator_state, bound_params,
                                            cos_inc_angle, is.local[0]);
 
+        simulator_state.set_stream(sf.index());
+
         // Get the new momentum
         const auto new_mom = attenuate(
             simulator_state.e_loss_mpv, simulator_state.e_loss_sigma,